@@ -0,0 +1,271 @@
+#include"Backend.h"
+
+#include<iostream>
+
+#ifndef NO_GLFW
+#include<GLFW/glfw3.h>
+#endif
+
+#if defined(__linux__)
+#define HAS_EGL 1
+#include<EGL/egl.h>
+#include<EGL/eglext.h>
+#endif
+
+#ifndef NO_GLFW
+// ----------------------------------------------------------------------------------------------
+// Window backend: the original main.cpp setup, a GLFW window with its own default framebuffer
+// ----------------------------------------------------------------------------------------------
+class WindowBackend : public Backend
+{
+public:
+	bool Init(int w, int h, const char* title) override
+	{
+		width = w;
+		height = h;
+
+		// start
+		glfwInit();
+
+		// Specify OpenGL version to GLFW package
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+
+		// Specify usage of CORE profile
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+		// DETAILS FOR BELOW FUNCTION
+
+			// create new GLFWwindow object sized at width x height pixels with name: as 3rd param
+			// 4th param: specifies which screen will host the window in full screen mode
+				// NULL for none, but can be specified with a "glfwGetMonitors" query (which returns an array of monitors)
+			// 5th param: specifies another window object that will share resources to THIS one
+		window = glfwCreateWindow(width, height, title, NULL, NULL);
+		if (window == NULL)
+		{
+			std::cout << "Failed to create GLFW window" << std::endl;
+			glfwTerminate();
+			return false;
+		}
+		// DETAILS FOR BELOW FUNCTION
+
+			// a rendering context is a state where all the OpenGL commands are applied
+			// To draw graphics, you need to have a current rendering context
+			// glfwMakeContextCurrent is called to specify which window's rendering context you want to make current
+			// telling GLFW that you want to work with OpenGL in the context of a specific window.
+			// All subsequent OpenGL operations will affect this window until you set a different context with glfwMakeContextCurrent.
+			//  if you have multiple windows, you'll call glfwMakeContextCurrent for each window before rendering to it
+		glfwMakeContextCurrent(window);
+		return true;
+	}
+
+	GLADloadproc GetProcLoader() const override
+	{
+		return (GLADloadproc)glfwGetProcAddress;
+	}
+
+	// the window already comes with a framebuffer, nothing to make
+	bool CreateTargets() override { return true; }
+
+	bool ShouldClose() const override
+	{
+		return glfwWindowShouldClose(window);
+	}
+
+	void BeginFrame() override
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	}
+
+	void EndFrame() override
+	{
+		// swaps the buffers
+		glfwSwapBuffers(window);
+
+		glfwPollEvents();
+	}
+
+	void Shutdown() override
+	{
+		// end logic
+		if (window != NULL)
+		{
+			glfwDestroyWindow(window);
+			window = NULL;
+		}
+		glfwTerminate();
+	}
+
+	const char* Name() const override { return "window"; }
+
+private:
+	GLFWwindow* window = NULL;
+};
+#endif
+
+#ifdef HAS_EGL
+// ----------------------------------------------------------------------------------------------
+// Headless backend: EGL context with NO surface at all, everything is drawn into a framebuffer object
+// ----------------------------------------------------------------------------------------------
+class HeadlessBackend : public Backend
+{
+public:
+	bool Init(int w, int h, const char*) override
+	{
+		width = w;
+		height = h;
+
+		// the surfaceless platform lets Mesa hand us a context without X11/Wayland or a GPU (falls back to llvmpipe)
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+			(PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay != NULL)
+			display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+		if (display == EGL_NO_DISPLAY)
+			display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+		EGLint major, minor;
+		if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+		{
+			std::cout << "Failed to initialize EGL display" << std::endl;
+			return false;
+		}
+
+		// we want desktop OpenGL, not GLES
+		if (!eglBindAPI(EGL_OPENGL_API))
+		{
+			std::cout << "EGL can't bind the OpenGL API" << std::endl;
+			return false;
+		}
+
+		// same version + CORE profile that the window asks GLFW for
+		const EGLint contextAttribs[] =
+		{
+			EGL_CONTEXT_MAJOR_VERSION, 3,
+			EGL_CONTEXT_MINOR_VERSION, 3,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		// no config and no surface: needs EGL_KHR_no_config_context + EGL_KHR_surfaceless_context
+		context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttribs);
+		if (context == EGL_NO_CONTEXT)
+		{
+			std::cout << "Failed to create EGL context (0x" << std::hex << eglGetError() << std::dec << ")" << std::endl;
+			eglTerminate(display);
+			display = EGL_NO_DISPLAY;
+			return false;
+		}
+
+		if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+		{
+			std::cout << "Failed to make the EGL context current" << std::endl;
+			Shutdown();
+			return false;
+		}
+		return true;
+	}
+
+	GLADloadproc GetProcLoader() const override
+	{
+		// EGL_KHR_get_all_proc_addresses: core functions come out of eglGetProcAddress too
+		return (GLADloadproc)eglGetProcAddress;
+	}
+
+	bool CreateTargets() override
+	{
+		// there is no default framebuffer without a surface, so we make our own:
+		// a color renderbuffer and a depth/stencil one (what a GLFW window gets by default) attached to a framebuffer object
+		glGenFramebuffers(1, &fbo);
+		glGenRenderbuffers(1, &colorBuffer);
+		glGenRenderbuffers(1, &depthBuffer);
+
+		glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+		glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+		GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		if (status != GL_FRAMEBUFFER_COMPLETE)
+		{
+			std::cout << "Headless framebuffer is incomplete (0x" << std::hex << status << std::dec << ")" << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	bool ShouldClose() const override { return false; }
+
+	void BeginFrame() override
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	}
+
+	void EndFrame() override
+	{
+		// nothing to present, just make sure the driver starts working on what we queued
+		glFlush();
+	}
+
+	void Shutdown() override
+	{
+		if (context != EGL_NO_CONTEXT)
+		{
+			if (fbo != 0)
+				glDeleteFramebuffers(1, &fbo);
+			if (colorBuffer != 0)
+				glDeleteRenderbuffers(1, &colorBuffer);
+			if (depthBuffer != 0)
+				glDeleteRenderbuffers(1, &depthBuffer);
+			fbo = colorBuffer = depthBuffer = 0;
+
+			eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			eglDestroyContext(display, context);
+			context = EGL_NO_CONTEXT;
+		}
+		if (display != EGL_NO_DISPLAY)
+		{
+			eglTerminate(display);
+			display = EGL_NO_DISPLAY;
+		}
+	}
+
+	GLuint Framebuffer() const override { return fbo; }
+
+	const char* Name() const override { return "headless"; }
+
+private:
+	EGLDisplay display = EGL_NO_DISPLAY;
+	EGLContext context = EGL_NO_CONTEXT;
+	GLuint fbo = 0;
+	GLuint colorBuffer = 0;
+	GLuint depthBuffer = 0;
+};
+#endif
+
+std::unique_ptr<Backend> CreateBackend(BackendType type)
+{
+	switch (type)
+	{
+	case BackendType::Window:
+#ifndef NO_GLFW
+		return std::unique_ptr<Backend>(new WindowBackend());
+#else
+		break;
+#endif
+	case BackendType::Headless:
+#ifdef HAS_EGL
+		return std::unique_ptr<Backend>(new HeadlessBackend());
+#else
+		break;
+#endif
+	case BackendType::Software:
+		// not a GL backend, there's no context to make
+		break;
+	}
+	return nullptr;
+}
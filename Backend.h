@@ -0,0 +1,60 @@
+#ifndef BACKEND_CLASS_H
+#define BACKEND_CLASS_H
+
+#include<memory>
+#include<glad/glad.h>
+
+// * NOTE: a backend owns the OpenGL CONTEXT and the place we draw into. The render loop in main.cpp
+// doesn't care which one it got, it just asks the backend to begin and end each frame.
+
+// which kind of context to create
+enum class BackendType
+{
+	Window,   // GLFW window, presents with glfwSwapBuffers
+	Headless, // EGL surfaceless context (Mesa llvmpipe on GPU-less boxes), renders into a framebuffer object
+	Software  // no GL at all: SoftRasterizer draws on the CPU (main hands the run to RunSoftware, see SoftwareRenderer.h)
+};
+
+class Backend
+{
+public:
+	virtual ~Backend() {}
+
+	// creates the context and makes it current. Nothing GL related can be called before this
+	virtual bool Init(int width, int height, const char* title) = 0;
+
+	// function used by gladLoadGLLoader to look up GL entry points for THIS context
+	virtual GLADloadproc GetProcLoader() const = 0;
+
+	// called once glad is loaded, this is where the headless backend creates its framebuffer object
+	virtual bool CreateTargets() = 0;
+
+	// window: the user closed it. headless: never, main decides how many frames to run
+	virtual bool ShouldClose() const = 0;
+
+	// binds whatever we render into for this frame
+	virtual void BeginFrame() = 0;
+	// presents the frame (swap buffers + poll events, or just flush when headless)
+	virtual void EndFrame() = 0;
+
+	// deletes the targets and destroys the context
+	virtual void Shutdown() = 0;
+
+	// framebuffer that BeginFrame binds. 0 is the default (window) framebuffer
+	virtual GLuint Framebuffer() const { return 0; }
+
+	virtual const char* Name() const = 0;
+
+	int Width() const { return width; }
+	int Height() const { return height; }
+
+protected:
+	int width = 0;
+	int height = 0;
+};
+
+// returns nullptr when the requested backend wasn't compiled into this build
+// (headless needs EGL, which is only wired up on Linux; the window needs GLFW unless NO_GLFW is defined)
+std::unique_ptr<Backend> CreateBackend(BackendType type);
+
+#endif
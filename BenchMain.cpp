@@ -0,0 +1,322 @@
+#include<cstdio>
+#include<cstdlib>
+#include<chrono>
+#include<fstream>
+#include<iostream>
+#include<string>
+#include<vector>
+#include<glad/glad.h>
+
+#include"Backend.h"
+#include"Benchmark.h"
+#include"Options.h"
+#include"ProgramCache.h"
+#include"Readback.h"
+#include"Scene.h"
+#include"ShaderManager.h"
+#include"SoftRasterizer.h"
+#include"StateCache.h"
+#include"VertexArrayCache.h"
+
+// * NOTE: gl_bench runs a fixed suite of scenes through the same frame loop as main.cpp (headless, so it runs the
+// same on a build box as on a desk) and prints one line of frame time percentiles per case. It's what gets compared
+// before and after a performance change:
+//
+//   gl_bench [--frames N] [--warmup N] [--size WxH] [--filter NAME] [--json FILE] [--list]
+//
+// For a single configuration with every knob available, use the app itself with --headless --bench
+
+// one benchmark case: a scene and the options that change how it's drawn
+struct BenchCase
+{
+	const char* name;
+	SceneType scene;
+	int instances;
+	StreamMode stream;
+	bool sortDraws;
+	ReadbackOption readback;
+	MeshOptimization meshOpt;
+	// drawn by SoftRasterizer on the CPU (what --soft does) instead of the GL context, to put next to llvmpipe
+	bool software;
+	// the mesh scene's vertex buffer layout
+	VertexFormat vertexFormat;
+};
+
+// new scenes and new paths through an existing scene get a line here
+static const BenchCase cases[] =
+{
+	{ "triangle",          SceneType::Triangle,  0,      StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "stream_ring",       SceneType::Triangle,  0,      StreamMode::Ring,       true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "stream_bufferdata", SceneType::Triangle,  0,      StreamMode::BufferData, true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "naive_10k",         SceneType::Naive,     10000,  StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "instanced_100k",    SceneType::Instanced, 100000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "queue_sorted_5k",   SceneType::Queue,     5000,   StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "queue_unsorted_5k", SceneType::Queue,     5000,   StreamMode::Off,        false, ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "readback_sync",     SceneType::Triangle,  0,      StreamMode::Off,        true,  ReadbackOption::Sync, MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "readback_pbo",      SceneType::Triangle,  0,      StreamMode::Off,        true,  ReadbackOption::Pbo,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "mesh_soup",         SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Off,   false, VertexFormat::Auto },
+	{ "mesh_indexed",      SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Index, false, VertexFormat::Auto },
+	{ "mesh_cache",        SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Cache, false, VertexFormat::Auto },
+	{ "mesh_full",         SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Auto },
+	{ "mesh_float",        SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Float },
+	{ "mesh_half",         SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Half },
+	{ "mesh_quant16",      SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Quantized16 },
+	{ "mesh_quant10",      SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  false, VertexFormat::Quantized10 },
+	{ "soft_triangle",     SceneType::Triangle,  0,      StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  true,  VertexFormat::Auto },
+	{ "soft_mesh_soup",    SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Off,   true,  VertexFormat::Auto },
+	{ "soft_mesh_full",    SceneType::Mesh,      200000, StreamMode::Off,        true,  ReadbackOption::Off,  MeshOptimization::Full,  true,  VertexFormat::Auto },
+};
+
+struct BenchResult
+{
+	const BenchCase* benchCase;
+	FrameStats cpu;
+	FrameStats gpu;
+};
+
+// RunCase for the software rasterizer: wall time per frame, there's no GPU time
+static bool RunSoftwareCase(const AppOptions& options, const BenchCase& benchCase, int width, int height, int warmup, int frames,
+	BenchResult& result)
+{
+	std::unique_ptr<Scene> scene = CreateScene(options);
+	if (scene == nullptr || !scene->InitSoftware())
+		return false;
+
+	SoftRasterizer raster(width, height);
+	std::vector<double> times;
+	for (int frame = 0; frame < warmup + frames; frame++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		raster.BeginFrame(0.07f, 0.13f, 0.17f, 1.0f);
+		scene->DrawSoftware(raster, frame);
+		raster.EndFrame();
+		if (frame >= warmup)
+			times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+
+	result.benchCase = &benchCase;
+	result.cpu = ComputeStats(times);
+	result.gpu = FrameStats();
+	return true;
+}
+
+// renders warmup + frames frames of one case and returns its stats
+static bool RunCase(Backend& backend, VertexArrayCache& vertexArrays, const BenchCase& benchCase, int warmup, int frames, BenchResult& result)
+{
+	AppOptions options;
+	options.scene = benchCase.scene;
+	options.instances = benchCase.instances;
+	options.stream = benchCase.stream;
+	options.sortDraws = benchCase.sortDraws;
+	options.meshOpt = benchCase.meshOpt;
+	options.vertexFormat = benchCase.vertexFormat;
+	if (benchCase.software)
+		return RunSoftwareCase(options, benchCase, backend.Width(), backend.Height(), warmup, frames, result);
+
+	// no program binary cache: every case starts from the same place, and warmup covers the compile
+	ProgramCache programCache("");
+	ShaderManager shaders(&programCache);
+	std::unique_ptr<Scene> scene = CreateScene(options);
+	if (scene == nullptr)
+		return false;
+	scene->AddPrograms(shaders);
+	shaders.Submit();
+	if (!scene->BuildGeometry(vertexArrays))
+		return false;
+
+	std::unique_ptr<Readback> readback;
+	if (benchCase.readback != ReadbackOption::Off)
+		readback.reset(new Readback(benchCase.readback == ReadbackOption::Sync ? ReadbackMode::Sync : ReadbackMode::Pbo,
+			backend.Width(), backend.Height()));
+
+	// the queries belong to the context, so the benchmark goes before the scene does
+	StateCache state;
+	{
+		Benchmark bench(warmup, frames);
+		for (int frame = 0; !bench.Done(); frame++)
+		{
+			bench.BeginFrame();
+			backend.BeginFrame();
+			state.ClearColor(0.07f, 0.13f, 0.17f, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT);
+			scene->Draw(state, frame);
+			if (readback)
+				readback->ReadFrame(backend.Framebuffer(), frame);
+			backend.EndFrame();
+			state.EndFrame();
+			bench.EndFrame();
+		}
+		if (readback)
+			readback->Finish();
+		glFinish();
+		bench.Finish();
+
+		result.benchCase = &benchCase;
+		result.cpu = ComputeStats(bench.CpuTimes());
+		result.gpu = ComputeStats(bench.GpuTimes());
+	}
+	return shaders.Failed() == 0;
+}
+
+static void WriteStatsJSON(std::ofstream& file, const char* name, const FrameStats& stats)
+{
+	file << "\"" << name << "\": { \"mean_ms\": " << stats.mean << ", \"p50_ms\": " << stats.p50 << ", \"p95_ms\": " << stats.p95
+		<< ", \"p99_ms\": " << stats.p99 << ", \"max_ms\": " << stats.max << " }";
+}
+
+// summary of every case, for scripts comparing two runs
+static bool WriteJSON(const std::string& path, const BenchmarkInfo& info, int warmup, int frames, const std::vector<BenchResult>& results)
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		std::cout << "Can't write " << path << std::endl;
+		return false;
+	}
+
+	file << "{\n"
+		<< "  \"renderer\": \"" << JsonEscape(info.renderer) << "\",\n"
+		<< "  \"width\": " << info.width << ",\n"
+		<< "  \"height\": " << info.height << ",\n"
+		<< "  \"warmup_frames\": " << warmup << ",\n"
+		<< "  \"measured_frames\": " << frames << ",\n"
+		<< "  \"cases\": [\n";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		file << "    { \"name\": \"" << results[i].benchCase->name << "\", ";
+		WriteStatsJSON(file, "cpu", results[i].cpu);
+		file << ", ";
+		WriteStatsJSON(file, "gpu", results[i].gpu);
+		file << " }" << (i + 1 < results.size() ? "," : "") << "\n";
+	}
+	file << "  ]\n}\n";
+	return true;
+}
+
+static void PrintUsage(const char* program)
+{
+	std::cout << "usage: " << program << " [--frames N] [--warmup N] [--size WxH] [--filter NAME] [--json FILE] [--list]\n"
+		<< "  --frames N     measured frames per case (default 300)\n"
+		<< "  --warmup N     frames rendered before measuring (default 50)\n"
+		<< "  --size WxH     render target size (default 800x800)\n"
+		<< "  --filter NAME  only run the cases whose name contains NAME\n"
+		<< "  --json FILE    write every case's percentiles to FILE\n"
+		<< "  --list         print the case names and exit" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	int frames = 300;
+	int warmup = 50;
+	int width = 800;
+	int height = 800;
+	std::string filter;
+	std::string jsonPath;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "--frames" && hasValue)
+			frames = std::atoi(argv[++i]);
+		else if (arg == "--warmup" && hasValue)
+			warmup = std::atoi(argv[++i]);
+		else if (arg == "--size" && hasValue)
+		{
+			if (std::sscanf(argv[++i], "%dx%d", &width, &height) != 2)
+				width = height = 0;
+		}
+		else if (arg == "--filter" && hasValue)
+			filter = argv[++i];
+		else if (arg == "--json" && hasValue)
+			jsonPath = argv[++i];
+		else if (arg == "--list")
+		{
+			for (const BenchCase& benchCase : cases)
+				std::cout << benchCase.name << std::endl;
+			return 0;
+		}
+		else
+		{
+			PrintUsage(argv[0]);
+			return 2;
+		}
+	}
+	if (frames <= 0 || warmup < 0 || width <= 0 || height <= 0)
+	{
+		PrintUsage(argv[0]);
+		return 2;
+	}
+
+	std::unique_ptr<Backend> backend = CreateBackend(BackendType::Headless);
+	if (backend == nullptr)
+		backend = CreateBackend(BackendType::Window);
+	if (backend == nullptr || !backend->Init(width, height, "gl_bench"))
+	{
+		std::cout << "No backend to run the benchmarks with" << std::endl;
+		return 2;
+	}
+#ifdef GLAD_MX
+	static GladGLContext glContext;
+	int loaded = gladLoadGLContext(&glContext, backend->GetProcLoader());
+	gladSetGLContext(&glContext);
+#else
+	int loaded = gladLoadGLLoader(backend->GetProcLoader());
+#endif
+	if (!loaded || !backend->CreateTargets())
+	{
+		std::cout << "Failed to set up GL" << std::endl;
+		backend->Shutdown();
+		return 2;
+	}
+	glViewport(0, 0, width, height);
+
+	BenchmarkInfo info;
+	info.backend = backend->Name();
+	info.width = width;
+	info.height = height;
+	QueryContextInfo(info);
+	std::cout << "gl_bench on " << info.renderer << " (" << info.backend << "), " << width << "x" << height << ", "
+		<< warmup << " warmup + " << frames << " measured frames per case" << std::endl;
+
+	// one for the context, shared by the cases like the scenes of a real program would share it
+	std::unique_ptr<VertexArrayCache> vertexArrays(new VertexArrayCache);
+	std::vector<BenchResult> results;
+	int failed = 0;
+	std::printf("  %-20s %9s %9s %9s %9s   %9s %9s %9s   %9s\n", "case", "cpu mean", "cpu p50", "cpu p99", "cpu max", "gpu mean", "gpu p50", "gpu p99",
+		"Mpix/s");
+	for (const BenchCase& benchCase : cases)
+	{
+		if (!filter.empty() && std::string(benchCase.name).find(filter) == std::string::npos)
+			continue;
+
+		BenchResult result;
+		if (!RunCase(*backend, *vertexArrays, benchCase, warmup, frames, result))
+		{
+			std::printf("  %-20s failed\n", benchCase.name);
+			failed++;
+			continue;
+		}
+		results.push_back(result);
+		// output pixels per second at whichever side was slower, so GL (llvmpipe) and software cases compare directly
+		double frameMs = result.cpu.mean > result.gpu.mean ? result.cpu.mean : result.gpu.mean;
+		double megapixels = frameMs > 0.0 ? (double)width * height / (frameMs * 1000.0) : 0.0;
+		if (benchCase.software)
+			std::printf("  %-20s %9.4f %9.4f %9.4f %9.4f   %9s %9s %9s   %9.1f\n", benchCase.name, result.cpu.mean, result.cpu.p50,
+				result.cpu.p99, result.cpu.max, "-", "-", "-", megapixels);
+		else
+			std::printf("  %-20s %9.4f %9.4f %9.4f %9.4f   %9.4f %9.4f %9.4f   %9.1f\n", benchCase.name, result.cpu.mean, result.cpu.p50,
+				result.cpu.p99, result.cpu.max, result.gpu.mean, result.gpu.p50, result.gpu.p99, megapixels);
+	}
+
+	if (!jsonPath.empty())
+		WriteJSON(jsonPath, info, warmup, frames, results);
+
+	vertexArrays.reset();
+	backend->Shutdown();
+	if (results.empty() && failed == 0)
+	{
+		std::cout << "no case matches " << filter << std::endl;
+		return 2;
+	}
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,204 @@
+#include"Benchmark.h"
+
+#include<algorithm>
+#include<cmath>
+#include<cstdio>
+#include<fstream>
+#include<iostream>
+
+FrameStats ComputeStats(std::vector<double> samples)
+{
+	FrameStats stats;
+	if (samples.empty())
+		return stats;
+
+	std::sort(samples.begin(), samples.end());
+
+	double sum = 0.0;
+	for (double s : samples)
+		sum += s;
+	stats.mean = sum / samples.size();
+
+	// nearest-rank: the smallest sample that at least p% of the samples are less than or equal to
+	auto percentile = [&samples](double p)
+	{
+		size_t rank = (size_t)std::ceil(p / 100.0 * samples.size());
+		if (rank < 1)
+			rank = 1;
+		return samples[std::min(rank, samples.size()) - 1];
+	};
+	stats.p50 = percentile(50.0);
+	stats.p95 = percentile(95.0);
+	stats.p99 = percentile(99.0);
+	stats.max = samples.back();
+	return stats;
+}
+
+void QueryContextInfo(BenchmarkInfo& info)
+{
+	auto str = [](GLenum name)
+	{
+		const GLubyte* s = glGetString(name);
+		return s != NULL ? std::string((const char*)s) : std::string("unknown");
+	};
+	info.vendor = str(GL_VENDOR);
+	info.renderer = str(GL_RENDERER);
+	info.version = str(GL_VERSION);
+}
+
+Benchmark::Benchmark(int warmupFrames, int measuredFrames)
+	: warmupFrames(warmupFrames), measuredFrames(measuredFrames)
+{
+	glGenQueries(QueryCount, queries);
+	for (int i = 0; i < QueryCount; i++)
+		queryFrame[i] = -1;
+
+	cpuTimes.reserve(measuredFrames);
+	gpuTimes.reserve(measuredFrames);
+}
+
+Benchmark::~Benchmark()
+{
+	glDeleteQueries(QueryCount, queries);
+}
+
+void Benchmark::BeginFrame()
+{
+	int slot = frame % QueryCount;
+	// the slot we're about to reuse still holds a frame from QueryCount frames ago, its result is (almost always) ready by now
+	if (queryFrame[slot] >= 0)
+		CollectQuery(slot);
+
+	frameStart = std::chrono::steady_clock::now();
+	glBeginQuery(GL_TIME_ELAPSED, queries[slot]);
+	queryFrame[slot] = frame;
+}
+
+void Benchmark::EndFrame()
+{
+	glEndQuery(GL_TIME_ELAPSED);
+	double cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+
+	if (frame >= warmupFrames)
+		cpuTimes.push_back(cpuMs);
+	frame++;
+}
+
+void Benchmark::CollectQuery(int slot)
+{
+	// GL_QUERY_RESULT blocks until the GPU is done with that frame
+	GLuint64 nanoseconds = 0;
+	glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &nanoseconds);
+
+	// gpu samples are stored in frame order because slots are collected oldest first
+	if (queryFrame[slot] >= warmupFrames)
+		gpuTimes.push_back(nanoseconds / 1.0e6);
+	queryFrame[slot] = -1;
+}
+
+void Benchmark::Finish()
+{
+	// oldest in-flight frame first, so gpuTimes stays in frame order
+	for (int i = 0; i < QueryCount; i++)
+	{
+		int slot = (frame + i) % QueryCount;
+		if (queryFrame[slot] >= 0)
+			CollectQuery(slot);
+	}
+}
+
+void Benchmark::Print(const BenchmarkInfo& info) const
+{
+	FrameStats cpu = ComputeStats(cpuTimes);
+	FrameStats gpu = ComputeStats(gpuTimes);
+
+	std::printf("benchmark: %s, %dx%d, %s (%s)\n", info.backend.c_str(), info.width, info.height,
+		info.renderer.c_str(), info.version.c_str());
+	std::printf("  %d warmup + %d measured frames\n", warmupFrames, (int)cpuTimes.size());
+	std::printf("          %9s %9s %9s %9s %9s\n", "mean", "p50", "p95", "p99", "max");
+	std::printf("  cpu ms  %9.4f %9.4f %9.4f %9.4f %9.4f\n", cpu.mean, cpu.p50, cpu.p95, cpu.p99, cpu.max);
+	std::printf("  gpu ms  %9.4f %9.4f %9.4f %9.4f %9.4f\n", gpu.mean, gpu.p50, gpu.p95, gpu.p99, gpu.max);
+}
+
+bool Benchmark::WriteCSV(const std::string& path) const
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		std::cout << "Can't write " << path << std::endl;
+		return false;
+	}
+
+	file << "frame,cpu_ms,gpu_ms\n";
+	for (size_t i = 0; i < cpuTimes.size(); i++)
+	{
+		file << i << ',' << cpuTimes[i] << ',';
+		if (i < gpuTimes.size())
+			file << gpuTimes[i];
+		file << '\n';
+	}
+	return true;
+}
+
+std::string JsonEscape(const std::string& s)
+{
+	std::string out;
+	for (char c : s)
+	{
+		if (c == '"' || c == '\\')
+		{
+			out += '\\';
+			out += c;
+		}
+		else if ((unsigned char)c < 0x20)
+		{
+			// control characters aren't allowed raw in a JSON string, \u00XX keeps them without losing anything
+			char escaped[8];
+			std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned)(unsigned char)c);
+			out += escaped;
+		}
+		else
+			out += c;
+	}
+	return out;
+}
+
+static void WriteStatsJSON(std::ofstream& file, const char* name, const std::vector<double>& samples)
+{
+	FrameStats stats = ComputeStats(samples);
+	file << "  \"" << name << "\": {\n"
+		<< "    \"mean_ms\": " << stats.mean << ",\n"
+		<< "    \"p50_ms\": " << stats.p50 << ",\n"
+		<< "    \"p95_ms\": " << stats.p95 << ",\n"
+		<< "    \"p99_ms\": " << stats.p99 << ",\n"
+		<< "    \"max_ms\": " << stats.max << ",\n"
+		<< "    \"samples_ms\": [";
+	for (size_t i = 0; i < samples.size(); i++)
+		file << (i == 0 ? "" : ", ") << samples[i];
+	file << "]\n  }";
+}
+
+bool Benchmark::WriteJSON(const std::string& path, const BenchmarkInfo& info) const
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		std::cout << "Can't write " << path << std::endl;
+		return false;
+	}
+
+	file << "{\n"
+		<< "  \"backend\": \"" << JsonEscape(info.backend) << "\",\n"
+		<< "  \"vendor\": \"" << JsonEscape(info.vendor) << "\",\n"
+		<< "  \"renderer\": \"" << JsonEscape(info.renderer) << "\",\n"
+		<< "  \"version\": \"" << JsonEscape(info.version) << "\",\n"
+		<< "  \"width\": " << info.width << ",\n"
+		<< "  \"height\": " << info.height << ",\n"
+		<< "  \"warmup_frames\": " << warmupFrames << ",\n"
+		<< "  \"measured_frames\": " << cpuTimes.size() << ",\n";
+	WriteStatsJSON(file, "cpu", cpuTimes);
+	file << ",\n";
+	WriteStatsJSON(file, "gpu", gpuTimes);
+	file << "\n}\n";
+	return true;
+}
@@ -0,0 +1,95 @@
+#ifndef BENCHMARK_CLASS_H
+#define BENCHMARK_CLASS_H
+
+#include<chrono>
+#include<string>
+#include<vector>
+#include<glad/glad.h>
+
+// * NOTE: two different clocks are measured per frame:
+//   CPU time: how long the loop body took on OUR side (submitting commands, swapping buffers)
+//   GPU time: how long the GPU spent executing the commands, measured with GL_TIME_ELAPSED queries
+// GPU results arrive a few frames late, so queries are kept in a small ring and read back once they're ready
+// instead of stalling the pipeline waiting for them.
+
+// percentile summary of a list of frame times (milliseconds)
+struct FrameStats
+{
+	double mean = 0.0;
+	double p50 = 0.0;
+	double p95 = 0.0;
+	double p99 = 0.0;
+	double max = 0.0;
+};
+
+// nearest-rank percentiles over the samples. Empty input gives all zeroes
+FrameStats ComputeStats(std::vector<double> samples);
+
+// extra information written next to the numbers so runs from different machines can be told apart
+struct BenchmarkInfo
+{
+	std::string backend;
+	std::string vendor;
+	std::string renderer;
+	std::string version;
+	int width = 0;
+	int height = 0;
+};
+
+// fills vendor/renderer/version from the current context
+void QueryContextInfo(BenchmarkInfo& info);
+
+// s escaped for the inside of a JSON string. Strings coming from the driver can contain anything, and the JSON
+// files (Benchmark::WriteJSON, gl_bench --json) have to stay valid
+std::string JsonEscape(const std::string& s);
+
+class Benchmark
+{
+public:
+	// warmup frames are rendered and timed but thrown away, so shader compiles and first-use costs don't skew the numbers
+	Benchmark(int warmupFrames, int measuredFrames);
+	~Benchmark();
+
+	Benchmark(const Benchmark&) = delete;
+	Benchmark& operator=(const Benchmark&) = delete;
+
+	// wrap everything that makes up one frame (including the swap) in these two calls
+	void BeginFrame();
+	void EndFrame();
+
+	// true once warmup + measured frames have all been rendered
+	bool Done() const { return frame >= warmupFrames + measuredFrames; }
+
+	// waits for the GPU queries that are still in flight. Call after the loop, before reading results
+	void Finish();
+
+	const std::vector<double>& CpuTimes() const { return cpuTimes; }
+	const std::vector<double>& GpuTimes() const { return gpuTimes; }
+
+	// human readable table
+	void Print(const BenchmarkInfo& info) const;
+	// one row per measured frame: frame,cpu_ms,gpu_ms
+	bool WriteCSV(const std::string& path) const;
+	// summary + every sample
+	bool WriteJSON(const std::string& path, const BenchmarkInfo& info) const;
+
+private:
+	// how many frames a query can stay in flight before we block on its result
+	static const int QueryCount = 4;
+
+	void CollectQuery(int slot);
+
+	int warmupFrames;
+	int measuredFrames;
+	int frame = 0;
+
+	GLuint queries[QueryCount] = {};
+	// which frame each query slot belongs to, -1 when the slot is empty
+	int queryFrame[QueryCount];
+
+	std::chrono::steady_clock::time_point frameStart;
+	std::vector<double> cpuTimes;
+	std::vector<double> gpuTimes;
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include"EBO.h"
+
+EBO::EBO(const void* indices, GLsizeiptr size, GLenum usage)
+{
+	glGenBuffers(1, &ID);
+
+	// same as a VBO, but bound as GL_ELEMENT_ARRAY_BUFFER. If a VAO is bound right now, it remembers this EBO
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ID);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, indices, usage);
+}
+
+EBO& EBO::operator=(EBO&& other) noexcept
+{
+	if (this != &other)
+	{
+		Delete();
+		ID = other.ID;
+		other.ID = 0;
+	}
+	return *this;
+}
+
+void EBO::Bind() const
+{
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ID);
+}
+
+void EBO::Unbind() const
+{
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void EBO::Delete()
+{
+	if (ID != 0)
+	{
+		glDeleteBuffers(1, &ID);
+		ID = 0;
+	}
+}
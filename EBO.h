@@ -0,0 +1,35 @@
+#ifndef EBO_CLASS_H
+#define EBO_CLASS_H
+
+#include<glad/glad.h>
+
+// Element Buffer Object: stores the INDICES that say which vertices make up each triangle,
+// so a vertex shared by several triangles is only stored (and shaded) once. Move-only handle, see VBO.h
+class EBO
+{
+public:
+	// ID reference of the Element Buffer Object, 0 = none
+	GLuint ID = 0;
+
+	// empty handle, owns nothing
+	EBO() {}
+	// generates a buffer and uploads size bytes of indices into it
+	EBO(const void* indices, GLsizeiptr size, GLenum usage = GL_STATIC_DRAW);
+	~EBO() { Delete(); }
+
+	EBO(const EBO&) = delete;
+	EBO& operator=(const EBO&) = delete;
+	EBO(EBO&& other) noexcept : ID(other.ID) { other.ID = 0; }
+	EBO& operator=(EBO&& other) noexcept;
+
+	// binds it to GL_ELEMENT_ARRAY_BUFFER. The binding is stored IN the currently bound VAO, so bind the VAO first
+	void Bind() const;
+	// binds 0 to GL_ELEMENT_ARRAY_BUFFER. Unbind the VAO FIRST, otherwise the VAO forgets its EBO
+	void Unbind() const;
+	// deletes the buffer now instead of waiting for the destructor (e.g. before the context goes away)
+	void Delete();
+};
+
+static_assert(sizeof(EBO) == sizeof(GLuint), "EBO must stay a bare handle");
+
+#endif
@@ -0,0 +1,108 @@
+#include"FrameDumper.h"
+
+#include<chrono>
+#include<cstdio>
+#include<cstring>
+#include<filesystem>
+#include<iostream>
+
+FrameDumper::FrameDumper(const std::string& directory, ImageFormat format, int width, int height,
+	int threads, int queueLimit, bool dropWhenFull)
+	: directory(directory), format(format), width(width), height(height),
+	queueLimit(queueLimit > 0 ? queueLimit : 1), dropWhenFull(dropWhenFull), pool(threads)
+{
+	std::error_code error;
+	std::filesystem::create_directories(directory, error);
+	ready = std::filesystem::is_directory(directory, error);
+	if (!ready)
+		std::cout << "Can't create frame directory " << directory << std::endl;
+}
+
+FrameDumper::~FrameDumper()
+{
+	Finish();
+	for (std::vector<unsigned char>* buffer : allBuffers)
+		delete buffer;
+}
+
+void FrameDumper::Submit(const unsigned char* rgba, int frame)
+{
+	if (!ready)
+		return;
+
+	std::vector<unsigned char>* pixels;
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		submitted++;
+		if (inFlight >= queueLimit)
+		{
+			if (dropWhenFull)
+			{
+				dropped++;
+				return;
+			}
+			auto start = std::chrono::steady_clock::now();
+			frameDone.wait(lock, [this] { return inFlight < queueLimit; });
+			blockedMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		inFlight++;
+		if (inFlight > maxInFlight)
+			maxInFlight = inFlight;
+		if (freeBuffers.empty())
+		{
+			allBuffers.push_back(new std::vector<unsigned char>((size_t)width * height * 4));
+			freeBuffers.push_back(allBuffers.back());
+		}
+		pixels = freeBuffers.back();
+		freeBuffers.pop_back();
+	}
+
+	// the copy is the only part the render thread pays for (the readback's pointer is gone after this call)
+	std::memcpy(pixels->data(), rgba, pixels->size());
+	pool.Enqueue([this, pixels, frame] { Write(pixels, frame); });
+}
+
+void FrameDumper::Write(std::vector<unsigned char>* pixels, int frame)
+{
+	char name[32];
+	std::snprintf(name, sizeof(name), "frame_%06d.%s", frame, ImageExtension(format));
+	std::string path = (std::filesystem::path(directory) / name).string();
+
+	auto start = std::chrono::steady_clock::now();
+	bool ok = WriteImage(path, format, pixels->data(), width, height);
+	double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	std::error_code error;
+	uintmax_t size = ok ? std::filesystem::file_size(path, error) : 0;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (ok)
+			written++;
+		else
+			failed++;
+		bytesWritten += error ? 0 : (size_t)size;
+		encodeMs += ms;
+		freeBuffers.push_back(pixels);
+		inFlight--;
+	}
+	frameDone.notify_one();
+}
+
+void FrameDumper::Finish()
+{
+	pool.Wait();
+}
+
+void FrameDumper::PrintReport() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	std::printf("frame dump: %d frames submitted, %d written (%s), %d dropped, %d failed to %s\n", submitted, written,
+		ImageExtension(format), dropped, failed, directory.c_str());
+	std::printf("  %d worker threads, queue limit %d (max %d in flight), render thread blocked %.2f ms in total\n",
+		pool.Threads(), queueLimit, maxInFlight, blockedMs);
+	if (written > 0)
+		std::printf("  %.2f ms per frame to encode + write (on the workers), %.1f KB per frame\n",
+			encodeMs / written, bytesWritten / 1024.0 / written);
+}
@@ -0,0 +1,72 @@
+#ifndef FRAME_DUMPER_CLASS_H
+#define FRAME_DUMPER_CLASS_H
+
+#include<condition_variable>
+#include<mutex>
+#include<string>
+#include<vector>
+#include"ImageWriter.h"
+#include"ThreadPool.h"
+
+// * NOTE: writes every frame the Readback delivers to <directory>/frame_000000.<ext>.
+// The render thread only copies the pixels; encoding and writing happen on a thread pool, so a slow PNG encode
+// or a slow disk doesn't hold up rendering... up to a point. At most queueLimit frames can be waiting or being
+// written at once (their pixel buffers are reused), and when that many are in flight Submit either:
+//   blocks until a worker is done (back-pressure: every frame gets written, the render loop slows down to disk speed)
+//   drops the frame (the render loop never waits, frames go missing). Counted in the report
+class FrameDumper
+{
+public:
+	// threads = 0: one per hardware thread
+	FrameDumper(const std::string& directory, ImageFormat format, int width, int height,
+		int threads, int queueLimit, bool dropWhenFull);
+	// waits for every queued frame
+	~FrameDumper();
+
+	FrameDumper(const FrameDumper&) = delete;
+	FrameDumper& operator=(const FrameDumper&) = delete;
+
+	// false if the directory can't be created
+	bool Ready() const { return ready; }
+
+	// copies the frame (RGBA8, bottom row first) and queues it for writing. Meant as the Readback's FrameSink
+	void Submit(const unsigned char* rgba, int frame);
+
+	// blocks until everything submitted so far is on disk
+	void Finish();
+
+	void PrintReport() const;
+
+private:
+	void Write(std::vector<unsigned char>* pixels, int frame);
+
+	std::string directory;
+	ImageFormat format;
+	int width;
+	int height;
+	int queueLimit;
+	bool dropWhenFull;
+	bool ready = false;
+
+	ThreadPool pool;
+
+	// everything below is shared with the workers
+	mutable std::mutex mutex;
+	std::condition_variable frameDone;
+	// pixel buffers that aren't in use, so frames don't allocate
+	std::vector<std::vector<unsigned char>*> freeBuffers;
+	std::vector<std::vector<unsigned char>*> allBuffers;
+	int inFlight = 0;
+
+	int submitted = 0;
+	int written = 0;
+	int dropped = 0;
+	int failed = 0;
+	int maxInFlight = 0;
+	// how long the render thread waited for room in the queue
+	double blockedMs = 0.0;
+	size_t bytesWritten = 0;
+	double encodeMs = 0.0;
+};
+
+#endif
@@ -0,0 +1,814 @@
+#include"GLCapture.h"
+
+#include<cstdio>
+#include<cstring>
+#include<iostream>
+#include<unordered_map>
+#include<vector>
+#include<glad/glad.h>
+#include"GLCaptureFormat.h"
+
+// every function that gets a hook. X(Name) for glName
+#define CAPTURE_FUNCTIONS(X) \
+	X(Viewport) X(ClearColor) X(Clear) X(Enable) X(Disable) X(BlendFunc) X(DepthFunc) X(DepthMask) X(Flush) X(Finish) \
+	X(GenBuffers) X(DeleteBuffers) X(BindBuffer) X(BufferData) X(BufferSubData) X(BufferStorage) X(MapBufferRange) X(UnmapBuffer) \
+	X(GenVertexArrays) X(DeleteVertexArrays) X(BindVertexArray) X(VertexAttribPointer) X(EnableVertexAttribArray) \
+	X(VertexAttribDivisor) X(VertexAttrib4f) X(VertexAttrib4fv) \
+	X(GenTextures) X(DeleteTextures) X(BindTexture) X(ActiveTexture) X(TexImage2D) X(TexParameteri) \
+	X(GenFramebuffers) X(DeleteFramebuffers) X(BindFramebuffer) X(GenRenderbuffers) X(DeleteRenderbuffers) \
+	X(BindRenderbuffer) X(RenderbufferStorage) X(FramebufferRenderbuffer) \
+	X(CreateShader) X(ShaderSource) X(CompileShader) X(DeleteShader) X(CreateProgram) X(AttachShader) X(DetachShader) \
+	X(LinkProgram) X(DeleteProgram) X(UseProgram) X(ProgramParameteri) X(ProgramBinary) X(GetProgramiv) X(GetShaderiv) \
+	X(GetUniformLocation) X(Uniform4fv) X(MaxShaderCompilerThreadsKHR) \
+	X(DrawArrays) X(DrawElements) X(DrawArraysInstanced) X(DrawElementsInstanced) \
+	X(GenQueries) X(DeleteQueries) X(BeginQuery) X(EndQuery) X(GetQueryObjectui64v) \
+	X(FenceSync) X(ClientWaitSync) X(DeleteSync) \
+	X(ReadPixels)
+
+// the real functions, called by the hooks (glName itself points at the hook while capturing)
+#define CAPTURE_DECLARE_REAL(name) static decltype(glad_gl##name) real##name = nullptr;
+CAPTURE_FUNCTIONS(CAPTURE_DECLARE_REAL)
+
+// collects records in memory and writes them out in big chunks
+class CaptureWriter
+{
+public:
+	explicit CaptureWriter(FILE* file) : file(file) {}
+	~CaptureWriter()
+	{
+		FlushToFile();
+		std::fclose(file);
+	}
+
+	void Begin(CaptureOp op)
+	{
+		recordStart = buffer.size();
+		Put((uint16_t)op);
+		Put((uint32_t)0); // size, patched in End
+	}
+
+	template<typename T>
+	void Put(T value)
+	{
+		const char* bytes = (const char*)&value;
+		buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+	}
+
+	void PutBytes(const void* data, size_t size)
+	{
+		Put((uint32_t)size);
+		buffer.insert(buffer.end(), (const char*)data, (const char*)data + size);
+	}
+
+	void End()
+	{
+		uint32_t size = (uint32_t)(buffer.size() - recordStart - sizeof(uint16_t) - sizeof(uint32_t));
+		std::memcpy(&buffer[recordStart + sizeof(uint16_t)], &size, sizeof(size));
+		stats.calls++;
+		if (buffer.size() >= (1 << 20))
+			FlushToFile();
+	}
+
+	void FlushToFile()
+	{
+		if (!buffer.empty())
+			std::fwrite(buffer.data(), 1, buffer.size(), file);
+		stats.bytes += buffer.size();
+		buffer.clear();
+	}
+
+	// bytes still waiting in memory
+	size_t Buffered() const { return buffer.size(); }
+
+	CaptureStats stats;
+
+	// what the hooks need to know about GL state to find the data of a call
+	std::unordered_map<GLenum, GLuint> boundBuffers;
+	struct Mapping
+	{
+		void* data;
+		GLsizeiptr length;
+		GLbitfield access;
+	};
+	std::unordered_map<GLuint, Mapping> mappings;
+	std::unordered_map<GLsync, uint64_t> syncs;
+	uint64_t nextSync = 1;
+
+private:
+	FILE* file;
+	std::vector<char> buffer;
+	size_t recordStart = 0;
+};
+
+static CaptureWriter* writer = nullptr;
+
+// bytes glTexImage2D reads for an image, with the default GL_UNPACK_ALIGNMENT of 4
+static size_t ImageBytes(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+	size_t components;
+	switch (format)
+	{
+	case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: case GL_DEPTH_STENCIL:
+		components = 1; break;
+	case GL_RG: case GL_RG_INTEGER:
+		components = 2; break;
+	case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+		components = 3; break;
+	default:
+		components = 4; break;
+	}
+
+	size_t pixel;
+	switch (type)
+	{
+	case GL_UNSIGNED_BYTE: case GL_BYTE:
+		pixel = components; break;
+	case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+		pixel = components * 2; break;
+	case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_5_5_5_1:
+		pixel = 2; break;
+	case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+	case GL_UNSIGNED_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+		pixel = 4; break;
+	default: // (unsigned) int, float
+		pixel = components * 4; break;
+	}
+
+	if (width <= 0 || height <= 0)
+		return 0;
+	size_t row = (width * pixel + 3) / 4 * 4;
+	return row * (height - 1) + width * pixel;
+}
+
+static void APIENTRY HookViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	writer->Begin(CaptureOp::Viewport);
+	writer->Put(x); writer->Put(y); writer->Put(width); writer->Put(height);
+	writer->End();
+	realViewport(x, y, width, height);
+}
+
+static void APIENTRY HookClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+	writer->Begin(CaptureOp::ClearColor);
+	writer->Put(r); writer->Put(g); writer->Put(b); writer->Put(a);
+	writer->End();
+	realClearColor(r, g, b, a);
+}
+
+static void APIENTRY HookClear(GLbitfield mask)
+{
+	writer->Begin(CaptureOp::Clear);
+	writer->Put(mask);
+	writer->End();
+	realClear(mask);
+}
+
+static void APIENTRY HookEnable(GLenum cap)
+{
+	writer->Begin(CaptureOp::Enable);
+	writer->Put(cap);
+	writer->End();
+	realEnable(cap);
+}
+
+static void APIENTRY HookDisable(GLenum cap)
+{
+	writer->Begin(CaptureOp::Disable);
+	writer->Put(cap);
+	writer->End();
+	realDisable(cap);
+}
+
+static void APIENTRY HookBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	writer->Begin(CaptureOp::BlendFunc);
+	writer->Put(sfactor); writer->Put(dfactor);
+	writer->End();
+	realBlendFunc(sfactor, dfactor);
+}
+
+static void APIENTRY HookDepthFunc(GLenum func)
+{
+	writer->Begin(CaptureOp::DepthFunc);
+	writer->Put(func);
+	writer->End();
+	realDepthFunc(func);
+}
+
+static void APIENTRY HookDepthMask(GLboolean flag)
+{
+	writer->Begin(CaptureOp::DepthMask);
+	writer->Put(flag);
+	writer->End();
+	realDepthMask(flag);
+}
+
+static void APIENTRY HookFlush()
+{
+	writer->Begin(CaptureOp::Flush);
+	writer->End();
+	realFlush();
+}
+
+static void APIENTRY HookFinish()
+{
+	writer->Begin(CaptureOp::Finish);
+	writer->End();
+	realFinish();
+}
+
+// glGen* and glDelete* all look the same: a count and an array of names
+static void RecordNames(CaptureOp op, GLsizei n, const GLuint* names)
+{
+	writer->Begin(op);
+	writer->Put(n);
+	for (GLsizei i = 0; i < n; i++)
+		writer->Put(names[i]);
+	writer->End();
+}
+
+static void APIENTRY HookGenBuffers(GLsizei n, GLuint* buffers)
+{
+	realGenBuffers(n, buffers);
+	RecordNames(CaptureOp::GenBuffers, n, buffers);
+}
+
+static void APIENTRY HookDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+	RecordNames(CaptureOp::DeleteBuffers, n, buffers);
+	realDeleteBuffers(n, buffers);
+}
+
+static void APIENTRY HookBindBuffer(GLenum target, GLuint buffer)
+{
+	writer->Begin(CaptureOp::BindBuffer);
+	writer->Put(target); writer->Put(buffer);
+	writer->End();
+	writer->boundBuffers[target] = buffer;
+	realBindBuffer(target, buffer);
+}
+
+static void APIENTRY HookBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+	writer->Begin(CaptureOp::BufferData);
+	writer->Put(target); writer->Put((int64_t)size); writer->Put(usage);
+	writer->Put((uint8_t)(data != nullptr));
+	if (data != nullptr)
+		writer->PutBytes(data, (size_t)size);
+	writer->End();
+	realBufferData(target, size, data, usage);
+}
+
+static void APIENTRY HookBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+	writer->Begin(CaptureOp::BufferSubData);
+	writer->Put(target); writer->Put((int64_t)offset);
+	writer->PutBytes(data, (size_t)size);
+	writer->End();
+	realBufferSubData(target, offset, size, data);
+}
+
+static void APIENTRY HookBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)
+{
+	writer->Begin(CaptureOp::BufferStorage);
+	writer->Put(target); writer->Put((int64_t)size); writer->Put(flags);
+	writer->Put((uint8_t)(data != nullptr));
+	if (data != nullptr)
+		writer->PutBytes(data, (size_t)size);
+	writer->End();
+	realBufferStorage(target, size, data, flags);
+}
+
+static void* APIENTRY HookMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	void* data = realMapBufferRange(target, offset, length, access);
+	writer->Begin(CaptureOp::MapBufferRange);
+	writer->Put(target); writer->Put((int64_t)offset); writer->Put((int64_t)length); writer->Put(access);
+	writer->End();
+	// mappings belong to the buffer, not the target: it may be bound somewhere else by the time it's unmapped
+	if (data != nullptr)
+		writer->mappings[writer->boundBuffers[target]] = { data, length, access };
+	return data;
+}
+
+static GLboolean APIENTRY HookUnmapBuffer(GLenum target)
+{
+	// whatever was written through the mapping, so the replayer can write the same bytes
+	writer->Begin(CaptureOp::UnmapBuffer);
+	writer->Put(target);
+	auto mapping = writer->mappings.find(writer->boundBuffers[target]);
+	if (mapping != writer->mappings.end() && (mapping->second.access & GL_MAP_WRITE_BIT))
+		writer->PutBytes(mapping->second.data, (size_t)mapping->second.length);
+	else
+		writer->PutBytes(nullptr, 0);
+	writer->End();
+	if (mapping != writer->mappings.end())
+		writer->mappings.erase(mapping);
+	return realUnmapBuffer(target);
+}
+
+static void APIENTRY HookGenVertexArrays(GLsizei n, GLuint* arrays)
+{
+	realGenVertexArrays(n, arrays);
+	RecordNames(CaptureOp::GenVertexArrays, n, arrays);
+}
+
+static void APIENTRY HookDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+	RecordNames(CaptureOp::DeleteVertexArrays, n, arrays);
+	realDeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY HookBindVertexArray(GLuint array)
+{
+	writer->Begin(CaptureOp::BindVertexArray);
+	writer->Put(array);
+	writer->End();
+	realBindVertexArray(array);
+}
+
+static void APIENTRY HookVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+{
+	// core profile: the pointer is an offset into the bound GL_ARRAY_BUFFER
+	writer->Begin(CaptureOp::VertexAttribPointer);
+	writer->Put(index); writer->Put(size); writer->Put(type); writer->Put(normalized); writer->Put(stride);
+	writer->Put((uint64_t)(uintptr_t)pointer);
+	writer->End();
+	realVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY HookEnableVertexAttribArray(GLuint index)
+{
+	writer->Begin(CaptureOp::EnableVertexAttribArray);
+	writer->Put(index);
+	writer->End();
+	realEnableVertexAttribArray(index);
+}
+
+static void APIENTRY HookVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+	writer->Begin(CaptureOp::VertexAttribDivisor);
+	writer->Put(index); writer->Put(divisor);
+	writer->End();
+	realVertexAttribDivisor(index, divisor);
+}
+
+static void APIENTRY HookVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+	writer->Begin(CaptureOp::VertexAttrib4f);
+	writer->Put(index); writer->Put(x); writer->Put(y); writer->Put(z); writer->Put(w);
+	writer->End();
+	realVertexAttrib4f(index, x, y, z, w);
+}
+
+static void APIENTRY HookVertexAttrib4fv(GLuint index, const GLfloat* v)
+{
+	writer->Begin(CaptureOp::VertexAttrib4fv);
+	writer->Put(index); writer->Put(v[0]); writer->Put(v[1]); writer->Put(v[2]); writer->Put(v[3]);
+	writer->End();
+	realVertexAttrib4fv(index, v);
+}
+
+static void APIENTRY HookGenTextures(GLsizei n, GLuint* textures)
+{
+	realGenTextures(n, textures);
+	RecordNames(CaptureOp::GenTextures, n, textures);
+}
+
+static void APIENTRY HookDeleteTextures(GLsizei n, const GLuint* textures)
+{
+	RecordNames(CaptureOp::DeleteTextures, n, textures);
+	realDeleteTextures(n, textures);
+}
+
+static void APIENTRY HookBindTexture(GLenum target, GLuint texture)
+{
+	writer->Begin(CaptureOp::BindTexture);
+	writer->Put(target); writer->Put(texture);
+	writer->End();
+	realBindTexture(target, texture);
+}
+
+static void APIENTRY HookActiveTexture(GLenum texture)
+{
+	writer->Begin(CaptureOp::ActiveTexture);
+	writer->Put(texture);
+	writer->End();
+	realActiveTexture(texture);
+}
+
+static void APIENTRY HookTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+	GLint border, GLenum format, GLenum type, const void* pixels)
+{
+	writer->Begin(CaptureOp::TexImage2D);
+	writer->Put(target); writer->Put(level); writer->Put(internalformat); writer->Put(width); writer->Put(height);
+	writer->Put(border); writer->Put(format); writer->Put(type);
+	// 0 = no data, 1 = pixels follow, 2 = offset into the bound GL_PIXEL_UNPACK_BUFFER
+	if (writer->boundBuffers[GL_PIXEL_UNPACK_BUFFER] != 0)
+	{
+		writer->Put((uint8_t)2);
+		writer->Put((uint64_t)(uintptr_t)pixels);
+	}
+	else
+	{
+		writer->Put((uint8_t)(pixels != nullptr));
+		if (pixels != nullptr)
+			writer->PutBytes(pixels, ImageBytes(width, height, format, type));
+	}
+	writer->End();
+	realTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY HookReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)
+{
+	// what comes back isn't needed to replay anything, only where it goes: the replayer reads the same frame.
+	// 1 = offset into the bound GL_PIXEL_PACK_BUFFER, 0 = client memory of this many bytes
+	writer->Begin(CaptureOp::ReadPixels);
+	writer->Put(x); writer->Put(y); writer->Put(width); writer->Put(height); writer->Put(format); writer->Put(type);
+	if (writer->boundBuffers[GL_PIXEL_PACK_BUFFER] != 0)
+	{
+		writer->Put((uint8_t)1);
+		writer->Put((uint64_t)(uintptr_t)pixels);
+	}
+	else
+	{
+		writer->Put((uint8_t)0);
+		writer->Put((uint64_t)ImageBytes(width, height, format, type));
+	}
+	writer->End();
+	realReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static void APIENTRY HookTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+	writer->Begin(CaptureOp::TexParameteri);
+	writer->Put(target); writer->Put(pname); writer->Put(param);
+	writer->End();
+	realTexParameteri(target, pname, param);
+}
+
+static void APIENTRY HookGenFramebuffers(GLsizei n, GLuint* framebuffers)
+{
+	realGenFramebuffers(n, framebuffers);
+	RecordNames(CaptureOp::GenFramebuffers, n, framebuffers);
+}
+
+static void APIENTRY HookDeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
+{
+	RecordNames(CaptureOp::DeleteFramebuffers, n, framebuffers);
+	realDeleteFramebuffers(n, framebuffers);
+}
+
+static void APIENTRY HookBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+	writer->Begin(CaptureOp::BindFramebuffer);
+	writer->Put(target); writer->Put(framebuffer);
+	writer->End();
+	realBindFramebuffer(target, framebuffer);
+}
+
+static void APIENTRY HookGenRenderbuffers(GLsizei n, GLuint* renderbuffers)
+{
+	realGenRenderbuffers(n, renderbuffers);
+	RecordNames(CaptureOp::GenRenderbuffers, n, renderbuffers);
+}
+
+static void APIENTRY HookDeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
+{
+	RecordNames(CaptureOp::DeleteRenderbuffers, n, renderbuffers);
+	realDeleteRenderbuffers(n, renderbuffers);
+}
+
+static void APIENTRY HookBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+	writer->Begin(CaptureOp::BindRenderbuffer);
+	writer->Put(target); writer->Put(renderbuffer);
+	writer->End();
+	realBindRenderbuffer(target, renderbuffer);
+}
+
+static void APIENTRY HookRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+	writer->Begin(CaptureOp::RenderbufferStorage);
+	writer->Put(target); writer->Put(internalformat); writer->Put(width); writer->Put(height);
+	writer->End();
+	realRenderbufferStorage(target, internalformat, width, height);
+}
+
+static void APIENTRY HookFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+	writer->Begin(CaptureOp::FramebufferRenderbuffer);
+	writer->Put(target); writer->Put(attachment); writer->Put(renderbuffertarget); writer->Put(renderbuffer);
+	writer->End();
+	realFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static GLuint APIENTRY HookCreateShader(GLenum type)
+{
+	GLuint shader = realCreateShader(type);
+	writer->Begin(CaptureOp::CreateShader);
+	writer->Put(type); writer->Put(shader);
+	writer->End();
+	return shader;
+}
+
+static void APIENTRY HookShaderSource(GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths)
+{
+	writer->Begin(CaptureOp::ShaderSource);
+	writer->Put(shader); writer->Put(count);
+	for (GLsizei i = 0; i < count; i++)
+	{
+		size_t length = lengths != nullptr && lengths[i] >= 0 ? (size_t)lengths[i] : std::strlen(strings[i]);
+		writer->PutBytes(strings[i], length);
+	}
+	writer->End();
+	realShaderSource(shader, count, strings, lengths);
+}
+
+static void APIENTRY HookCompileShader(GLuint shader)
+{
+	writer->Begin(CaptureOp::CompileShader);
+	writer->Put(shader);
+	writer->End();
+	realCompileShader(shader);
+}
+
+static void APIENTRY HookDeleteShader(GLuint shader)
+{
+	writer->Begin(CaptureOp::DeleteShader);
+	writer->Put(shader);
+	writer->End();
+	realDeleteShader(shader);
+}
+
+static GLuint APIENTRY HookCreateProgram()
+{
+	GLuint program = realCreateProgram();
+	writer->Begin(CaptureOp::CreateProgram);
+	writer->Put(program);
+	writer->End();
+	return program;
+}
+
+static void APIENTRY HookAttachShader(GLuint program, GLuint shader)
+{
+	writer->Begin(CaptureOp::AttachShader);
+	writer->Put(program); writer->Put(shader);
+	writer->End();
+	realAttachShader(program, shader);
+}
+
+static void APIENTRY HookDetachShader(GLuint program, GLuint shader)
+{
+	writer->Begin(CaptureOp::DetachShader);
+	writer->Put(program); writer->Put(shader);
+	writer->End();
+	realDetachShader(program, shader);
+}
+
+static void APIENTRY HookLinkProgram(GLuint program)
+{
+	writer->Begin(CaptureOp::LinkProgram);
+	writer->Put(program);
+	writer->End();
+	realLinkProgram(program);
+}
+
+static void APIENTRY HookDeleteProgram(GLuint program)
+{
+	writer->Begin(CaptureOp::DeleteProgram);
+	writer->Put(program);
+	writer->End();
+	realDeleteProgram(program);
+}
+
+static void APIENTRY HookUseProgram(GLuint program)
+{
+	writer->Begin(CaptureOp::UseProgram);
+	writer->Put(program);
+	writer->End();
+	realUseProgram(program);
+}
+
+static void APIENTRY HookProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+	writer->Begin(CaptureOp::ProgramParameteri);
+	writer->Put(program); writer->Put(pname); writer->Put(value);
+	writer->End();
+	realProgramParameteri(program, pname, value);
+}
+
+static void APIENTRY HookProgramBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length)
+{
+	writer->Begin(CaptureOp::ProgramBinary);
+	writer->Put(program); writer->Put(binaryFormat);
+	writer->PutBytes(binary, (size_t)length);
+	writer->End();
+	realProgramBinary(program, binaryFormat, binary, length);
+}
+
+static void APIENTRY HookGetProgramiv(GLuint program, GLenum pname, GLint* params)
+{
+	writer->Begin(CaptureOp::GetProgramiv);
+	writer->Put(program); writer->Put(pname);
+	writer->End();
+	realGetProgramiv(program, pname, params);
+}
+
+static void APIENTRY HookGetShaderiv(GLuint shader, GLenum pname, GLint* params)
+{
+	writer->Begin(CaptureOp::GetShaderiv);
+	writer->Put(shader); writer->Put(pname);
+	writer->End();
+	realGetShaderiv(shader, pname, params);
+}
+
+static GLint APIENTRY HookGetUniformLocation(GLuint program, const GLchar* name)
+{
+	// the location is recorded so the replayer can map it to the location its own driver hands out
+	GLint location = realGetUniformLocation(program, name);
+	writer->Begin(CaptureOp::GetUniformLocation);
+	writer->Put(program);
+	writer->PutBytes(name, std::strlen(name));
+	writer->Put(location);
+	writer->End();
+	return location;
+}
+
+static void APIENTRY HookUniform4fv(GLint location, GLsizei count, const GLfloat* value)
+{
+	writer->Begin(CaptureOp::Uniform4fv);
+	writer->Put(location);
+	writer->PutBytes(value, (size_t)count * 4 * sizeof(GLfloat));
+	writer->End();
+	realUniform4fv(location, count, value);
+}
+
+static void APIENTRY HookMaxShaderCompilerThreadsKHR(GLuint count)
+{
+	writer->Begin(CaptureOp::MaxShaderCompilerThreadsKHR);
+	writer->Put(count);
+	writer->End();
+	realMaxShaderCompilerThreadsKHR(count);
+}
+
+static void APIENTRY HookDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	writer->Begin(CaptureOp::DrawArrays);
+	writer->Put(mode); writer->Put(first); writer->Put(count);
+	writer->End();
+	realDrawArrays(mode, first, count);
+}
+
+static void APIENTRY HookDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+	// core profile: indices is an offset into the VAO's element buffer
+	writer->Begin(CaptureOp::DrawElements);
+	writer->Put(mode); writer->Put(count); writer->Put(type); writer->Put((uint64_t)(uintptr_t)indices);
+	writer->End();
+	realDrawElements(mode, count, type, indices);
+}
+
+static void APIENTRY HookDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+	writer->Begin(CaptureOp::DrawArraysInstanced);
+	writer->Put(mode); writer->Put(first); writer->Put(count); writer->Put(instancecount);
+	writer->End();
+	realDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+static void APIENTRY HookDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount)
+{
+	writer->Begin(CaptureOp::DrawElementsInstanced);
+	writer->Put(mode); writer->Put(count); writer->Put(type); writer->Put((uint64_t)(uintptr_t)indices);
+	writer->Put(instancecount);
+	writer->End();
+	realDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+static void APIENTRY HookGenQueries(GLsizei n, GLuint* ids)
+{
+	realGenQueries(n, ids);
+	RecordNames(CaptureOp::GenQueries, n, ids);
+}
+
+static void APIENTRY HookDeleteQueries(GLsizei n, const GLuint* ids)
+{
+	RecordNames(CaptureOp::DeleteQueries, n, ids);
+	realDeleteQueries(n, ids);
+}
+
+static void APIENTRY HookBeginQuery(GLenum target, GLuint id)
+{
+	writer->Begin(CaptureOp::BeginQuery);
+	writer->Put(target); writer->Put(id);
+	writer->End();
+	realBeginQuery(target, id);
+}
+
+static void APIENTRY HookEndQuery(GLenum target)
+{
+	writer->Begin(CaptureOp::EndQuery);
+	writer->Put(target);
+	writer->End();
+	realEndQuery(target);
+}
+
+static void APIENTRY HookGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64* params)
+{
+	writer->Begin(CaptureOp::GetQueryObjectui64v);
+	writer->Put(id); writer->Put(pname);
+	writer->End();
+	realGetQueryObjectui64v(id, pname, params);
+}
+
+static GLsync APIENTRY HookFenceSync(GLenum condition, GLbitfield flags)
+{
+	GLsync sync = realFenceSync(condition, flags);
+	uint64_t id = writer->nextSync++;
+	writer->syncs[sync] = id;
+	writer->Begin(CaptureOp::FenceSync);
+	writer->Put(condition); writer->Put(flags); writer->Put(id);
+	writer->End();
+	return sync;
+}
+
+static GLenum APIENTRY HookClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	writer->Begin(CaptureOp::ClientWaitSync);
+	writer->Put(writer->syncs[sync]); writer->Put(flags); writer->Put((uint64_t)timeout);
+	writer->End();
+	return realClientWaitSync(sync, flags, timeout);
+}
+
+static void APIENTRY HookDeleteSync(GLsync sync)
+{
+	writer->Begin(CaptureOp::DeleteSync);
+	writer->Put(writer->syncs[sync]);
+	writer->End();
+	writer->syncs.erase(sync);
+	realDeleteSync(sync);
+}
+
+// glName is a macro for glad's pointer (or the current context's table in a GLAD_MX build), so it can be assigned to
+#define CAPTURE_HOOK(name) if (gl##name != nullptr) { real##name = gl##name; gl##name = Hook##name; }
+#define CAPTURE_UNHOOK(name) if (real##name != nullptr) { gl##name = real##name; real##name = nullptr; }
+
+bool StartCapture(const std::string& path, int width, int height, unsigned int framebuffer)
+{
+	if (writer != nullptr)
+		return false;
+
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (file == nullptr)
+	{
+		std::cout << "Can't create capture file " << path << std::endl;
+		return false;
+	}
+
+	CaptureFileHeader header;
+	std::memcpy(header.magic, CaptureMagic, sizeof(header.magic));
+	header.version = CaptureVersion;
+	header.width = (uint32_t)width;
+	header.height = (uint32_t)height;
+	header.framebuffer = framebuffer;
+	std::fwrite(&header, sizeof(header), 1, file);
+
+	writer = new CaptureWriter(file);
+	writer->stats.bytes = sizeof(header);
+	CAPTURE_FUNCTIONS(CAPTURE_HOOK)
+	return true;
+}
+
+void CaptureEndFrame()
+{
+	if (writer == nullptr)
+		return;
+	writer->Begin(CaptureOp::FrameEnd);
+	writer->End();
+	writer->stats.frames++;
+}
+
+void StopCapture()
+{
+	if (writer == nullptr)
+		return;
+	CAPTURE_FUNCTIONS(CAPTURE_UNHOOK)
+	delete writer;
+	writer = nullptr;
+}
+
+bool CaptureActive()
+{
+	return writer != nullptr;
+}
+
+CaptureStats GetCaptureStats()
+{
+	if (writer == nullptr)
+		return CaptureStats();
+	CaptureStats stats = writer->stats;
+	stats.bytes += writer->Buffered();
+	return stats;
+}
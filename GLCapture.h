@@ -0,0 +1,38 @@
+#ifndef GL_CAPTURE_CLASS_H
+#define GL_CAPTURE_CLASS_H
+
+#include<cstdint>
+#include<string>
+
+// * NOTE: the capture records the GL calls of a run into a file that gl_replay plays back (see GLCaptureFormat.h).
+// It works by swapping glad's function pointers for hooks: each hook writes the call and its data, then calls the
+// real function. Only the functions this program uses are hooked (the list is in GLCapture.cpp); calls to anything
+// else still work, they're just not in the file.
+//
+// ! things a capture can't see, so main.cpp turns them off while capturing:
+//   writes through a PERSISTENT mapping (no unmap tells us when or what was written) -> --no-persistent
+//   lazy glad trampolines replace themselves, including our hooks -> no --lazy-gl
+//   program binaries only load on the driver that made them -> no program binary cache
+
+struct CaptureStats
+{
+	uint64_t calls = 0;
+	uint64_t bytes = 0;
+	int frames = 0;
+};
+
+// hooks the current GL functions and starts writing to path. GL has to be loaded and the backend's targets created,
+// those belong to the backend and not the workload: width/height and its framebuffer are stored for the replayer instead.
+// Returns false if the file can't be created
+bool StartCapture(const std::string& path, int width, int height, unsigned int framebuffer);
+
+// writes the end-of-frame marker, the replayer times frames between them
+void CaptureEndFrame();
+
+// puts the original functions back and closes the file
+void StopCapture();
+
+bool CaptureActive();
+CaptureStats GetCaptureStats();
+
+#endif
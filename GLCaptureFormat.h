@@ -0,0 +1,117 @@
+#ifndef GL_CAPTURE_FORMAT_H
+#define GL_CAPTURE_FORMAT_H
+
+#include<cstdint>
+
+// * NOTE: layout of a capture file, shared by the recorder (GLCapture.cpp) and the replayer (GLReplay.cpp).
+//
+//   CaptureFileHeader
+//   record, record, ...     each record: uint16 op, uint32 size of what follows, then the arguments
+//
+// Arguments are written one after another in the order the GL function takes them, in the machine's byte order.
+// Integers keep their GL size except sizes/offsets (GLsizeiptr, GLintptr, pointers used as buffer offsets),
+// which are always 64-bit. Data the call reads from memory (buffer contents, shader sources, pixels) follows as
+// uint32 length + bytes. Object names are the names the CAPTURED run got; the replayer maps them to its own.
+
+static const char CaptureMagic[4] = { 'G', 'L', 'C', 'P' };
+static const uint32_t CaptureVersion = 1;
+
+struct CaptureFileHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t width;  // framebuffer size of the captured run
+	uint32_t height;
+	// what the backend rendered into (its framebuffer object, or 0 for a window). The replayer draws into its own
+	uint32_t framebuffer;
+};
+
+// one op per supported GL function, plus markers. New ops go at the END so old captures stay readable
+enum class CaptureOp : uint16_t
+{
+	FrameEnd = 1, // main.cpp finished a frame
+
+	Viewport,
+	ClearColor,
+	Clear,
+	Enable,
+	Disable,
+	BlendFunc,
+	DepthFunc,
+	DepthMask,
+	Flush,
+	Finish,
+
+	GenBuffers,
+	DeleteBuffers,
+	BindBuffer,
+	BufferData,
+	BufferSubData,
+	BufferStorage,
+	MapBufferRange,
+	UnmapBuffer,  // carries the bytes written through the mapping
+
+	GenVertexArrays,
+	DeleteVertexArrays,
+	BindVertexArray,
+	VertexAttribPointer,
+	EnableVertexAttribArray,
+	VertexAttribDivisor,
+	VertexAttrib4f,
+	VertexAttrib4fv,
+
+	GenTextures,
+	DeleteTextures,
+	BindTexture,
+	ActiveTexture,
+	TexImage2D,
+	TexParameteri,
+
+	GenFramebuffers,
+	DeleteFramebuffers,
+	BindFramebuffer,
+	GenRenderbuffers,
+	DeleteRenderbuffers,
+	BindRenderbuffer,
+	RenderbufferStorage,
+	FramebufferRenderbuffer,
+
+	CreateShader,
+	ShaderSource,
+	CompileShader,
+	DeleteShader,
+	CreateProgram,
+	AttachShader,
+	DetachShader,
+	LinkProgram,
+	DeleteProgram,
+	UseProgram,
+	ProgramParameteri,
+	ProgramBinary,
+	GetProgramiv,  // replayed because it waits for the compile/link, the result is thrown away
+	GetShaderiv,
+	GetUniformLocation,
+	Uniform4fv,
+	MaxShaderCompilerThreadsKHR,
+
+	DrawArrays,
+	DrawElements,
+	DrawArraysInstanced,
+	DrawElementsInstanced,
+
+	GenQueries,
+	DeleteQueries,
+	BeginQuery,
+	EndQuery,
+	GetQueryObjectui64v,
+
+	FenceSync,     // syncs are pointers, the file numbers them instead
+	ClientWaitSync,
+	DeleteSync,
+
+	ReadPixels,    // --readback/--dump: into the bound GL_PIXEL_PACK_BUFFER or client memory, the pixels aren't stored
+
+	Count
+};
+
+#endif
@@ -0,0 +1,691 @@
+#include"GLReplay.h"
+
+#include<chrono>
+#include<cstring>
+#include<fstream>
+#include<iostream>
+#include<iterator>
+#include"Benchmark.h"
+
+// reads the arguments of one record. Running past the end of the record marks it broken instead of reading garbage
+struct CaptureReader
+{
+	const char* at;
+	const char* end;
+	bool ok = true;
+
+	template<typename T>
+	T Get()
+	{
+		T value = T();
+		if ((size_t)(end - at) < sizeof(T))
+		{
+			ok = false;
+			return value;
+		}
+		std::memcpy(&value, at, sizeof(T));
+		at += sizeof(T);
+		return value;
+	}
+
+	// uint32 length + bytes. The pointer points into the file, nothing is copied
+	const char* GetBytes(uint32_t& size)
+	{
+		size = Get<uint32_t>();
+		if (!ok || (size_t)(end - at) < size)
+		{
+			ok = false;
+			size = 0;
+			return nullptr;
+		}
+		const char* bytes = at;
+		at += size;
+		return bytes;
+	}
+
+	// buffer offsets that GL takes as pointers
+	const void* GetOffset()
+	{
+		return (const void*)(uintptr_t)Get<uint64_t>();
+	}
+
+	// count + names, what glGen* and glDelete* records hold
+	std::vector<GLuint> GetNames()
+	{
+		GLsizei n = Get<GLsizei>();
+		std::vector<GLuint> names;
+		for (GLsizei i = 0; i < n && ok; i++)
+			names.push_back(Get<GLuint>());
+		return names;
+	}
+};
+
+// every record starts with these
+static const size_t RecordHeaderSize = sizeof(uint16_t) + sizeof(uint32_t);
+
+// glGen*: make as many real names and remember which captured name each one stands for
+static void GenNames(const std::vector<GLuint>& captured, std::unordered_map<GLuint, GLuint>& names, PFNGLGENBUFFERSPROC gen)
+{
+	std::vector<GLuint> real(captured.size());
+	gen((GLsizei)real.size(), real.data());
+	for (size_t i = 0; i < real.size(); i++)
+		names[captured[i]] = real[i];
+}
+
+// glDelete*: translate, delete, forget
+static void DeleteNames(const std::vector<GLuint>& captured, std::unordered_map<GLuint, GLuint>& names, PFNGLDELETEBUFFERSPROC del)
+{
+	std::vector<GLuint> real;
+	for (GLuint name : captured)
+	{
+		auto found = names.find(name);
+		real.push_back(found != names.end() ? found->second : name);
+		if (found != names.end())
+			names.erase(found);
+	}
+	del((GLsizei)real.size(), real.data());
+}
+
+bool GLReplayer::Load(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		std::cout << "Can't open capture " << path << std::endl;
+		return false;
+	}
+	data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+	if (data.size() < sizeof(header))
+	{
+		std::cout << path << " is too short to be a capture" << std::endl;
+		return false;
+	}
+	std::memcpy(&header, data.data(), sizeof(header));
+	if (std::memcmp(header.magic, CaptureMagic, sizeof(header.magic)) != 0 || header.version != CaptureVersion)
+	{
+		std::cout << path << " isn't a version " << CaptureVersion << " capture" << std::endl;
+		return false;
+	}
+
+	// walk the records once: checks every size fits in the file and finds the frame boundaries
+	size_t pos = sizeof(header);
+	loopBegin = loopEnd = 0;
+	while (pos < data.size())
+	{
+		uint16_t op;
+		uint32_t size;
+		if (data.size() - pos < RecordHeaderSize)
+			break;
+		std::memcpy(&op, &data[pos], sizeof(op));
+		std::memcpy(&size, &data[pos + sizeof(op)], sizeof(size));
+		pos += RecordHeaderSize;
+		if (data.size() - pos < size)
+			break;
+		pos += size;
+
+		if (op == (uint16_t)CaptureOp::FrameEnd)
+		{
+			if (loopBegin == 0)
+				loopBegin = pos;
+			loopEnd = pos;
+		}
+	}
+	if (pos != data.size())
+	{
+		std::cout << path << " ends in the middle of a record" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+GLuint GLReplayer::Real(const std::unordered_map<GLuint, GLuint>& names, GLuint captured) const
+{
+	if (captured == 0)
+		return 0;
+	auto found = names.find(captured);
+	// made outside the capture (or by a call that isn't recorded), the best guess is the same name
+	return found != names.end() ? found->second : captured;
+}
+
+bool GLReplayer::Play(int loops)
+{
+	auto start = std::chrono::steady_clock::now();
+	bool ok;
+	if (loopEnd == 0)
+	{
+		// no frame markers, just play everything once
+		ok = PlayRange(sizeof(header), data.size());
+	}
+	else
+	{
+		ok = PlayRange(sizeof(header), loopEnd);
+		for (int i = 1; i < loops && ok; i++)
+			ok = PlayRange(loopBegin, loopEnd);
+		ok = ok && PlayRange(loopEnd, data.size());
+	}
+
+	// same as main: without this we'd only be timing how fast commands get queued
+	glFinish();
+	totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return ok;
+}
+
+bool GLReplayer::PlayRange(size_t begin, size_t end)
+{
+	auto frameStart = std::chrono::steady_clock::now();
+	size_t pos = begin;
+	while (pos < end)
+	{
+		uint16_t op;
+		uint32_t size;
+		std::memcpy(&op, &data[pos], sizeof(op));
+		std::memcpy(&size, &data[pos + sizeof(op)], sizeof(size));
+		pos += RecordHeaderSize;
+
+		CaptureReader reader = { &data[0] + pos, &data[0] + pos + size };
+		pos += size;
+
+		if (op == (uint16_t)CaptureOp::FrameEnd)
+		{
+			auto now = std::chrono::steady_clock::now();
+			frameTimes.push_back(std::chrono::duration<double, std::milli>(now - frameStart).count());
+			frameStart = now;
+			continue;
+		}
+
+		if (!Execute((CaptureOp)op, reader) || !reader.ok)
+		{
+			std::cout << "Broken or unknown record (op " << op << ") at byte " << pos - size - RecordHeaderSize << std::endl;
+			return false;
+		}
+		calls++;
+	}
+	return true;
+}
+
+bool GLReplayer::Execute(CaptureOp op, CaptureReader& in)
+{
+	switch (op)
+	{
+	case CaptureOp::Viewport:
+	{
+		GLint x = in.Get<GLint>(), y = in.Get<GLint>();
+		GLsizei width = in.Get<GLsizei>(), height = in.Get<GLsizei>();
+		glViewport(x, y, width, height);
+		return true;
+	}
+	case CaptureOp::ClearColor:
+	{
+		GLfloat r = in.Get<GLfloat>(), g = in.Get<GLfloat>(), b = in.Get<GLfloat>(), a = in.Get<GLfloat>();
+		glClearColor(r, g, b, a);
+		return true;
+	}
+	case CaptureOp::Clear:
+		glClear(in.Get<GLbitfield>());
+		return true;
+	case CaptureOp::Enable:
+		glEnable(in.Get<GLenum>());
+		return true;
+	case CaptureOp::Disable:
+		glDisable(in.Get<GLenum>());
+		return true;
+	case CaptureOp::BlendFunc:
+	{
+		GLenum sfactor = in.Get<GLenum>(), dfactor = in.Get<GLenum>();
+		glBlendFunc(sfactor, dfactor);
+		return true;
+	}
+	case CaptureOp::DepthFunc:
+		glDepthFunc(in.Get<GLenum>());
+		return true;
+	case CaptureOp::DepthMask:
+		glDepthMask(in.Get<GLboolean>());
+		return true;
+	case CaptureOp::Flush:
+		glFlush();
+		return true;
+	case CaptureOp::Finish:
+		glFinish();
+		return true;
+
+	case CaptureOp::GenBuffers:
+		GenNames(in.GetNames(), buffers, glGenBuffers);
+		return true;
+	case CaptureOp::DeleteBuffers:
+		DeleteNames(in.GetNames(), buffers, glDeleteBuffers);
+		return true;
+	case CaptureOp::BindBuffer:
+	{
+		GLenum target = in.Get<GLenum>();
+		GLuint buffer = in.Get<GLuint>();
+		boundBuffers[target] = buffer;
+		glBindBuffer(target, Real(buffers, buffer));
+		return true;
+	}
+	case CaptureOp::BufferData:
+	case CaptureOp::BufferStorage:
+	{
+		GLenum target = in.Get<GLenum>();
+		GLsizeiptr size = (GLsizeiptr)in.Get<int64_t>();
+		GLenum usageOrFlags = in.Get<GLenum>();
+		uint32_t length = 0;
+		const char* bytes = in.Get<uint8_t>() ? in.GetBytes(length) : nullptr;
+		if (op == CaptureOp::BufferData)
+			glBufferData(target, size, bytes, usageOrFlags);
+		else if (glBufferStorage != nullptr)
+			glBufferStorage(target, size, bytes, usageOrFlags);
+		else
+		{
+			std::cout << "The capture uses glBufferStorage, this context doesn't have it" << std::endl;
+			return false;
+		}
+		return true;
+	}
+	case CaptureOp::BufferSubData:
+	{
+		GLenum target = in.Get<GLenum>();
+		GLintptr offset = (GLintptr)in.Get<int64_t>();
+		uint32_t length = 0;
+		const char* bytes = in.GetBytes(length);
+		glBufferSubData(target, offset, length, bytes);
+		return true;
+	}
+	case CaptureOp::MapBufferRange:
+	{
+		GLenum target = in.Get<GLenum>();
+		GLintptr offset = (GLintptr)in.Get<int64_t>();
+		GLsizeiptr length = (GLsizeiptr)in.Get<int64_t>();
+		GLbitfield access = in.Get<GLbitfield>();
+		void* mapped = glMapBufferRange(target, offset, length, access);
+		if (mapped != nullptr)
+			mappings[boundBuffers[target]] = mapped;
+		return true;
+	}
+	case CaptureOp::UnmapBuffer:
+	{
+		// the bytes the captured run wrote through its mapping go through ours
+		GLenum target = in.Get<GLenum>();
+		uint32_t length = 0;
+		const char* bytes = in.GetBytes(length);
+		auto mapping = mappings.find(boundBuffers[target]);
+		if (mapping != mappings.end())
+		{
+			if (length > 0)
+				std::memcpy(mapping->second, bytes, length);
+			mappings.erase(mapping);
+		}
+		glUnmapBuffer(target);
+		return true;
+	}
+
+	case CaptureOp::GenVertexArrays:
+		GenNames(in.GetNames(), vertexArrays, glGenVertexArrays);
+		return true;
+	case CaptureOp::DeleteVertexArrays:
+		DeleteNames(in.GetNames(), vertexArrays, glDeleteVertexArrays);
+		return true;
+	case CaptureOp::BindVertexArray:
+		glBindVertexArray(Real(vertexArrays, in.Get<GLuint>()));
+		return true;
+	case CaptureOp::VertexAttribPointer:
+	{
+		GLuint index = in.Get<GLuint>();
+		GLint size = in.Get<GLint>();
+		GLenum type = in.Get<GLenum>();
+		GLboolean normalized = in.Get<GLboolean>();
+		GLsizei stride = in.Get<GLsizei>();
+		const void* offset = in.GetOffset();
+		glVertexAttribPointer(index, size, type, normalized, stride, offset);
+		return true;
+	}
+	case CaptureOp::EnableVertexAttribArray:
+		glEnableVertexAttribArray(in.Get<GLuint>());
+		return true;
+	case CaptureOp::VertexAttribDivisor:
+	{
+		GLuint index = in.Get<GLuint>(), divisor = in.Get<GLuint>();
+		glVertexAttribDivisor(index, divisor);
+		return true;
+	}
+	case CaptureOp::VertexAttrib4f:
+	case CaptureOp::VertexAttrib4fv:
+	{
+		GLuint index = in.Get<GLuint>();
+		GLfloat v[4];
+		for (int i = 0; i < 4; i++)
+			v[i] = in.Get<GLfloat>();
+		glVertexAttrib4fv(index, v);
+		return true;
+	}
+
+	case CaptureOp::GenTextures:
+		GenNames(in.GetNames(), textures, glGenTextures);
+		return true;
+	case CaptureOp::DeleteTextures:
+		DeleteNames(in.GetNames(), textures, glDeleteTextures);
+		return true;
+	case CaptureOp::BindTexture:
+	{
+		GLenum target = in.Get<GLenum>();
+		glBindTexture(target, Real(textures, in.Get<GLuint>()));
+		return true;
+	}
+	case CaptureOp::ActiveTexture:
+		glActiveTexture(in.Get<GLenum>());
+		return true;
+	case CaptureOp::TexImage2D:
+	{
+		GLenum target = in.Get<GLenum>();
+		GLint level = in.Get<GLint>(), internalformat = in.Get<GLint>();
+		GLsizei width = in.Get<GLsizei>(), height = in.Get<GLsizei>();
+		GLint border = in.Get<GLint>();
+		GLenum format = in.Get<GLenum>(), type = in.Get<GLenum>();
+		const void* pixels = nullptr;
+		uint8_t source = in.Get<uint8_t>();
+		uint32_t length = 0;
+		if (source == 1)
+			pixels = in.GetBytes(length);
+		else if (source == 2)
+			pixels = in.GetOffset();
+		glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+		return true;
+	}
+	case CaptureOp::ReadPixels:
+	{
+		GLint x = in.Get<GLint>(), y = in.Get<GLint>();
+		GLsizei width = in.Get<GLsizei>(), height = in.Get<GLsizei>();
+		GLenum format = in.Get<GLenum>(), type = in.Get<GLenum>();
+		uint8_t toBuffer = in.Get<uint8_t>();
+		uint64_t offsetOrBytes = in.Get<uint64_t>();
+		if (toBuffer)
+			glReadPixels(x, y, width, height, format, type, (void*)(uintptr_t)offsetOrBytes);
+		else
+		{
+			// a sync read: it waits for the frame the same way, the pixels just land in scratch memory
+			readPixels.resize((size_t)offsetOrBytes);
+			glReadPixels(x, y, width, height, format, type, readPixels.data());
+		}
+		return true;
+	}
+	case CaptureOp::TexParameteri:
+	{
+		GLenum target = in.Get<GLenum>(), pname = in.Get<GLenum>();
+		GLint param = in.Get<GLint>();
+		glTexParameteri(target, pname, param);
+		return true;
+	}
+
+	case CaptureOp::GenFramebuffers:
+		GenNames(in.GetNames(), framebuffers, glGenFramebuffers);
+		return true;
+	case CaptureOp::DeleteFramebuffers:
+		DeleteNames(in.GetNames(), framebuffers, glDeleteFramebuffers);
+		return true;
+	case CaptureOp::BindFramebuffer:
+	{
+		GLenum target = in.Get<GLenum>();
+		GLuint framebuffer = in.Get<GLuint>();
+		bool backendTarget = framebuffer == 0 || framebuffer == header.framebuffer;
+		glBindFramebuffer(target, backendTarget ? defaultFramebuffer : Real(framebuffers, framebuffer));
+		return true;
+	}
+	case CaptureOp::GenRenderbuffers:
+		GenNames(in.GetNames(), renderbuffers, glGenRenderbuffers);
+		return true;
+	case CaptureOp::DeleteRenderbuffers:
+		DeleteNames(in.GetNames(), renderbuffers, glDeleteRenderbuffers);
+		return true;
+	case CaptureOp::BindRenderbuffer:
+	{
+		GLenum target = in.Get<GLenum>();
+		glBindRenderbuffer(target, Real(renderbuffers, in.Get<GLuint>()));
+		return true;
+	}
+	case CaptureOp::RenderbufferStorage:
+	{
+		GLenum target = in.Get<GLenum>(), internalformat = in.Get<GLenum>();
+		GLsizei width = in.Get<GLsizei>(), height = in.Get<GLsizei>();
+		glRenderbufferStorage(target, internalformat, width, height);
+		return true;
+	}
+	case CaptureOp::FramebufferRenderbuffer:
+	{
+		GLenum target = in.Get<GLenum>(), attachment = in.Get<GLenum>(), renderbuffertarget = in.Get<GLenum>();
+		glFramebufferRenderbuffer(target, attachment, renderbuffertarget, Real(renderbuffers, in.Get<GLuint>()));
+		return true;
+	}
+
+	case CaptureOp::CreateShader:
+	{
+		GLenum type = in.Get<GLenum>();
+		GLuint captured = in.Get<GLuint>();
+		shaders[captured] = glCreateShader(type);
+		return true;
+	}
+	case CaptureOp::ShaderSource:
+	{
+		GLuint shader = in.Get<GLuint>();
+		GLsizei count = in.Get<GLsizei>();
+		std::vector<const GLchar*> strings;
+		std::vector<GLint> lengths;
+		for (GLsizei i = 0; i < count && in.ok; i++)
+		{
+			uint32_t length = 0;
+			strings.push_back(in.GetBytes(length));
+			lengths.push_back((GLint)length);
+		}
+		glShaderSource(Real(shaders, shader), (GLsizei)strings.size(), strings.data(), lengths.data());
+		return true;
+	}
+	case CaptureOp::CompileShader:
+		glCompileShader(Real(shaders, in.Get<GLuint>()));
+		return true;
+	case CaptureOp::DeleteShader:
+	{
+		GLuint captured = in.Get<GLuint>();
+		glDeleteShader(Real(shaders, captured));
+		shaders.erase(captured);
+		return true;
+	}
+	case CaptureOp::CreateProgram:
+		programs[in.Get<GLuint>()] = glCreateProgram();
+		return true;
+	case CaptureOp::AttachShader:
+	case CaptureOp::DetachShader:
+	{
+		GLuint program = Real(programs, in.Get<GLuint>());
+		GLuint shader = Real(shaders, in.Get<GLuint>());
+		if (op == CaptureOp::AttachShader)
+			glAttachShader(program, shader);
+		else
+			glDetachShader(program, shader);
+		return true;
+	}
+	case CaptureOp::LinkProgram:
+		glLinkProgram(Real(programs, in.Get<GLuint>()));
+		return true;
+	case CaptureOp::DeleteProgram:
+	{
+		GLuint captured = in.Get<GLuint>();
+		glDeleteProgram(Real(programs, captured));
+		programs.erase(captured);
+		return true;
+	}
+	case CaptureOp::UseProgram:
+		currentProgram = in.Get<GLuint>();
+		glUseProgram(Real(programs, currentProgram));
+		return true;
+	case CaptureOp::ProgramParameteri:
+	{
+		GLuint program = Real(programs, in.Get<GLuint>());
+		GLenum pname = in.Get<GLenum>();
+		GLint value = in.Get<GLint>();
+		glProgramParameteri(program, pname, value);
+		return true;
+	}
+	case CaptureOp::ProgramBinary:
+	{
+		// only works on the driver that made the binary, main doesn't use the cache while capturing
+		GLuint program = Real(programs, in.Get<GLuint>());
+		GLenum format = in.Get<GLenum>();
+		uint32_t length = 0;
+		const char* binary = in.GetBytes(length);
+		glProgramBinary(program, format, binary, (GLsizei)length);
+		return true;
+	}
+	case CaptureOp::GetProgramiv:
+	case CaptureOp::GetShaderiv:
+	{
+		// the answer doesn't matter, the call is here because it waits for the compile or link like the captured run did
+		GLuint object = in.Get<GLuint>();
+		GLenum pname = in.Get<GLenum>();
+		GLint result = 0;
+		if (op == CaptureOp::GetProgramiv)
+			glGetProgramiv(Real(programs, object), pname, &result);
+		else
+			glGetShaderiv(Real(shaders, object), pname, &result);
+		return true;
+	}
+	case CaptureOp::GetUniformLocation:
+	{
+		GLuint program = in.Get<GLuint>();
+		uint32_t length = 0;
+		const char* bytes = in.GetBytes(length);
+		std::string name(bytes != nullptr ? bytes : "", length);
+		GLint captured = in.Get<GLint>();
+		uniforms[(uint64_t)program << 32 | (uint32_t)captured] = glGetUniformLocation(Real(programs, program), name.c_str());
+		return true;
+	}
+	case CaptureOp::Uniform4fv:
+	{
+		GLint captured = in.Get<GLint>();
+		uint32_t length = 0;
+		const GLfloat* values = (const GLfloat*)in.GetBytes(length);
+		auto found = uniforms.find((uint64_t)currentProgram << 32 | (uint32_t)captured);
+		GLint location = found != uniforms.end() ? found->second : captured;
+		// the bytes sit at any alignment inside the file, copy them before handing them to GL
+		std::vector<GLfloat> aligned(length / sizeof(GLfloat));
+		if (length > 0)
+			std::memcpy(aligned.data(), values, aligned.size() * sizeof(GLfloat));
+		glUniform4fv(location, (GLsizei)(aligned.size() / 4), aligned.data());
+		return true;
+	}
+	case CaptureOp::MaxShaderCompilerThreadsKHR:
+	{
+		GLuint count = in.Get<GLuint>();
+		if (glMaxShaderCompilerThreadsKHR != nullptr)
+			glMaxShaderCompilerThreadsKHR(count);
+		return true;
+	}
+
+	case CaptureOp::DrawArrays:
+	{
+		GLenum mode = in.Get<GLenum>();
+		GLint first = in.Get<GLint>();
+		GLsizei count = in.Get<GLsizei>();
+		glDrawArrays(mode, first, count);
+		return true;
+	}
+	case CaptureOp::DrawElements:
+	{
+		GLenum mode = in.Get<GLenum>();
+		GLsizei count = in.Get<GLsizei>();
+		GLenum type = in.Get<GLenum>();
+		const void* indices = in.GetOffset();
+		glDrawElements(mode, count, type, indices);
+		return true;
+	}
+	case CaptureOp::DrawArraysInstanced:
+	{
+		GLenum mode = in.Get<GLenum>();
+		GLint first = in.Get<GLint>();
+		GLsizei count = in.Get<GLsizei>(), instances = in.Get<GLsizei>();
+		glDrawArraysInstanced(mode, first, count, instances);
+		return true;
+	}
+	case CaptureOp::DrawElementsInstanced:
+	{
+		GLenum mode = in.Get<GLenum>();
+		GLsizei count = in.Get<GLsizei>();
+		GLenum type = in.Get<GLenum>();
+		const void* indices = in.GetOffset();
+		GLsizei instances = in.Get<GLsizei>();
+		glDrawElementsInstanced(mode, count, type, indices, instances);
+		return true;
+	}
+
+	case CaptureOp::GenQueries:
+		GenNames(in.GetNames(), queries, glGenQueries);
+		return true;
+	case CaptureOp::DeleteQueries:
+		DeleteNames(in.GetNames(), queries, glDeleteQueries);
+		return true;
+	case CaptureOp::BeginQuery:
+	{
+		GLenum target = in.Get<GLenum>();
+		glBeginQuery(target, Real(queries, in.Get<GLuint>()));
+		return true;
+	}
+	case CaptureOp::EndQuery:
+		glEndQuery(in.Get<GLenum>());
+		return true;
+	case CaptureOp::GetQueryObjectui64v:
+	{
+		GLuint query = Real(queries, in.Get<GLuint>());
+		GLenum pname = in.Get<GLenum>();
+		GLuint64 result = 0;
+		glGetQueryObjectui64v(query, pname, &result);
+		return true;
+	}
+
+	case CaptureOp::FenceSync:
+	{
+		GLenum condition = in.Get<GLenum>();
+		GLbitfield flags = in.Get<GLbitfield>();
+		syncs[in.Get<uint64_t>()] = glFenceSync(condition, flags);
+		return true;
+	}
+	case CaptureOp::ClientWaitSync:
+	{
+		auto sync = syncs.find(in.Get<uint64_t>());
+		GLbitfield flags = in.Get<GLbitfield>();
+		GLuint64 timeout = in.Get<uint64_t>();
+		if (sync != syncs.end())
+			glClientWaitSync(sync->second, flags, timeout);
+		return true;
+	}
+	case CaptureOp::DeleteSync:
+	{
+		auto sync = syncs.find(in.Get<uint64_t>());
+		if (sync != syncs.end())
+		{
+			glDeleteSync(sync->second);
+			syncs.erase(sync);
+		}
+		return true;
+	}
+
+	default:
+		return false;
+	}
+}
+
+void GLReplayer::PrintReport() const
+{
+	std::cout << "replay: " << calls << " GL calls, " << frameTimes.size() << " frames in " << totalSeconds << " s";
+	if (totalSeconds > 0.0)
+		std::cout << " (" << calls / totalSeconds << " calls/sec)";
+	std::cout << std::endl;
+	if (frameTimes.empty())
+		return;
+
+	// the first frame also creates everything (buffers, shader compiles), so it's kept out of the percentiles
+	std::cout << "  first frame (setup): " << frameTimes[0] << " ms" << std::endl;
+	if (frameTimes.size() > 1)
+	{
+		FrameStats stats = ComputeStats(std::vector<double>(frameTimes.begin() + 1, frameTimes.end()));
+		std::cout << "  other frames (CPU ms)  mean " << stats.mean << "  p50 " << stats.p50 << "  p95 " << stats.p95
+			<< "  p99 " << stats.p99 << "  max " << stats.max << std::endl;
+	}
+}
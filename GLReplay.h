@@ -0,0 +1,79 @@
+#ifndef GL_REPLAY_CLASS_H
+#define GL_REPLAY_CLASS_H
+
+#include<cstdint>
+#include<string>
+#include<unordered_map>
+#include<vector>
+#include<glad/glad.h>
+#include"GLCaptureFormat.h"
+
+struct CaptureReader;
+
+// * NOTE: plays a capture file (see GLCapture.h) back against the current context, without any of the program's
+// own code: no scenes, no state cache, no render queue, just the GL calls that reached the driver.
+// That makes it a way to time the DRIVER side of a run on its own, or to run the same workload on another machine.
+//
+// Object names in the file are the ones the captured run got. The replayer keeps a captured -> real table per
+// object type (the driver will usually hand out the same names, but nothing promises that), and the same for
+// uniform locations and syncs.
+class GLReplayer
+{
+public:
+	// reads the whole file into memory and checks the header. Prints why and returns false if it's not a capture
+	bool Load(const std::string& path);
+
+	int Width() const { return (int)header.width; }
+	int Height() const { return (int)header.height; }
+
+	// framebuffer that gets what the captured run drew into its backend's framebuffer (or window)
+	void SetDefaultFramebuffer(GLuint framebuffer) { defaultFramebuffer = framebuffer; }
+
+	// replays the file. The frames after the first one (the first one does the setup) are played
+	// loops times, then whatever came after the last frame (the cleanup). Per frame CPU times are kept
+	bool Play(int loops);
+
+	void PrintReport() const;
+
+private:
+	// plays one record, false when it's broken or an op this version doesn't know
+	bool Execute(CaptureOp op, CaptureReader& reader);
+	// plays records from begin to end, timing each frame
+	bool PlayRange(size_t begin, size_t end);
+
+	GLuint Real(const std::unordered_map<GLuint, GLuint>& names, GLuint captured) const;
+
+	CaptureFileHeader header = {};
+	std::vector<char> data;
+	// where the records between the first and the last frame end start and stop
+	size_t loopBegin = 0;
+	size_t loopEnd = 0;
+
+	GLuint defaultFramebuffer = 0;
+
+	// captured -> real
+	std::unordered_map<GLuint, GLuint> buffers;
+	std::unordered_map<GLuint, GLuint> vertexArrays;
+	std::unordered_map<GLuint, GLuint> textures;
+	std::unordered_map<GLuint, GLuint> framebuffers;
+	std::unordered_map<GLuint, GLuint> renderbuffers;
+	std::unordered_map<GLuint, GLuint> shaders;
+	std::unordered_map<GLuint, GLuint> programs;
+	std::unordered_map<GLuint, GLuint> queries;
+	// (captured program << 32 | captured location) -> real location
+	std::unordered_map<uint64_t, GLint> uniforms;
+	std::unordered_map<uint64_t, GLsync> syncs;
+
+	// the captured names of what's bound right now, to know which buffer a map/unmap is about
+	std::unordered_map<GLenum, GLuint> boundBuffers;
+	GLuint currentProgram = 0;
+	std::unordered_map<GLuint, void*> mappings;
+	// where client memory glReadPixels calls land
+	std::vector<unsigned char> readPixels;
+
+	uint64_t calls = 0;
+	std::vector<double> frameTimes;
+	double totalSeconds = 0.0;
+};
+
+#endif
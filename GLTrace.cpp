@@ -0,0 +1,47 @@
+#include"GLTrace.h"
+
+#ifdef GLAD_INSTRUMENT
+
+#include<algorithm>
+#include<cstdio>
+#include<vector>
+
+void GLTrace::Begin()
+{
+	gladTraceReset();
+	frames = 0;
+}
+
+void GLTrace::PrintReport() const
+{
+	if (frames == 0)
+		return;
+
+	const GladTraceEntry* entries = nullptr;
+	int count = gladTraceEntries(&entries);
+
+	// only what was actually called, slowest first
+	std::vector<const GladTraceEntry*> called;
+	unsigned long long totalCalls = 0, totalNanoseconds = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (entries[i].calls == 0)
+			continue;
+		called.push_back(&entries[i]);
+		totalCalls += entries[i].calls;
+		totalNanoseconds += entries[i].nanoseconds;
+	}
+	std::sort(called.begin(), called.end(),
+		[](const GladTraceEntry* a, const GladTraceEntry* b) { return a->nanoseconds > b->nanoseconds; });
+
+	std::printf("GL calls: per frame over %d frames (CPU time inside the driver)\n", frames);
+	std::printf("  %-32s %12s %12s %10s\n", "function", "calls", "us", "us/call");
+	for (const GladTraceEntry* entry : called)
+	{
+		std::printf("  %-32s %12.2f %12.2f %10.3f\n", entry->name, (double)entry->calls / frames,
+			entry->nanoseconds / 1000.0 / frames, entry->nanoseconds / 1000.0 / entry->calls);
+	}
+	std::printf("  %-32s %12.2f %12.2f\n", "total", (double)totalCalls / frames, totalNanoseconds / 1000.0 / frames);
+}
+
+#endif
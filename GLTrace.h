@@ -0,0 +1,30 @@
+#ifndef GL_TRACE_CLASS_H
+#define GL_TRACE_CLASS_H
+
+#include<glad/glad.h>
+
+// * NOTE: in a GLAD_INSTRUMENT build, glad puts a shim in front of every GL function that counts the calls and the CPU
+// time spent inside the driver (see glad.c). This turns those counters into a per-frame report of the render loop:
+//   glUseProgram          1.00 calls     0.40 us
+// Without GLAD_INSTRUMENT every method here is empty and inline, so it compiles to nothing.
+
+class GLTrace
+{
+public:
+#ifdef GLAD_INSTRUMENT
+	// forgets what was counted so far (e.g. the loading and setup calls), call right before the loop
+	void Begin();
+	void EndFrame() { frames++; }
+	// per-frame averages, the entry points that took the most time first
+	void PrintReport() const;
+
+private:
+	int frames = 0;
+#else
+	void Begin() {}
+	void EndFrame() {}
+	void PrintReport() const {}
+#endif
+};
+
+#endif
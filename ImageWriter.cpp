@@ -0,0 +1,331 @@
+#include"ImageWriter.h"
+
+#include<cstdint>
+#include<cstdio>
+#include<cstdlib>
+#include<cstring>
+
+const char* ImageExtension(ImageFormat format)
+{
+	switch (format)
+	{
+	case ImageFormat::Ppm: return "ppm";
+	case ImageFormat::Png: return "png";
+	default: return "rgba";
+	}
+}
+
+// ----------------------------------------------------------------------------------------------
+// deflate (RFC 1951), one block with the fixed Huffman codes
+// ----------------------------------------------------------------------------------------------
+
+// deflate packs bits starting from the lowest bit of each byte
+class BitWriter
+{
+public:
+	explicit BitWriter(std::vector<unsigned char>& out) : out(out) {}
+
+	void Put(uint32_t value, int count)
+	{
+		bits |= (uint64_t)value << used;
+		used += count;
+		while (used >= 8)
+		{
+			out.push_back((unsigned char)bits);
+			bits >>= 8;
+			used -= 8;
+		}
+	}
+
+	// Huffman codes are defined most significant bit first, so they go in reversed
+	void PutCode(uint32_t code, int count)
+	{
+		uint32_t reversed = 0;
+		for (int i = 0; i < count; i++)
+			reversed |= ((code >> i) & 1) << (count - 1 - i);
+		Put(reversed, count);
+	}
+
+	void Flush()
+	{
+		if (used > 0)
+			out.push_back((unsigned char)bits);
+		bits = 0;
+		used = 0;
+	}
+
+private:
+	std::vector<unsigned char>& out;
+	uint64_t bits = 0;
+	int used = 0;
+};
+
+static const int lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const int lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const int distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537,
+	2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const int distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// the fixed literal/length code from the RFC
+static void PutSymbol(BitWriter& writer, int symbol)
+{
+	if (symbol < 144)
+		writer.PutCode(0x30 + symbol, 8);
+	else if (symbol < 256)
+		writer.PutCode(0x190 + symbol - 144, 9);
+	else if (symbol < 280)
+		writer.PutCode(symbol - 256, 7);
+	else
+		writer.PutCode(0xC0 + symbol - 280, 8);
+}
+
+static void PutMatch(BitWriter& writer, int length, int distance)
+{
+	int code = 28;
+	while (lengthBase[code] > length)
+		code--;
+	PutSymbol(writer, 257 + code);
+	writer.Put(length - lengthBase[code], lengthExtra[code]);
+
+	code = 29;
+	while (distanceBase[code] > distance)
+		code--;
+	writer.PutCode(code, 5);
+	writer.Put(distance - distanceBase[code], distanceExtra[code]);
+}
+
+static uint32_t Read32(const unsigned char* p)
+{
+	uint32_t value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+// LZ77 with one candidate per hash slot: the last position whose next 4 bytes hashed the same.
+// Finds the long runs that filtered image rows are full of, without the cost of searching chains
+static void Deflate(const unsigned char* data, size_t size, std::vector<unsigned char>& out)
+{
+	const int HashBits = 15;
+	const size_t WindowSize = 32768;
+	const int MaxMatch = 258;
+	std::vector<int64_t> table((size_t)1 << HashBits, -1);
+	auto hash = [](uint32_t value) { return (value * 2654435761u) >> (32 - HashBits); };
+
+	BitWriter writer(out);
+	writer.Put(1, 1); // last block
+	writer.Put(1, 2); // fixed Huffman codes
+
+	size_t i = 0;
+	while (i < size)
+	{
+		int length = 0;
+		size_t distance = 0;
+		if (i + 4 <= size)
+		{
+			uint32_t h = hash(Read32(data + i));
+			int64_t candidate = table[h];
+			table[h] = (int64_t)i;
+			if (candidate >= 0 && i - (size_t)candidate <= WindowSize && Read32(data + candidate) == Read32(data + i))
+			{
+				size_t limit = size - i < (size_t)MaxMatch ? size - i : (size_t)MaxMatch;
+				length = 4;
+				while ((size_t)length < limit && data[candidate + length] == data[i + length])
+					length++;
+				distance = i - (size_t)candidate;
+			}
+		}
+
+		if (length == 0)
+		{
+			PutSymbol(writer, data[i]);
+			i++;
+			continue;
+		}
+
+		PutMatch(writer, length, (int)distance);
+		// the positions inside the match go into the table too, later matches can start there
+		size_t end = i + length;
+		for (i++; i < end; i++)
+			if (i + 4 <= size)
+				table[hash(Read32(data + i))] = (int64_t)i;
+	}
+
+	PutSymbol(writer, 256); // end of block
+	writer.Flush();
+}
+
+// ----------------------------------------------------------------------------------------------
+// PNG
+// ----------------------------------------------------------------------------------------------
+
+// the table is built once, on first use (thread safe: function statics are initialized only once)
+struct CrcTable
+{
+	uint32_t entries[256];
+	CrcTable()
+	{
+		for (uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+			for (int k = 0; k < 8; k++)
+				c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			entries[n] = c;
+		}
+	}
+};
+
+static uint32_t Crc32(const unsigned char* data, size_t size, uint32_t crc = 0)
+{
+	static const CrcTable crcTable;
+	const uint32_t* table = crcTable.entries;
+	crc = ~crc;
+	for (size_t i = 0; i < size; i++)
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+static uint32_t Adler32(const unsigned char* data, size_t size)
+{
+	uint32_t a = 1, b = 0;
+	while (size > 0)
+	{
+		// 5552 bytes is the most that can be summed before b overflows
+		size_t chunk = size < 5552 ? size : 5552;
+		for (size_t i = 0; i < chunk; i++)
+		{
+			a += data[i];
+			b += a;
+		}
+		a %= 65521;
+		b %= 65521;
+		data += chunk;
+		size -= chunk;
+	}
+	return b << 16 | a;
+}
+
+static void PutBigEndian(std::vector<unsigned char>& out, uint32_t value)
+{
+	out.push_back((unsigned char)(value >> 24));
+	out.push_back((unsigned char)(value >> 16));
+	out.push_back((unsigned char)(value >> 8));
+	out.push_back((unsigned char)value);
+}
+
+static void PutChunk(std::vector<unsigned char>& out, const char* type, const unsigned char* data, size_t size)
+{
+	PutBigEndian(out, (uint32_t)size);
+	size_t start = out.size();
+	out.insert(out.end(), type, type + 4);
+	out.insert(out.end(), data, data + size);
+	PutBigEndian(out, Crc32(&out[start], size + 4));
+}
+
+static int Paeth(int a, int b, int c)
+{
+	int p = a + b - c;
+	int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+	if (pa <= pb && pa <= pc)
+		return a;
+	return pb <= pc ? b : c;
+}
+
+std::vector<unsigned char> EncodePNG(const unsigned char* rgba, int width, int height)
+{
+	// every row gets the filter that leaves the smallest values (the usual heuristic: sum of |byte| as signed),
+	// small and repeating values are what deflate compresses well
+	const size_t stride = (size_t)width * 4;
+	std::vector<unsigned char> filtered;
+	filtered.reserve((stride + 1) * height);
+	std::vector<unsigned char> candidates[5];
+	for (std::vector<unsigned char>& candidate : candidates)
+		candidate.resize(stride);
+
+	for (int y = 0; y < height; y++)
+	{
+		// glReadPixels rows are bottom first, PNG rows top first
+		const unsigned char* row = rgba + (size_t)(height - 1 - y) * stride;
+		const unsigned char* above = y > 0 ? rgba + (size_t)(height - y) * stride : nullptr;
+
+		int best = 0;
+		long bestSum = -1;
+		for (int filter = 0; filter < 5; filter++)
+		{
+			unsigned char* out = candidates[filter].data();
+			long sum = 0;
+			for (size_t x = 0; x < stride; x++)
+			{
+				int left = x >= 4 ? row[x - 4] : 0;
+				int up = above != nullptr ? above[x] : 0;
+				int upLeft = x >= 4 && above != nullptr ? above[x - 4] : 0;
+				int predicted = 0;
+				switch (filter)
+				{
+				case 1: predicted = left; break;
+				case 2: predicted = up; break;
+				case 3: predicted = (left + up) / 2; break;
+				case 4: predicted = Paeth(left, up, upLeft); break;
+				}
+				out[x] = (unsigned char)(row[x] - predicted);
+				sum += out[x] < 128 ? out[x] : 256 - out[x];
+			}
+			if (bestSum < 0 || sum < bestSum)
+			{
+				best = filter;
+				bestSum = sum;
+			}
+		}
+		filtered.push_back((unsigned char)best);
+		filtered.insert(filtered.end(), candidates[best].begin(), candidates[best].end());
+	}
+
+	std::vector<unsigned char> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+	std::vector<unsigned char> header;
+	PutBigEndian(header, (uint32_t)width);
+	PutBigEndian(header, (uint32_t)height);
+	header.insert(header.end(), { 8, 6, 0, 0, 0 }); // 8 bits per channel, RGBA, deflate, adaptive filters, not interlaced
+	PutChunk(png, "IHDR", header.data(), header.size());
+
+	// zlib stream: header (deflate, 32K window, no dictionary), the deflate data, adler32 of the uncompressed bytes
+	std::vector<unsigned char> zlib = { 0x78, 0x01 };
+	Deflate(filtered.data(), filtered.size(), zlib);
+	PutBigEndian(zlib, Adler32(filtered.data(), filtered.size()));
+	PutChunk(png, "IDAT", zlib.data(), zlib.size());
+
+	PutChunk(png, "IEND", nullptr, 0);
+	return png;
+}
+
+bool WriteImage(const std::string& path, ImageFormat format, const unsigned char* rgba, int width, int height)
+{
+	std::vector<unsigned char> bytes;
+	const size_t stride = (size_t)width * 4;
+	if (format == ImageFormat::Png)
+		bytes = EncodePNG(rgba, width, height);
+	else if (format == ImageFormat::Ppm)
+	{
+		char header[64];
+		int length = std::snprintf(header, sizeof(header), "P6\n%d %d\n255\n", width, height);
+		bytes.assign(header, header + length);
+		bytes.reserve(bytes.size() + (size_t)width * height * 3);
+		for (int y = height - 1; y >= 0; y--)
+		{
+			const unsigned char* row = rgba + y * stride;
+			for (int x = 0; x < width; x++)
+				bytes.insert(bytes.end(), row + x * 4, row + x * 4 + 3);
+		}
+	}
+	else
+	{
+		bytes.reserve(stride * height);
+		for (int y = height - 1; y >= 0; y--)
+			bytes.insert(bytes.end(), rgba + y * stride, rgba + (y + 1) * stride);
+	}
+
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (file == nullptr)
+		return false;
+	bool ok = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+	return std::fclose(file) == 0 && ok;
+}
@@ -0,0 +1,30 @@
+#ifndef IMAGE_WRITER_CLASS_H
+#define IMAGE_WRITER_CLASS_H
+
+#include<string>
+#include<vector>
+
+// * NOTE: writes RGBA8 frames (as they come out of glReadPixels: bottom row first) to image files, top row first
+// like every image viewer expects.
+//   raw: width * height * 4 bytes, nothing else (the size has to be known to read it back)
+//   ppm: binary P6 header + RGB, the alpha channel is dropped
+//   png: RGBA, compressed with a small built-in deflate encoder (fixed Huffman codes + LZ77), no zlib needed.
+//        Bigger files than zlib would make, but a lot smaller than raw and fast enough to keep up on worker threads
+
+enum class ImageFormat
+{
+	Raw,
+	Ppm,
+	Png
+};
+
+// "rgba", "ppm" or "png"
+const char* ImageExtension(ImageFormat format);
+
+// encodes a whole PNG file into memory
+std::vector<unsigned char> EncodePNG(const unsigned char* rgba, int width, int height);
+
+// false when the file can't be written
+bool WriteImage(const std::string& path, ImageFormat format, const unsigned char* rgba, int width, int height);
+
+#endif
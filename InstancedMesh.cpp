@@ -0,0 +1,60 @@
+#include"InstancedMesh.h"
+
+InstancedMesh::InstancedMesh(const std::vector<float>& vertexPositions, const std::vector<GLuint>& vertexIndices,
+	VertexArrayCache& vertexArrays)
+	: vertexArrays(vertexArrays), positions(vertexPositions.data(), vertexPositions.size() * sizeof(float)),
+	instances(nullptr, 0, GL_DYNAMIC_DRAW),
+	indexed(!vertexIndices.empty())
+{
+	elementCount = indexed ? (GLsizei)vertexIndices.size() : (GLsizei)(vertexPositions.size() / 3);
+
+	// the EBO is bound while it's created: keep it out of whichever VAO happens to be bound
+	glBindVertexArray(0);
+	if (indexed)
+		indices = EBO(vertexIndices.data(), vertexIndices.size() * sizeof(GLuint));
+
+	// the instanced VAO: positions per vertex from buffer 0, transform + color per instance from buffer 1
+	// (PerInstance = divisor 1: move to the next InstanceData once per instance, not once per vertex)
+	VertexBuffers buffers(positions.ID, indices.ID);
+	buffers.buffers[1] = instances.ID;
+	vao = vertexArrays.Get(VertexLayoutOf<PositionVertex, PerInstance<InstanceData>>::layout, buffers);
+
+	// the naive VAO: only positions. Attributes 1 and 2 are disabled, so the shader reads the constant values
+	// set with glVertexAttrib4f instead
+	naiveVao = vertexArrays.Get(VertexLayoutOf<PositionVertex>::layout, VertexBuffers(positions.ID, indices.ID));
+}
+
+InstancedMesh::~InstancedMesh()
+{
+	// before the members delete the buffers, see VertexArrayCache.h
+	vertexArrays.Release(positions.ID);
+	vertexArrays.Release(indices.ID);
+	vertexArrays.Release(instances.ID);
+}
+
+void InstancedMesh::SetInstances(const std::vector<InstanceData>& data)
+{
+	instances.Bind();
+	glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(InstanceData), data.data(), GL_DYNAMIC_DRAW);
+	instances.Unbind();
+	instanceCount = (int)data.size();
+}
+
+void InstancedMesh::DrawInstanced() const
+{
+	if (indexed)
+		glDrawElementsInstanced(GL_TRIANGLES, elementCount, GL_UNSIGNED_INT, (void*)0, instanceCount);
+	else
+		glDrawArraysInstanced(GL_TRIANGLES, 0, elementCount, instanceCount);
+}
+
+void InstancedMesh::DrawSingle(const InstanceData& instance) const
+{
+	glVertexAttrib4f(AttribTransform, instance.offsetX, instance.offsetY, instance.scale, instance.rotation);
+	glVertexAttrib4f(AttribColor, instance.color[0] / 255.0f, instance.color[1] / 255.0f,
+		instance.color[2] / 255.0f, instance.color[3] / 255.0f);
+	if (indexed)
+		glDrawElements(GL_TRIANGLES, elementCount, GL_UNSIGNED_INT, (void*)0);
+	else
+		glDrawArrays(GL_TRIANGLES, 0, elementCount);
+}
@@ -0,0 +1,78 @@
+#ifndef INSTANCED_MESH_CLASS_H
+#define INSTANCED_MESH_CLASS_H
+
+#include<cstddef>
+#include<cstdint>
+#include<vector>
+#include"EBO.h"
+#include"VBO.h"
+#include"VertexArrayCache.h"
+
+// * NOTE: instancing = ONE draw call that draws the same mesh many times.
+// Attributes with a divisor of 1 (glVertexAttribDivisor) advance once per INSTANCE instead of once per vertex,
+// so every copy gets its own transform and color out of a second buffer, and gl_InstanceID counts the copies.
+
+// what each copy gets: position/scale/rotation and a color
+struct InstanceData
+{
+	float offsetX, offsetY; // where the copy goes, in clip space
+	float scale;
+	float rotation;         // radians
+	uint8_t color[4];       // RGBA, normalized to 0..1 by GL
+};
+
+// attribute locations the instanced vertex shader uses
+enum InstanceAttrib : GLuint
+{
+	AttribPosition = 0,
+	AttribTransform = 1, // vec4(offsetX, offsetY, scale, rotation)
+	AttribColor = 2      // vec4, normalized bytes
+};
+
+template<> struct VertexAttributes<InstanceData>
+{
+	static constexpr VertexAttribute list[] = {
+		// offsetX, offsetY, scale and rotation are read as one vec4
+		Attribute<float[4]>(AttribTransform, offsetof(InstanceData, offsetX)),
+		VERTEX_ATTRIBUTE(InstanceData, color, AttribColor, GL_TRUE) };
+};
+
+class InstancedMesh
+{
+public:
+	// positions: 3 floats per vertex. indices: optional, empty = non-indexed (glDrawArraysInstanced).
+	// The VAOs come from vertexArrays, which has to outlive the mesh
+	InstancedMesh(const std::vector<float>& positions, const std::vector<GLuint>& indices, VertexArrayCache& vertexArrays);
+	~InstancedMesh();
+
+	// uploads the per-instance data (replaces what was there)
+	void SetInstances(const std::vector<InstanceData>& instances);
+
+	// draws every instance with one call. Expects the program to be in use and this VAO bound (see VertexArray)
+	void DrawInstanced() const;
+
+	// draws ONE instance the naive way: the instance attributes are turned off in the naive VAO and set as
+	// constant attribute values (glVertexAttrib4f) before a normal draw. Same shader, same picture, N draw calls
+	void DrawSingle(const InstanceData& instance) const;
+
+	// VAO with the per-instance arrays enabled, and one with only positions for DrawSingle
+	GLuint VertexArray() const { return vao; }
+	GLuint NaiveVertexArray() const { return naiveVao; }
+
+	int InstanceCount() const { return instanceCount; }
+	// triangles in ONE copy of the mesh
+	int Triangles() const { return elementCount / 3; }
+
+private:
+	VertexArrayCache& vertexArrays;
+	GLuint vao = 0;
+	GLuint naiveVao = 0;
+	VBO positions;
+	EBO indices;
+	VBO instances;
+	GLsizei elementCount;
+	bool indexed;
+	int instanceCount = 0;
+};
+
+#endif
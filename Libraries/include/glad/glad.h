@@ -7,16 +7,18 @@
     APIs: gl=3.3
     Profile: core
     Extensions:
-        
+        GL_ARB_buffer_storage
+        GL_ARB_get_program_binary
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_get_program_binary&extensions=GL_KHR_parallel_shader_compile
 */
 
 
@@ -84,8 +86,21 @@ GLAPI struct gladGLversionStruct GLVersion;
 
 GLAPI int gladLoadGL(void);
 
+/* like gladLoadGL, but keeps libGL open and caches every address by name, so calling it
+ * again (after recreating the context) doesn't look anything up. gladUnloadGL closes it */
+GLAPI int gladLoadGLResident(void);
+GLAPI void gladUnloadGL(void);
+/* lookups answered from the cache vs. passed on to libGL since the last gladUnloadGL */
+GLAPI void gladGetProcCacheStats(int *hits, int *misses);
+
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* same as gladLoadGLLoader, but functions are only looked up on their first call.
+ * The loader must stay valid while GL is in use */
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+/* how many functions the lazy loader has looked up so far */
+GLAPI int gladLazyResolvedCount(void);
+
 #include <KHR/khrplatform.h>
 typedef unsigned int GLenum;
 typedef unsigned char GLboolean;
@@ -951,6 +966,19 @@ typedef void (APIENTRY *GLVULKANPROCNV)(void);
 #define GL_TIME_ELAPSED 0x88BF
 #define GL_TIMESTAMP 0x8E28
 #define GL_INT_2_10_10_10_REV 0x8D9F
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define GL_PROGRAM_BINARY_FORMATS 0x87FF
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
+#define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
+#define GL_BUFFER_STORAGE_FLAGS 0x8220
 #ifndef GL_VERSION_1_0
 #define GL_VERSION_1_0 1
 GLAPI int GLAD_GL_VERSION_1_0;
@@ -2121,6 +2149,1246 @@ typedef void (APIENTRYP PFNGLSECONDARYCOLORP3UIVPROC)(GLenum type, const GLuint
 GLAPI PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
 #define glSecondaryColorP3uiv glad_glSecondaryColorP3uiv
 #endif
+#ifndef GL_ARB_get_program_binary
+#define GL_ARB_get_program_binary 1
+GLAPI int GLAD_GL_ARB_get_program_binary;
+typedef void (APIENTRYP PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+GLAPI PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary;
+#define glGetProgramBinary glad_glGetProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+GLAPI PFNGLPROGRAMBINARYPROC glad_glProgramBinary;
+#define glProgramBinary glad_glProgramBinary
+typedef void (APIENTRYP PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+GLAPI PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri;
+#define glProgramParameteri glad_glProgramParameteri
+#endif
+#ifndef GL_KHR_parallel_shader_compile
+#define GL_KHR_parallel_shader_compile 1
+GLAPI int GLAD_GL_KHR_parallel_shader_compile;
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+GLAPI PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;
+#define glMaxShaderCompilerThreadsKHR glad_glMaxShaderCompilerThreadsKHR
+#endif
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+GLAPI int GLAD_GL_ARB_buffer_storage;
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+GLAPI PFNGLBUFFERSTORAGEPROC glad_glBufferStorage;
+#define glBufferStorage glad_glBufferStorage
+#endif
+
+#ifdef GLAD_INSTRUMENT
+/* instrumented build: calls and CPU time per entry point, counted by shims the loaders put
+ * in front of every global function pointer (not the per-context tables) */
+struct GladTraceEntry {
+    const char *name;
+    unsigned long long calls;
+    unsigned long long nanoseconds;
+};
+/* every traced entry point, returns how many there are */
+GLAPI int gladTraceEntries(const struct GladTraceEntry **entries);
+GLAPI void gladTraceReset(void);
+#endif
+
+/* Per-context dispatch tables: every context gets its own function pointers, version and
+ * extension flags, loaded with gladLoadGLContext. gladSetGLContext picks the table for the
+ * CALLING thread, so e.g. an upload thread and a render thread can each drive their own
+ * context without touching the same globals.
+ * Define GLAD_MX (for everything including glad.h) to make the gl* macros, GLAD_GL_* flags
+ * and GLVersion go through the current thread's table instead of the global pointers. */
+struct GladGLContext {
+	struct gladGLversionStruct version;
+	int VERSION_1_0;
+	int VERSION_1_1;
+	int VERSION_1_2;
+	int VERSION_1_3;
+	int VERSION_1_4;
+	int VERSION_1_5;
+	int VERSION_2_0;
+	int VERSION_2_1;
+	int VERSION_3_0;
+	int VERSION_3_1;
+	int VERSION_3_2;
+	int VERSION_3_3;
+	int ARB_get_program_binary;
+	int KHR_parallel_shader_compile;
+	int ARB_buffer_storage;
+	PFNGLCULLFACEPROC CullFace;
+	PFNGLFRONTFACEPROC FrontFace;
+	PFNGLHINTPROC Hint;
+	PFNGLLINEWIDTHPROC LineWidth;
+	PFNGLPOINTSIZEPROC PointSize;
+	PFNGLPOLYGONMODEPROC PolygonMode;
+	PFNGLSCISSORPROC Scissor;
+	PFNGLTEXPARAMETERFPROC TexParameterf;
+	PFNGLTEXPARAMETERFVPROC TexParameterfv;
+	PFNGLTEXPARAMETERIPROC TexParameteri;
+	PFNGLTEXPARAMETERIVPROC TexParameteriv;
+	PFNGLTEXIMAGE1DPROC TexImage1D;
+	PFNGLTEXIMAGE2DPROC TexImage2D;
+	PFNGLDRAWBUFFERPROC DrawBuffer;
+	PFNGLCLEARPROC Clear;
+	PFNGLCLEARCOLORPROC ClearColor;
+	PFNGLCLEARSTENCILPROC ClearStencil;
+	PFNGLCLEARDEPTHPROC ClearDepth;
+	PFNGLSTENCILMASKPROC StencilMask;
+	PFNGLCOLORMASKPROC ColorMask;
+	PFNGLDEPTHMASKPROC DepthMask;
+	PFNGLDISABLEPROC Disable;
+	PFNGLENABLEPROC Enable;
+	PFNGLFINISHPROC Finish;
+	PFNGLFLUSHPROC Flush;
+	PFNGLBLENDFUNCPROC BlendFunc;
+	PFNGLLOGICOPPROC LogicOp;
+	PFNGLSTENCILFUNCPROC StencilFunc;
+	PFNGLSTENCILOPPROC StencilOp;
+	PFNGLDEPTHFUNCPROC DepthFunc;
+	PFNGLPIXELSTOREFPROC PixelStoref;
+	PFNGLPIXELSTOREIPROC PixelStorei;
+	PFNGLREADBUFFERPROC ReadBuffer;
+	PFNGLREADPIXELSPROC ReadPixels;
+	PFNGLGETBOOLEANVPROC GetBooleanv;
+	PFNGLGETDOUBLEVPROC GetDoublev;
+	PFNGLGETERRORPROC GetError;
+	PFNGLGETFLOATVPROC GetFloatv;
+	PFNGLGETINTEGERVPROC GetIntegerv;
+	PFNGLGETSTRINGPROC GetString;
+	PFNGLGETTEXIMAGEPROC GetTexImage;
+	PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+	PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+	PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+	PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+	PFNGLISENABLEDPROC IsEnabled;
+	PFNGLDEPTHRANGEPROC DepthRange;
+	PFNGLVIEWPORTPROC Viewport;
+	PFNGLDRAWARRAYSPROC DrawArrays;
+	PFNGLDRAWELEMENTSPROC DrawElements;
+	PFNGLPOLYGONOFFSETPROC PolygonOffset;
+	PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+	PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+	PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+	PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+	PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+	PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+	PFNGLBINDTEXTUREPROC BindTexture;
+	PFNGLDELETETEXTURESPROC DeleteTextures;
+	PFNGLGENTEXTURESPROC GenTextures;
+	PFNGLISTEXTUREPROC IsTexture;
+	PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+	PFNGLTEXIMAGE3DPROC TexImage3D;
+	PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+	PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+	PFNGLACTIVETEXTUREPROC ActiveTexture;
+	PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+	PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+	PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+	PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+	PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+	PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+	PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+	PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+	PFNGLPOINTPARAMETERFPROC PointParameterf;
+	PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+	PFNGLPOINTPARAMETERIPROC PointParameteri;
+	PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+	PFNGLBLENDCOLORPROC BlendColor;
+	PFNGLBLENDEQUATIONPROC BlendEquation;
+	PFNGLGENQUERIESPROC GenQueries;
+	PFNGLDELETEQUERIESPROC DeleteQueries;
+	PFNGLISQUERYPROC IsQuery;
+	PFNGLBEGINQUERYPROC BeginQuery;
+	PFNGLENDQUERYPROC EndQuery;
+	PFNGLGETQUERYIVPROC GetQueryiv;
+	PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+	PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+	PFNGLBINDBUFFERPROC BindBuffer;
+	PFNGLDELETEBUFFERSPROC DeleteBuffers;
+	PFNGLGENBUFFERSPROC GenBuffers;
+	PFNGLISBUFFERPROC IsBuffer;
+	PFNGLBUFFERDATAPROC BufferData;
+	PFNGLBUFFERSUBDATAPROC BufferSubData;
+	PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+	PFNGLMAPBUFFERPROC MapBuffer;
+	PFNGLUNMAPBUFFERPROC UnmapBuffer;
+	PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+	PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+	PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+	PFNGLDRAWBUFFERSPROC DrawBuffers;
+	PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+	PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+	PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+	PFNGLATTACHSHADERPROC AttachShader;
+	PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+	PFNGLCOMPILESHADERPROC CompileShader;
+	PFNGLCREATEPROGRAMPROC CreateProgram;
+	PFNGLCREATESHADERPROC CreateShader;
+	PFNGLDELETEPROGRAMPROC DeleteProgram;
+	PFNGLDELETESHADERPROC DeleteShader;
+	PFNGLDETACHSHADERPROC DetachShader;
+	PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+	PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+	PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+	PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+	PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+	PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+	PFNGLGETPROGRAMIVPROC GetProgramiv;
+	PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+	PFNGLGETSHADERIVPROC GetShaderiv;
+	PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+	PFNGLGETSHADERSOURCEPROC GetShaderSource;
+	PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+	PFNGLGETUNIFORMFVPROC GetUniformfv;
+	PFNGLGETUNIFORMIVPROC GetUniformiv;
+	PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+	PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+	PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+	PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+	PFNGLISPROGRAMPROC IsProgram;
+	PFNGLISSHADERPROC IsShader;
+	PFNGLLINKPROGRAMPROC LinkProgram;
+	PFNGLSHADERSOURCEPROC ShaderSource;
+	PFNGLUSEPROGRAMPROC UseProgram;
+	PFNGLUNIFORM1FPROC Uniform1f;
+	PFNGLUNIFORM2FPROC Uniform2f;
+	PFNGLUNIFORM3FPROC Uniform3f;
+	PFNGLUNIFORM4FPROC Uniform4f;
+	PFNGLUNIFORM1IPROC Uniform1i;
+	PFNGLUNIFORM2IPROC Uniform2i;
+	PFNGLUNIFORM3IPROC Uniform3i;
+	PFNGLUNIFORM4IPROC Uniform4i;
+	PFNGLUNIFORM1FVPROC Uniform1fv;
+	PFNGLUNIFORM2FVPROC Uniform2fv;
+	PFNGLUNIFORM3FVPROC Uniform3fv;
+	PFNGLUNIFORM4FVPROC Uniform4fv;
+	PFNGLUNIFORM1IVPROC Uniform1iv;
+	PFNGLUNIFORM2IVPROC Uniform2iv;
+	PFNGLUNIFORM3IVPROC Uniform3iv;
+	PFNGLUNIFORM4IVPROC Uniform4iv;
+	PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+	PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+	PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+	PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+	PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+	PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+	PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+	PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+	PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+	PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+	PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+	PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+	PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+	PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+	PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+	PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+	PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+	PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+	PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+	PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+	PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+	PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+	PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+	PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+	PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+	PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+	PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+	PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+	PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+	PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+	PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+	PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+	PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+	PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+	PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+	PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+	PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+	PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+	PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+	PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+	PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+	PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+	PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+	PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+	PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+	PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+	PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+	PFNGLCOLORMASKIPROC ColorMaski;
+	PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+	PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+	PFNGLENABLEIPROC Enablei;
+	PFNGLDISABLEIPROC Disablei;
+	PFNGLISENABLEDIPROC IsEnabledi;
+	PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+	PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+	PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+	PFNGLBINDBUFFERBASEPROC BindBufferBase;
+	PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+	PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+	PFNGLCLAMPCOLORPROC ClampColor;
+	PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+	PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+	PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+	PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+	PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+	PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+	PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+	PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+	PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+	PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+	PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+	PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+	PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+	PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+	PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+	PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+	PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+	PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+	PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+	PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+	PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+	PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+	PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+	PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+	PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+	PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+	PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+	PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+	PFNGLUNIFORM1UIPROC Uniform1ui;
+	PFNGLUNIFORM2UIPROC Uniform2ui;
+	PFNGLUNIFORM3UIPROC Uniform3ui;
+	PFNGLUNIFORM4UIPROC Uniform4ui;
+	PFNGLUNIFORM1UIVPROC Uniform1uiv;
+	PFNGLUNIFORM2UIVPROC Uniform2uiv;
+	PFNGLUNIFORM3UIVPROC Uniform3uiv;
+	PFNGLUNIFORM4UIVPROC Uniform4uiv;
+	PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+	PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+	PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+	PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+	PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+	PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+	PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+	PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+	PFNGLGETSTRINGIPROC GetStringi;
+	PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+	PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+	PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+	PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+	PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+	PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+	PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+	PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+	PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+	PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+	PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+	PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+	PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+	PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+	PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+	PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+	PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+	PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+	PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+	PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+	PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+	PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+	PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+	PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+	PFNGLISVERTEXARRAYPROC IsVertexArray;
+	PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+	PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+	PFNGLTEXBUFFERPROC TexBuffer;
+	PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+	PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+	PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+	PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+	PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+	PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+	PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+	PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+	PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+	PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+	PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+	PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+	PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+	PFNGLFENCESYNCPROC FenceSync;
+	PFNGLISSYNCPROC IsSync;
+	PFNGLDELETESYNCPROC DeleteSync;
+	PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+	PFNGLWAITSYNCPROC WaitSync;
+	PFNGLGETINTEGER64VPROC GetInteger64v;
+	PFNGLGETSYNCIVPROC GetSynciv;
+	PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+	PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+	PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+	PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+	PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+	PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+	PFNGLSAMPLEMASKIPROC SampleMaski;
+	PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+	PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+	PFNGLGENSAMPLERSPROC GenSamplers;
+	PFNGLDELETESAMPLERSPROC DeleteSamplers;
+	PFNGLISSAMPLERPROC IsSampler;
+	PFNGLBINDSAMPLERPROC BindSampler;
+	PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+	PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+	PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+	PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+	PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+	PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+	PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+	PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+	PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+	PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+	PFNGLQUERYCOUNTERPROC QueryCounter;
+	PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+	PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+	PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+	PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+	PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+	PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+	PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+	PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+	PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+	PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+	PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+	PFNGLVERTEXP2UIPROC VertexP2ui;
+	PFNGLVERTEXP2UIVPROC VertexP2uiv;
+	PFNGLVERTEXP3UIPROC VertexP3ui;
+	PFNGLVERTEXP3UIVPROC VertexP3uiv;
+	PFNGLVERTEXP4UIPROC VertexP4ui;
+	PFNGLVERTEXP4UIVPROC VertexP4uiv;
+	PFNGLTEXCOORDP1UIPROC TexCoordP1ui;
+	PFNGLTEXCOORDP1UIVPROC TexCoordP1uiv;
+	PFNGLTEXCOORDP2UIPROC TexCoordP2ui;
+	PFNGLTEXCOORDP2UIVPROC TexCoordP2uiv;
+	PFNGLTEXCOORDP3UIPROC TexCoordP3ui;
+	PFNGLTEXCOORDP3UIVPROC TexCoordP3uiv;
+	PFNGLTEXCOORDP4UIPROC TexCoordP4ui;
+	PFNGLTEXCOORDP4UIVPROC TexCoordP4uiv;
+	PFNGLMULTITEXCOORDP1UIPROC MultiTexCoordP1ui;
+	PFNGLMULTITEXCOORDP1UIVPROC MultiTexCoordP1uiv;
+	PFNGLMULTITEXCOORDP2UIPROC MultiTexCoordP2ui;
+	PFNGLMULTITEXCOORDP2UIVPROC MultiTexCoordP2uiv;
+	PFNGLMULTITEXCOORDP3UIPROC MultiTexCoordP3ui;
+	PFNGLMULTITEXCOORDP3UIVPROC MultiTexCoordP3uiv;
+	PFNGLMULTITEXCOORDP4UIPROC MultiTexCoordP4ui;
+	PFNGLMULTITEXCOORDP4UIVPROC MultiTexCoordP4uiv;
+	PFNGLNORMALP3UIPROC NormalP3ui;
+	PFNGLNORMALP3UIVPROC NormalP3uiv;
+	PFNGLCOLORP3UIPROC ColorP3ui;
+	PFNGLCOLORP3UIVPROC ColorP3uiv;
+	PFNGLCOLORP4UIPROC ColorP4ui;
+	PFNGLCOLORP4UIVPROC ColorP4uiv;
+	PFNGLSECONDARYCOLORP3UIPROC SecondaryColorP3ui;
+	PFNGLSECONDARYCOLORP3UIVPROC SecondaryColorP3uiv;
+	PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+	PFNGLPROGRAMBINARYPROC ProgramBinary;
+	PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreadsKHR;
+	PFNGLBUFFERSTORAGEPROC BufferStorage;
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GLAD_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#elif defined(__cplusplus)
+#define GLAD_THREAD_LOCAL thread_local
+#else
+#define GLAD_THREAD_LOCAL _Thread_local
+#endif
+
+/* the calling thread's table, NULL until gladSetGLContext */
+GLAPI GLAD_THREAD_LOCAL struct GladGLContext *glad_current_context;
+
+/* fills context from load, which has to return functions of the context current on this
+ * thread. Doesn't touch the global pointers, safe to call from several threads at once */
+GLAPI int gladLoadGLContext(struct GladGLContext *context, GLADloadproc load);
+GLAPI void gladSetGLContext(struct GladGLContext *context);
+GLAPI struct GladGLContext *gladGetGLContext(void);
+
+#ifdef GLAD_MX
+#define GLAD_GL_VERSION_1_0 (glad_current_context->VERSION_1_0)
+#define GLAD_GL_VERSION_1_1 (glad_current_context->VERSION_1_1)
+#define GLAD_GL_VERSION_1_2 (glad_current_context->VERSION_1_2)
+#define GLAD_GL_VERSION_1_3 (glad_current_context->VERSION_1_3)
+#define GLAD_GL_VERSION_1_4 (glad_current_context->VERSION_1_4)
+#define GLAD_GL_VERSION_1_5 (glad_current_context->VERSION_1_5)
+#define GLAD_GL_VERSION_2_0 (glad_current_context->VERSION_2_0)
+#define GLAD_GL_VERSION_2_1 (glad_current_context->VERSION_2_1)
+#define GLAD_GL_VERSION_3_0 (glad_current_context->VERSION_3_0)
+#define GLAD_GL_VERSION_3_1 (glad_current_context->VERSION_3_1)
+#define GLAD_GL_VERSION_3_2 (glad_current_context->VERSION_3_2)
+#define GLAD_GL_VERSION_3_3 (glad_current_context->VERSION_3_3)
+#define GLAD_GL_ARB_get_program_binary (glad_current_context->ARB_get_program_binary)
+#define GLAD_GL_KHR_parallel_shader_compile (glad_current_context->KHR_parallel_shader_compile)
+#define GLAD_GL_ARB_buffer_storage (glad_current_context->ARB_buffer_storage)
+#define GLVersion (glad_current_context->version)
+#undef glCullFace
+#define glCullFace (glad_current_context->CullFace)
+#undef glFrontFace
+#define glFrontFace (glad_current_context->FrontFace)
+#undef glHint
+#define glHint (glad_current_context->Hint)
+#undef glLineWidth
+#define glLineWidth (glad_current_context->LineWidth)
+#undef glPointSize
+#define glPointSize (glad_current_context->PointSize)
+#undef glPolygonMode
+#define glPolygonMode (glad_current_context->PolygonMode)
+#undef glScissor
+#define glScissor (glad_current_context->Scissor)
+#undef glTexParameterf
+#define glTexParameterf (glad_current_context->TexParameterf)
+#undef glTexParameterfv
+#define glTexParameterfv (glad_current_context->TexParameterfv)
+#undef glTexParameteri
+#define glTexParameteri (glad_current_context->TexParameteri)
+#undef glTexParameteriv
+#define glTexParameteriv (glad_current_context->TexParameteriv)
+#undef glTexImage1D
+#define glTexImage1D (glad_current_context->TexImage1D)
+#undef glTexImage2D
+#define glTexImage2D (glad_current_context->TexImage2D)
+#undef glDrawBuffer
+#define glDrawBuffer (glad_current_context->DrawBuffer)
+#undef glClear
+#define glClear (glad_current_context->Clear)
+#undef glClearColor
+#define glClearColor (glad_current_context->ClearColor)
+#undef glClearStencil
+#define glClearStencil (glad_current_context->ClearStencil)
+#undef glClearDepth
+#define glClearDepth (glad_current_context->ClearDepth)
+#undef glStencilMask
+#define glStencilMask (glad_current_context->StencilMask)
+#undef glColorMask
+#define glColorMask (glad_current_context->ColorMask)
+#undef glDepthMask
+#define glDepthMask (glad_current_context->DepthMask)
+#undef glDisable
+#define glDisable (glad_current_context->Disable)
+#undef glEnable
+#define glEnable (glad_current_context->Enable)
+#undef glFinish
+#define glFinish (glad_current_context->Finish)
+#undef glFlush
+#define glFlush (glad_current_context->Flush)
+#undef glBlendFunc
+#define glBlendFunc (glad_current_context->BlendFunc)
+#undef glLogicOp
+#define glLogicOp (glad_current_context->LogicOp)
+#undef glStencilFunc
+#define glStencilFunc (glad_current_context->StencilFunc)
+#undef glStencilOp
+#define glStencilOp (glad_current_context->StencilOp)
+#undef glDepthFunc
+#define glDepthFunc (glad_current_context->DepthFunc)
+#undef glPixelStoref
+#define glPixelStoref (glad_current_context->PixelStoref)
+#undef glPixelStorei
+#define glPixelStorei (glad_current_context->PixelStorei)
+#undef glReadBuffer
+#define glReadBuffer (glad_current_context->ReadBuffer)
+#undef glReadPixels
+#define glReadPixels (glad_current_context->ReadPixels)
+#undef glGetBooleanv
+#define glGetBooleanv (glad_current_context->GetBooleanv)
+#undef glGetDoublev
+#define glGetDoublev (glad_current_context->GetDoublev)
+#undef glGetError
+#define glGetError (glad_current_context->GetError)
+#undef glGetFloatv
+#define glGetFloatv (glad_current_context->GetFloatv)
+#undef glGetIntegerv
+#define glGetIntegerv (glad_current_context->GetIntegerv)
+#undef glGetString
+#define glGetString (glad_current_context->GetString)
+#undef glGetTexImage
+#define glGetTexImage (glad_current_context->GetTexImage)
+#undef glGetTexParameterfv
+#define glGetTexParameterfv (glad_current_context->GetTexParameterfv)
+#undef glGetTexParameteriv
+#define glGetTexParameteriv (glad_current_context->GetTexParameteriv)
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv (glad_current_context->GetTexLevelParameterfv)
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv (glad_current_context->GetTexLevelParameteriv)
+#undef glIsEnabled
+#define glIsEnabled (glad_current_context->IsEnabled)
+#undef glDepthRange
+#define glDepthRange (glad_current_context->DepthRange)
+#undef glViewport
+#define glViewport (glad_current_context->Viewport)
+#undef glDrawArrays
+#define glDrawArrays (glad_current_context->DrawArrays)
+#undef glDrawElements
+#define glDrawElements (glad_current_context->DrawElements)
+#undef glPolygonOffset
+#define glPolygonOffset (glad_current_context->PolygonOffset)
+#undef glCopyTexImage1D
+#define glCopyTexImage1D (glad_current_context->CopyTexImage1D)
+#undef glCopyTexImage2D
+#define glCopyTexImage2D (glad_current_context->CopyTexImage2D)
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D (glad_current_context->CopyTexSubImage1D)
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D (glad_current_context->CopyTexSubImage2D)
+#undef glTexSubImage1D
+#define glTexSubImage1D (glad_current_context->TexSubImage1D)
+#undef glTexSubImage2D
+#define glTexSubImage2D (glad_current_context->TexSubImage2D)
+#undef glBindTexture
+#define glBindTexture (glad_current_context->BindTexture)
+#undef glDeleteTextures
+#define glDeleteTextures (glad_current_context->DeleteTextures)
+#undef glGenTextures
+#define glGenTextures (glad_current_context->GenTextures)
+#undef glIsTexture
+#define glIsTexture (glad_current_context->IsTexture)
+#undef glDrawRangeElements
+#define glDrawRangeElements (glad_current_context->DrawRangeElements)
+#undef glTexImage3D
+#define glTexImage3D (glad_current_context->TexImage3D)
+#undef glTexSubImage3D
+#define glTexSubImage3D (glad_current_context->TexSubImage3D)
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D (glad_current_context->CopyTexSubImage3D)
+#undef glActiveTexture
+#define glActiveTexture (glad_current_context->ActiveTexture)
+#undef glSampleCoverage
+#define glSampleCoverage (glad_current_context->SampleCoverage)
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D (glad_current_context->CompressedTexImage3D)
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D (glad_current_context->CompressedTexImage2D)
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D (glad_current_context->CompressedTexImage1D)
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D (glad_current_context->CompressedTexSubImage3D)
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D (glad_current_context->CompressedTexSubImage2D)
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D (glad_current_context->CompressedTexSubImage1D)
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage (glad_current_context->GetCompressedTexImage)
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate (glad_current_context->BlendFuncSeparate)
+#undef glMultiDrawArrays
+#define glMultiDrawArrays (glad_current_context->MultiDrawArrays)
+#undef glMultiDrawElements
+#define glMultiDrawElements (glad_current_context->MultiDrawElements)
+#undef glPointParameterf
+#define glPointParameterf (glad_current_context->PointParameterf)
+#undef glPointParameterfv
+#define glPointParameterfv (glad_current_context->PointParameterfv)
+#undef glPointParameteri
+#define glPointParameteri (glad_current_context->PointParameteri)
+#undef glPointParameteriv
+#define glPointParameteriv (glad_current_context->PointParameteriv)
+#undef glBlendColor
+#define glBlendColor (glad_current_context->BlendColor)
+#undef glBlendEquation
+#define glBlendEquation (glad_current_context->BlendEquation)
+#undef glGenQueries
+#define glGenQueries (glad_current_context->GenQueries)
+#undef glDeleteQueries
+#define glDeleteQueries (glad_current_context->DeleteQueries)
+#undef glIsQuery
+#define glIsQuery (glad_current_context->IsQuery)
+#undef glBeginQuery
+#define glBeginQuery (glad_current_context->BeginQuery)
+#undef glEndQuery
+#define glEndQuery (glad_current_context->EndQuery)
+#undef glGetQueryiv
+#define glGetQueryiv (glad_current_context->GetQueryiv)
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv (glad_current_context->GetQueryObjectiv)
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv (glad_current_context->GetQueryObjectuiv)
+#undef glBindBuffer
+#define glBindBuffer (glad_current_context->BindBuffer)
+#undef glDeleteBuffers
+#define glDeleteBuffers (glad_current_context->DeleteBuffers)
+#undef glGenBuffers
+#define glGenBuffers (glad_current_context->GenBuffers)
+#undef glIsBuffer
+#define glIsBuffer (glad_current_context->IsBuffer)
+#undef glBufferData
+#define glBufferData (glad_current_context->BufferData)
+#undef glBufferSubData
+#define glBufferSubData (glad_current_context->BufferSubData)
+#undef glGetBufferSubData
+#define glGetBufferSubData (glad_current_context->GetBufferSubData)
+#undef glMapBuffer
+#define glMapBuffer (glad_current_context->MapBuffer)
+#undef glUnmapBuffer
+#define glUnmapBuffer (glad_current_context->UnmapBuffer)
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv (glad_current_context->GetBufferParameteriv)
+#undef glGetBufferPointerv
+#define glGetBufferPointerv (glad_current_context->GetBufferPointerv)
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate (glad_current_context->BlendEquationSeparate)
+#undef glDrawBuffers
+#define glDrawBuffers (glad_current_context->DrawBuffers)
+#undef glStencilOpSeparate
+#define glStencilOpSeparate (glad_current_context->StencilOpSeparate)
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate (glad_current_context->StencilFuncSeparate)
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate (glad_current_context->StencilMaskSeparate)
+#undef glAttachShader
+#define glAttachShader (glad_current_context->AttachShader)
+#undef glBindAttribLocation
+#define glBindAttribLocation (glad_current_context->BindAttribLocation)
+#undef glCompileShader
+#define glCompileShader (glad_current_context->CompileShader)
+#undef glCreateProgram
+#define glCreateProgram (glad_current_context->CreateProgram)
+#undef glCreateShader
+#define glCreateShader (glad_current_context->CreateShader)
+#undef glDeleteProgram
+#define glDeleteProgram (glad_current_context->DeleteProgram)
+#undef glDeleteShader
+#define glDeleteShader (glad_current_context->DeleteShader)
+#undef glDetachShader
+#define glDetachShader (glad_current_context->DetachShader)
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray (glad_current_context->DisableVertexAttribArray)
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray (glad_current_context->EnableVertexAttribArray)
+#undef glGetActiveAttrib
+#define glGetActiveAttrib (glad_current_context->GetActiveAttrib)
+#undef glGetActiveUniform
+#define glGetActiveUniform (glad_current_context->GetActiveUniform)
+#undef glGetAttachedShaders
+#define glGetAttachedShaders (glad_current_context->GetAttachedShaders)
+#undef glGetAttribLocation
+#define glGetAttribLocation (glad_current_context->GetAttribLocation)
+#undef glGetProgramiv
+#define glGetProgramiv (glad_current_context->GetProgramiv)
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog (glad_current_context->GetProgramInfoLog)
+#undef glGetShaderiv
+#define glGetShaderiv (glad_current_context->GetShaderiv)
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog (glad_current_context->GetShaderInfoLog)
+#undef glGetShaderSource
+#define glGetShaderSource (glad_current_context->GetShaderSource)
+#undef glGetUniformLocation
+#define glGetUniformLocation (glad_current_context->GetUniformLocation)
+#undef glGetUniformfv
+#define glGetUniformfv (glad_current_context->GetUniformfv)
+#undef glGetUniformiv
+#define glGetUniformiv (glad_current_context->GetUniformiv)
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv (glad_current_context->GetVertexAttribdv)
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv (glad_current_context->GetVertexAttribfv)
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv (glad_current_context->GetVertexAttribiv)
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv (glad_current_context->GetVertexAttribPointerv)
+#undef glIsProgram
+#define glIsProgram (glad_current_context->IsProgram)
+#undef glIsShader
+#define glIsShader (glad_current_context->IsShader)
+#undef glLinkProgram
+#define glLinkProgram (glad_current_context->LinkProgram)
+#undef glShaderSource
+#define glShaderSource (glad_current_context->ShaderSource)
+#undef glUseProgram
+#define glUseProgram (glad_current_context->UseProgram)
+#undef glUniform1f
+#define glUniform1f (glad_current_context->Uniform1f)
+#undef glUniform2f
+#define glUniform2f (glad_current_context->Uniform2f)
+#undef glUniform3f
+#define glUniform3f (glad_current_context->Uniform3f)
+#undef glUniform4f
+#define glUniform4f (glad_current_context->Uniform4f)
+#undef glUniform1i
+#define glUniform1i (glad_current_context->Uniform1i)
+#undef glUniform2i
+#define glUniform2i (glad_current_context->Uniform2i)
+#undef glUniform3i
+#define glUniform3i (glad_current_context->Uniform3i)
+#undef glUniform4i
+#define glUniform4i (glad_current_context->Uniform4i)
+#undef glUniform1fv
+#define glUniform1fv (glad_current_context->Uniform1fv)
+#undef glUniform2fv
+#define glUniform2fv (glad_current_context->Uniform2fv)
+#undef glUniform3fv
+#define glUniform3fv (glad_current_context->Uniform3fv)
+#undef glUniform4fv
+#define glUniform4fv (glad_current_context->Uniform4fv)
+#undef glUniform1iv
+#define glUniform1iv (glad_current_context->Uniform1iv)
+#undef glUniform2iv
+#define glUniform2iv (glad_current_context->Uniform2iv)
+#undef glUniform3iv
+#define glUniform3iv (glad_current_context->Uniform3iv)
+#undef glUniform4iv
+#define glUniform4iv (glad_current_context->Uniform4iv)
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv (glad_current_context->UniformMatrix2fv)
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv (glad_current_context->UniformMatrix3fv)
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv (glad_current_context->UniformMatrix4fv)
+#undef glValidateProgram
+#define glValidateProgram (glad_current_context->ValidateProgram)
+#undef glVertexAttrib1d
+#define glVertexAttrib1d (glad_current_context->VertexAttrib1d)
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv (glad_current_context->VertexAttrib1dv)
+#undef glVertexAttrib1f
+#define glVertexAttrib1f (glad_current_context->VertexAttrib1f)
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv (glad_current_context->VertexAttrib1fv)
+#undef glVertexAttrib1s
+#define glVertexAttrib1s (glad_current_context->VertexAttrib1s)
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv (glad_current_context->VertexAttrib1sv)
+#undef glVertexAttrib2d
+#define glVertexAttrib2d (glad_current_context->VertexAttrib2d)
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv (glad_current_context->VertexAttrib2dv)
+#undef glVertexAttrib2f
+#define glVertexAttrib2f (glad_current_context->VertexAttrib2f)
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv (glad_current_context->VertexAttrib2fv)
+#undef glVertexAttrib2s
+#define glVertexAttrib2s (glad_current_context->VertexAttrib2s)
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv (glad_current_context->VertexAttrib2sv)
+#undef glVertexAttrib3d
+#define glVertexAttrib3d (glad_current_context->VertexAttrib3d)
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv (glad_current_context->VertexAttrib3dv)
+#undef glVertexAttrib3f
+#define glVertexAttrib3f (glad_current_context->VertexAttrib3f)
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv (glad_current_context->VertexAttrib3fv)
+#undef glVertexAttrib3s
+#define glVertexAttrib3s (glad_current_context->VertexAttrib3s)
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv (glad_current_context->VertexAttrib3sv)
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv (glad_current_context->VertexAttrib4Nbv)
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv (glad_current_context->VertexAttrib4Niv)
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv (glad_current_context->VertexAttrib4Nsv)
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub (glad_current_context->VertexAttrib4Nub)
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv (glad_current_context->VertexAttrib4Nubv)
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv (glad_current_context->VertexAttrib4Nuiv)
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv (glad_current_context->VertexAttrib4Nusv)
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv (glad_current_context->VertexAttrib4bv)
+#undef glVertexAttrib4d
+#define glVertexAttrib4d (glad_current_context->VertexAttrib4d)
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv (glad_current_context->VertexAttrib4dv)
+#undef glVertexAttrib4f
+#define glVertexAttrib4f (glad_current_context->VertexAttrib4f)
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv (glad_current_context->VertexAttrib4fv)
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv (glad_current_context->VertexAttrib4iv)
+#undef glVertexAttrib4s
+#define glVertexAttrib4s (glad_current_context->VertexAttrib4s)
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv (glad_current_context->VertexAttrib4sv)
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv (glad_current_context->VertexAttrib4ubv)
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv (glad_current_context->VertexAttrib4uiv)
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv (glad_current_context->VertexAttrib4usv)
+#undef glVertexAttribPointer
+#define glVertexAttribPointer (glad_current_context->VertexAttribPointer)
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv (glad_current_context->UniformMatrix2x3fv)
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv (glad_current_context->UniformMatrix3x2fv)
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv (glad_current_context->UniformMatrix2x4fv)
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv (glad_current_context->UniformMatrix4x2fv)
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv (glad_current_context->UniformMatrix3x4fv)
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv (glad_current_context->UniformMatrix4x3fv)
+#undef glColorMaski
+#define glColorMaski (glad_current_context->ColorMaski)
+#undef glGetBooleani_v
+#define glGetBooleani_v (glad_current_context->GetBooleani_v)
+#undef glGetIntegeri_v
+#define glGetIntegeri_v (glad_current_context->GetIntegeri_v)
+#undef glEnablei
+#define glEnablei (glad_current_context->Enablei)
+#undef glDisablei
+#define glDisablei (glad_current_context->Disablei)
+#undef glIsEnabledi
+#define glIsEnabledi (glad_current_context->IsEnabledi)
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback (glad_current_context->BeginTransformFeedback)
+#undef glEndTransformFeedback
+#define glEndTransformFeedback (glad_current_context->EndTransformFeedback)
+#undef glBindBufferRange
+#define glBindBufferRange (glad_current_context->BindBufferRange)
+#undef glBindBufferBase
+#define glBindBufferBase (glad_current_context->BindBufferBase)
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings (glad_current_context->TransformFeedbackVaryings)
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying (glad_current_context->GetTransformFeedbackVarying)
+#undef glClampColor
+#define glClampColor (glad_current_context->ClampColor)
+#undef glBeginConditionalRender
+#define glBeginConditionalRender (glad_current_context->BeginConditionalRender)
+#undef glEndConditionalRender
+#define glEndConditionalRender (glad_current_context->EndConditionalRender)
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer (glad_current_context->VertexAttribIPointer)
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv (glad_current_context->GetVertexAttribIiv)
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv (glad_current_context->GetVertexAttribIuiv)
+#undef glVertexAttribI1i
+#define glVertexAttribI1i (glad_current_context->VertexAttribI1i)
+#undef glVertexAttribI2i
+#define glVertexAttribI2i (glad_current_context->VertexAttribI2i)
+#undef glVertexAttribI3i
+#define glVertexAttribI3i (glad_current_context->VertexAttribI3i)
+#undef glVertexAttribI4i
+#define glVertexAttribI4i (glad_current_context->VertexAttribI4i)
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui (glad_current_context->VertexAttribI1ui)
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui (glad_current_context->VertexAttribI2ui)
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui (glad_current_context->VertexAttribI3ui)
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui (glad_current_context->VertexAttribI4ui)
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv (glad_current_context->VertexAttribI1iv)
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv (glad_current_context->VertexAttribI2iv)
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv (glad_current_context->VertexAttribI3iv)
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv (glad_current_context->VertexAttribI4iv)
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv (glad_current_context->VertexAttribI1uiv)
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv (glad_current_context->VertexAttribI2uiv)
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv (glad_current_context->VertexAttribI3uiv)
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv (glad_current_context->VertexAttribI4uiv)
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv (glad_current_context->VertexAttribI4bv)
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv (glad_current_context->VertexAttribI4sv)
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv (glad_current_context->VertexAttribI4ubv)
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv (glad_current_context->VertexAttribI4usv)
+#undef glGetUniformuiv
+#define glGetUniformuiv (glad_current_context->GetUniformuiv)
+#undef glBindFragDataLocation
+#define glBindFragDataLocation (glad_current_context->BindFragDataLocation)
+#undef glGetFragDataLocation
+#define glGetFragDataLocation (glad_current_context->GetFragDataLocation)
+#undef glUniform1ui
+#define glUniform1ui (glad_current_context->Uniform1ui)
+#undef glUniform2ui
+#define glUniform2ui (glad_current_context->Uniform2ui)
+#undef glUniform3ui
+#define glUniform3ui (glad_current_context->Uniform3ui)
+#undef glUniform4ui
+#define glUniform4ui (glad_current_context->Uniform4ui)
+#undef glUniform1uiv
+#define glUniform1uiv (glad_current_context->Uniform1uiv)
+#undef glUniform2uiv
+#define glUniform2uiv (glad_current_context->Uniform2uiv)
+#undef glUniform3uiv
+#define glUniform3uiv (glad_current_context->Uniform3uiv)
+#undef glUniform4uiv
+#define glUniform4uiv (glad_current_context->Uniform4uiv)
+#undef glTexParameterIiv
+#define glTexParameterIiv (glad_current_context->TexParameterIiv)
+#undef glTexParameterIuiv
+#define glTexParameterIuiv (glad_current_context->TexParameterIuiv)
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv (glad_current_context->GetTexParameterIiv)
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv (glad_current_context->GetTexParameterIuiv)
+#undef glClearBufferiv
+#define glClearBufferiv (glad_current_context->ClearBufferiv)
+#undef glClearBufferuiv
+#define glClearBufferuiv (glad_current_context->ClearBufferuiv)
+#undef glClearBufferfv
+#define glClearBufferfv (glad_current_context->ClearBufferfv)
+#undef glClearBufferfi
+#define glClearBufferfi (glad_current_context->ClearBufferfi)
+#undef glGetStringi
+#define glGetStringi (glad_current_context->GetStringi)
+#undef glIsRenderbuffer
+#define glIsRenderbuffer (glad_current_context->IsRenderbuffer)
+#undef glBindRenderbuffer
+#define glBindRenderbuffer (glad_current_context->BindRenderbuffer)
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers (glad_current_context->DeleteRenderbuffers)
+#undef glGenRenderbuffers
+#define glGenRenderbuffers (glad_current_context->GenRenderbuffers)
+#undef glRenderbufferStorage
+#define glRenderbufferStorage (glad_current_context->RenderbufferStorage)
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv (glad_current_context->GetRenderbufferParameteriv)
+#undef glIsFramebuffer
+#define glIsFramebuffer (glad_current_context->IsFramebuffer)
+#undef glBindFramebuffer
+#define glBindFramebuffer (glad_current_context->BindFramebuffer)
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers (glad_current_context->DeleteFramebuffers)
+#undef glGenFramebuffers
+#define glGenFramebuffers (glad_current_context->GenFramebuffers)
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus (glad_current_context->CheckFramebufferStatus)
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D (glad_current_context->FramebufferTexture1D)
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D (glad_current_context->FramebufferTexture2D)
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D (glad_current_context->FramebufferTexture3D)
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer (glad_current_context->FramebufferRenderbuffer)
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv (glad_current_context->GetFramebufferAttachmentParameteriv)
+#undef glGenerateMipmap
+#define glGenerateMipmap (glad_current_context->GenerateMipmap)
+#undef glBlitFramebuffer
+#define glBlitFramebuffer (glad_current_context->BlitFramebuffer)
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample (glad_current_context->RenderbufferStorageMultisample)
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer (glad_current_context->FramebufferTextureLayer)
+#undef glMapBufferRange
+#define glMapBufferRange (glad_current_context->MapBufferRange)
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange (glad_current_context->FlushMappedBufferRange)
+#undef glBindVertexArray
+#define glBindVertexArray (glad_current_context->BindVertexArray)
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays (glad_current_context->DeleteVertexArrays)
+#undef glGenVertexArrays
+#define glGenVertexArrays (glad_current_context->GenVertexArrays)
+#undef glIsVertexArray
+#define glIsVertexArray (glad_current_context->IsVertexArray)
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced (glad_current_context->DrawArraysInstanced)
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced (glad_current_context->DrawElementsInstanced)
+#undef glTexBuffer
+#define glTexBuffer (glad_current_context->TexBuffer)
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex (glad_current_context->PrimitiveRestartIndex)
+#undef glCopyBufferSubData
+#define glCopyBufferSubData (glad_current_context->CopyBufferSubData)
+#undef glGetUniformIndices
+#define glGetUniformIndices (glad_current_context->GetUniformIndices)
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv (glad_current_context->GetActiveUniformsiv)
+#undef glGetActiveUniformName
+#define glGetActiveUniformName (glad_current_context->GetActiveUniformName)
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex (glad_current_context->GetUniformBlockIndex)
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv (glad_current_context->GetActiveUniformBlockiv)
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName (glad_current_context->GetActiveUniformBlockName)
+#undef glUniformBlockBinding
+#define glUniformBlockBinding (glad_current_context->UniformBlockBinding)
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex (glad_current_context->DrawElementsBaseVertex)
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex (glad_current_context->DrawRangeElementsBaseVertex)
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex (glad_current_context->DrawElementsInstancedBaseVertex)
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex (glad_current_context->MultiDrawElementsBaseVertex)
+#undef glProvokingVertex
+#define glProvokingVertex (glad_current_context->ProvokingVertex)
+#undef glFenceSync
+#define glFenceSync (glad_current_context->FenceSync)
+#undef glIsSync
+#define glIsSync (glad_current_context->IsSync)
+#undef glDeleteSync
+#define glDeleteSync (glad_current_context->DeleteSync)
+#undef glClientWaitSync
+#define glClientWaitSync (glad_current_context->ClientWaitSync)
+#undef glWaitSync
+#define glWaitSync (glad_current_context->WaitSync)
+#undef glGetInteger64v
+#define glGetInteger64v (glad_current_context->GetInteger64v)
+#undef glGetSynciv
+#define glGetSynciv (glad_current_context->GetSynciv)
+#undef glGetInteger64i_v
+#define glGetInteger64i_v (glad_current_context->GetInteger64i_v)
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v (glad_current_context->GetBufferParameteri64v)
+#undef glFramebufferTexture
+#define glFramebufferTexture (glad_current_context->FramebufferTexture)
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample (glad_current_context->TexImage2DMultisample)
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample (glad_current_context->TexImage3DMultisample)
+#undef glGetMultisamplefv
+#define glGetMultisamplefv (glad_current_context->GetMultisamplefv)
+#undef glSampleMaski
+#define glSampleMaski (glad_current_context->SampleMaski)
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed (glad_current_context->BindFragDataLocationIndexed)
+#undef glGetFragDataIndex
+#define glGetFragDataIndex (glad_current_context->GetFragDataIndex)
+#undef glGenSamplers
+#define glGenSamplers (glad_current_context->GenSamplers)
+#undef glDeleteSamplers
+#define glDeleteSamplers (glad_current_context->DeleteSamplers)
+#undef glIsSampler
+#define glIsSampler (glad_current_context->IsSampler)
+#undef glBindSampler
+#define glBindSampler (glad_current_context->BindSampler)
+#undef glSamplerParameteri
+#define glSamplerParameteri (glad_current_context->SamplerParameteri)
+#undef glSamplerParameteriv
+#define glSamplerParameteriv (glad_current_context->SamplerParameteriv)
+#undef glSamplerParameterf
+#define glSamplerParameterf (glad_current_context->SamplerParameterf)
+#undef glSamplerParameterfv
+#define glSamplerParameterfv (glad_current_context->SamplerParameterfv)
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv (glad_current_context->SamplerParameterIiv)
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv (glad_current_context->SamplerParameterIuiv)
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv (glad_current_context->GetSamplerParameteriv)
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv (glad_current_context->GetSamplerParameterIiv)
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv (glad_current_context->GetSamplerParameterfv)
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv (glad_current_context->GetSamplerParameterIuiv)
+#undef glQueryCounter
+#define glQueryCounter (glad_current_context->QueryCounter)
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v (glad_current_context->GetQueryObjecti64v)
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v (glad_current_context->GetQueryObjectui64v)
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor (glad_current_context->VertexAttribDivisor)
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui (glad_current_context->VertexAttribP1ui)
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv (glad_current_context->VertexAttribP1uiv)
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui (glad_current_context->VertexAttribP2ui)
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv (glad_current_context->VertexAttribP2uiv)
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui (glad_current_context->VertexAttribP3ui)
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv (glad_current_context->VertexAttribP3uiv)
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui (glad_current_context->VertexAttribP4ui)
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv (glad_current_context->VertexAttribP4uiv)
+#undef glVertexP2ui
+#define glVertexP2ui (glad_current_context->VertexP2ui)
+#undef glVertexP2uiv
+#define glVertexP2uiv (glad_current_context->VertexP2uiv)
+#undef glVertexP3ui
+#define glVertexP3ui (glad_current_context->VertexP3ui)
+#undef glVertexP3uiv
+#define glVertexP3uiv (glad_current_context->VertexP3uiv)
+#undef glVertexP4ui
+#define glVertexP4ui (glad_current_context->VertexP4ui)
+#undef glVertexP4uiv
+#define glVertexP4uiv (glad_current_context->VertexP4uiv)
+#undef glTexCoordP1ui
+#define glTexCoordP1ui (glad_current_context->TexCoordP1ui)
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv (glad_current_context->TexCoordP1uiv)
+#undef glTexCoordP2ui
+#define glTexCoordP2ui (glad_current_context->TexCoordP2ui)
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv (glad_current_context->TexCoordP2uiv)
+#undef glTexCoordP3ui
+#define glTexCoordP3ui (glad_current_context->TexCoordP3ui)
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv (glad_current_context->TexCoordP3uiv)
+#undef glTexCoordP4ui
+#define glTexCoordP4ui (glad_current_context->TexCoordP4ui)
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv (glad_current_context->TexCoordP4uiv)
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui (glad_current_context->MultiTexCoordP1ui)
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv (glad_current_context->MultiTexCoordP1uiv)
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui (glad_current_context->MultiTexCoordP2ui)
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv (glad_current_context->MultiTexCoordP2uiv)
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui (glad_current_context->MultiTexCoordP3ui)
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv (glad_current_context->MultiTexCoordP3uiv)
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui (glad_current_context->MultiTexCoordP4ui)
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv (glad_current_context->MultiTexCoordP4uiv)
+#undef glNormalP3ui
+#define glNormalP3ui (glad_current_context->NormalP3ui)
+#undef glNormalP3uiv
+#define glNormalP3uiv (glad_current_context->NormalP3uiv)
+#undef glColorP3ui
+#define glColorP3ui (glad_current_context->ColorP3ui)
+#undef glColorP3uiv
+#define glColorP3uiv (glad_current_context->ColorP3uiv)
+#undef glColorP4ui
+#define glColorP4ui (glad_current_context->ColorP4ui)
+#undef glColorP4uiv
+#define glColorP4uiv (glad_current_context->ColorP4uiv)
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui (glad_current_context->SecondaryColorP3ui)
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv (glad_current_context->SecondaryColorP3uiv)
+#undef glGetProgramBinary
+#define glGetProgramBinary (glad_current_context->GetProgramBinary)
+#undef glProgramBinary
+#define glProgramBinary (glad_current_context->ProgramBinary)
+#undef glProgramParameteri
+#define glProgramParameteri (glad_current_context->ProgramParameteri)
+#undef glMaxShaderCompilerThreadsKHR
+#define glMaxShaderCompilerThreadsKHR (glad_current_context->MaxShaderCompilerThreadsKHR)
+#undef glBufferStorage
+#define glBufferStorage (glad_current_context->BufferStorage)
+#endif
 
 #ifdef __cplusplus
 }
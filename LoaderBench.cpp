@@ -0,0 +1,60 @@
+#include"LoaderBench.h"
+
+#include<chrono>
+#include<cstdio>
+#include<vector>
+#include"Benchmark.h"
+
+// runs load iterations times, returns the per-call times in microseconds (empty if a load failed)
+template<typename Load>
+static std::vector<double> TimeLoads(int iterations, Load load)
+{
+	std::vector<double> samples;
+	for (int i = 0; i < iterations; i++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		int loaded = load();
+		samples.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+		if (!loaded)
+			return std::vector<double>();
+	}
+	return samples;
+}
+
+static void PrintLoads(const char* name, const std::vector<double>& samples)
+{
+	if (samples.empty())
+	{
+		std::printf("  %-28s %s\n", name, "failed (no libGL?)");
+		return;
+	}
+	FrameStats stats = ComputeStats(samples);
+	std::printf("  %-28s %10.1f %10.1f %10.1f\n", name, stats.mean, stats.p50, stats.max);
+}
+
+void RunLoaderBenchmark(GLADloadproc contextLoader, bool lazy, int iterations)
+{
+	std::vector<double> loader = TimeLoads(iterations, [&]() { return gladLoadGLLoader(contextLoader); });
+	std::vector<double> reopen = TimeLoads(iterations, []() { return gladLoadGL(); });
+
+	// the first resident load still opens libGL and fills the cache, it's shown on its own
+	std::vector<double> first = TimeLoads(1, []() { return gladLoadGLResident(); });
+	std::vector<double> resident = TimeLoads(iterations, []() { return gladLoadGLResident(); });
+	int hits = 0, misses = 0;
+	gladGetProcCacheStats(&hits, &misses);
+	gladUnloadGL();
+
+	std::printf("GL reload latency over %d reloads (microseconds)\n", iterations);
+	std::printf("  %-28s %10s %10s %10s\n", "", "mean", "p50", "max");
+	PrintLoads("gladLoadGLLoader (backend)", loader);
+	PrintLoads("gladLoadGL (dlopen each)", reopen);
+	PrintLoads("gladLoadGLResident (first)", first);
+	PrintLoads("gladLoadGLResident (cached)", resident);
+	std::printf("  resident cache: %d hits, %d misses\n", hits, misses);
+
+	// back to the backend's loader, same as startup
+	if (lazy)
+		gladLoadGLLoaderLazy(contextLoader);
+	else
+		gladLoadGLLoader(contextLoader);
+}
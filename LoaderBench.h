@@ -0,0 +1,15 @@
+#ifndef LOADER_BENCH_CLASS_H
+#define LOADER_BENCH_CLASS_H
+
+#include<glad/glad.h>
+
+// * NOTE: reloading GL function pointers happens whenever a context gets recreated. This times the ways glad can do it,
+// against the context that's current right now (the addresses come out the same, only the cost differs):
+//   loader:   gladLoadGLLoader with the backend's lookup function (what main uses)
+//   gladLoadGL: dlopen libGL, look every function up, dlclose. Every single time
+//   resident: gladLoadGLResident, libGL stays open and addresses are cached by name after the first load
+//
+// afterwards the function pointers are loaded again with contextLoader (lazily if lazy), so rendering goes on as before
+void RunLoaderBenchmark(GLADloadproc contextLoader, bool lazy, int iterations);
+
+#endif
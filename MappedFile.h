@@ -0,0 +1,37 @@
+#ifndef MAPPED_FILE_CLASS_H
+#define MAPPED_FILE_CLASS_H
+
+#include<cstddef>
+#include<string>
+
+// * NOTE: a whole file mapped read-only into memory (mmap / MapViewOfFile). Nothing is read up front: the OS pages
+// the file in as it's touched, straight from its file cache, so "loading" a file that's already cached costs about
+// as much as the page table updates. The pointer stays valid until Close (or the destructor)
+class MappedFile
+{
+public:
+	MappedFile() {}
+	~MappedFile() { Close(); }
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	MappedFile(MappedFile&& other) noexcept;
+	MappedFile& operator=(MappedFile&& other) noexcept;
+
+	// false if the file doesn't exist, can't be read or is empty
+	bool Open(const std::string& path);
+	void Close();
+
+	const unsigned char* Data() const { return data; }
+	size_t Size() const { return size; }
+
+private:
+	const unsigned char* data = nullptr;
+	size_t size = 0;
+#ifdef _WIN32
+	void* file = nullptr;
+	void* mapping = nullptr;
+#endif
+};
+
+#endif
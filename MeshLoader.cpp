@@ -0,0 +1,1543 @@
+#include"MeshLoader.h"
+
+#include<algorithm>
+#include<atomic>
+#include<cctype>
+#include<charconv>
+#include<chrono>
+#include<cmath>
+#include<cstdio>
+#include<cstdlib>
+#include<cstring>
+#include<filesystem>
+#include<fstream>
+#include<iostream>
+#include<utility>
+
+// position + normal, the only vertex layout the loader produces
+static const int FloatsPerVertex = 6;
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool ReadWholeFile(const std::string& path, std::string& contents)
+{
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file)
+		return false;
+	std::streamoff length = file.tellg();
+	if (length < 0)
+		return false;
+	contents.resize((size_t)length);
+	file.seekg(0);
+	return (bool)file.read(&contents[0], length);
+}
+
+static std::string LowerExtension(const std::string& path)
+{
+	std::string extension = std::filesystem::path(path).extension().string();
+	for (char& c : extension)
+		c = (char)std::tolower((unsigned char)c);
+	return extension;
+}
+
+// the mixer from MurmurHash3's finalizer: consecutive indices end up far apart, in the low bits and the high ones
+static uint64_t MixKey(uint64_t key)
+{
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdull;
+	key ^= key >> 33;
+	return key;
+}
+
+// unique vertex ids for (position, normal) index pairs: open addressing, 64 bit keys, about half full
+class VertexMap
+{
+public:
+	explicit VertexMap(size_t expected)
+	{
+		size_t capacity = 64;
+		while (capacity < expected * 2)
+			capacity *= 2;
+		keys.assign(capacity, Empty);
+		values.resize(capacity);
+	}
+
+	// the id stored for key, or newId (which is then stored) if it's not there yet
+	GLuint FindOrInsert(uint64_t key, GLuint newId, bool& inserted)
+	{
+		if (count * 2 >= keys.size())
+			Grow();
+		size_t mask = keys.size() - 1;
+		for (size_t slot = (size_t)MixKey(key) & mask;; slot = (slot + 1) & mask)
+		{
+			if (keys[slot] == key)
+			{
+				inserted = false;
+				return values[slot];
+			}
+			if (keys[slot] == Empty)
+			{
+				keys[slot] = key;
+				values[slot] = newId;
+				count++;
+				inserted = true;
+				return newId;
+			}
+		}
+	}
+
+private:
+	static constexpr uint64_t Empty = ~0ull;
+
+	void Grow()
+	{
+		std::vector<uint64_t> oldKeys(keys.size() * 2, Empty);
+		std::vector<GLuint> oldValues(values.size() * 2);
+		oldKeys.swap(keys);
+		oldValues.swap(values);
+		size_t mask = keys.size() - 1;
+		for (size_t i = 0; i < oldKeys.size(); i++)
+		{
+			if (oldKeys[i] == Empty)
+				continue;
+			size_t slot = (size_t)MixKey(oldKeys[i]) & mask;
+			while (keys[slot] != Empty)
+				slot = (slot + 1) & mask;
+			keys[slot] = oldKeys[i];
+			values[slot] = oldValues[i];
+		}
+	}
+
+	std::vector<uint64_t> keys;
+	std::vector<GLuint> values;
+	size_t count = 0;
+};
+
+// vertices that came without a normal (all zero) get the area weighted average of their triangles' normals
+static void FillMissingNormals(IndexedMesh& mesh)
+{
+	size_t vertexCount = mesh.VertexCount();
+	std::vector<char> missing(vertexCount, 0);
+	bool any = false;
+	for (size_t v = 0; v < vertexCount; v++)
+	{
+		const float* n = &mesh.vertices[v * FloatsPerVertex + 3];
+		missing[v] = n[0] == 0.0f && n[1] == 0.0f && n[2] == 0.0f;
+		any |= missing[v] != 0;
+	}
+	if (!any)
+		return;
+
+	for (size_t t = 0; t + 2 < mesh.indices.size(); t += 3)
+	{
+		const float* a = &mesh.vertices[(size_t)mesh.indices[t] * FloatsPerVertex];
+		const float* b = &mesh.vertices[(size_t)mesh.indices[t + 1] * FloatsPerVertex];
+		const float* c = &mesh.vertices[(size_t)mesh.indices[t + 2] * FloatsPerVertex];
+		float ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+		float ac[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+		// not normalized: bigger triangles count more
+		float n[3] = { ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0] };
+		for (int k = 0; k < 3; k++)
+		{
+			GLuint v = mesh.indices[t + k];
+			if (!missing[v])
+				continue;
+			float* out = &mesh.vertices[(size_t)v * FloatsPerVertex + 3];
+			out[0] += n[0];
+			out[1] += n[1];
+			out[2] += n[2];
+		}
+	}
+	for (size_t v = 0; v < vertexCount; v++)
+	{
+		if (!missing[v])
+			continue;
+		float* n = &mesh.vertices[v * FloatsPerVertex + 3];
+		float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+		if (length > 0.0f)
+		{
+			n[0] /= length;
+			n[1] /= length;
+			n[2] /= length;
+		}
+		else
+			n[2] = 1.0f;
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------- threads
+
+// runs body(i) for every i in [0, count) on the pool's workers and waits for all of them
+static void ParallelEach(ThreadPool& pool, size_t count, const std::function<void(size_t)>& body)
+{
+	for (size_t i = 0; i < count; i++)
+		pool.Enqueue([&body, i] { body(i); });
+	pool.Wait();
+}
+
+// vertices or indices per job below which splitting the work costs more than it saves
+static const size_t ParallelMinRange = 1 << 16;
+
+// runs body(begin, end) over [0, count) in about 4 ranges per worker, none smaller than minRange, and waits
+static void ParallelRanges(ThreadPool& pool, size_t count, size_t minRange, const std::function<void(size_t, size_t)>& body)
+{
+	size_t ranges = (size_t)pool.Threads() * 4;
+	if (ranges > count / minRange)
+		ranges = count / minRange;
+	if (ranges <= 1)
+	{
+		if (count > 0)
+			body(0, count);
+		return;
+	}
+	ParallelEach(pool, ranges, [&](size_t r) { body(count * r / ranges, count * (r + 1) / ranges); });
+}
+
+// ---------------------------------------------------------------------------------------------------- OBJ
+
+// * NOTE: the OBJ parser runs in three parallel passes:
+//   1. the text is cut into chunks of whole lines, parsed at the same time: positions, normals, and faces (as
+//      fans of triangles) with their corners still as written in the file
+//   2. once every chunk knows how many positions and normals came before it, the corners become absolute
+//      (position, normal) keys, and each chunk sorts its corners into shards by key hash
+//   3. every shard dedups its keys on its own: a key lives in exactly one shard, so no locks. Vertex ids have to
+//      come out in order of first use in the file (what a one-thread parse gives, and what OptimizeVertexFetch
+//      expects to find on an Index level mesh), so the shards only mark first uses, a prefix count over the marks
+//      gives the final ids, and the shards then write their vertices and indices in place
+
+// chunks are at least this big, a small file isn't worth splitting
+static const size_t ObjMinChunkBytes = 1 << 20;
+// shards of the dedup pass, by the top bits of the key hash
+static const int ObjShardBits = 6;
+static const int ObjShards = 1 << ObjShardBits;
+
+// negative (counted back from the end) references can only be made absolute once the chunks before are counted.
+// Until then they're stored as ChunkRelative + the 1 based index within the chunk (<= 0 when it reaches back
+// into earlier chunks). References are at most 2^32 either way, so the two ranges can't meet
+static const int64_t ChunkRelative = -(1ll << 40);
+static const int64_t MaxObjIndex = 1ll << 32;
+
+// a triangle corner: position and normal reference, 0 = no normal
+struct ObjCorner
+{
+	int64_t position;
+	int64_t normal;
+};
+
+// one chunk of whole lines and what's in it, in file order
+struct ObjChunk
+{
+	const char* begin = nullptr;
+	const char* end = nullptr;
+
+	// pass 1
+	std::vector<float> positions;
+	std::vector<float> normals;
+	std::vector<ObjCorner> corners; // 3 per triangle
+	size_t lines = 0;
+	size_t errorLine = 0;           // within the chunk, 1 based, 0 = no error
+
+	// what the chunks before it hold
+	size_t positionBase = 0;
+	size_t normalBase = 0;
+	size_t cornerBase = 0;
+	size_t lineBase = 0;
+
+	// pass 2: the chunk's corners (global numbers) sorted by shard
+	std::vector<std::vector<uint32_t>> shardCorners;
+	bool badReference = false;
+
+	// pass 3: first uses of a key in this chunk, and how many there were in the chunks before
+	size_t firstUses = 0;
+	size_t firstUseBase = 0;
+};
+
+// skips spaces and tabs, not newlines
+static const char* SkipBlanks(const char* p, const char* end)
+{
+	while (p < end && (*p == ' ' || *p == '\t'))
+		p++;
+	return p;
+}
+
+static const char* NextLine(const char* p, const char* end)
+{
+	const char* newline = (const char*)std::memchr(p, '\n', end - p);
+	return newline != nullptr ? newline + 1 : end;
+}
+
+// reads n floats after a "v" / "vn" tag. from_chars reads exactly what strtof does (correctly rounded), minus the
+// locale and the null terminator, but it takes no leading blanks or plus sign
+static bool ReadFloats(const char*& p, const char* end, int n, std::vector<float>& out)
+{
+	for (int i = 0; i < n; i++)
+	{
+		p = SkipBlanks(p, end);
+		if (p < end && *p == '+')
+			p++;
+		float value = 0.0f;
+		std::from_chars_result result = std::from_chars(p, end, value);
+		if (result.ec != std::errc())
+			return false;
+		out.push_back(value);
+		p = result.ptr;
+	}
+	return true;
+}
+
+// an OBJ index as written: 1 based, negative counts back from the last one so far. 0 isn't allowed
+static bool ReadIndex(const char*& p, const char* end, int64_t& out)
+{
+	std::from_chars_result result = std::from_chars(p, end, out);
+	if (result.ec != std::errc() || out == 0 || out > MaxObjIndex || out < -MaxObjIndex)
+		return false;
+	p = result.ptr;
+	return true;
+}
+
+// pass 1 over one chunk
+static void ParseObjChunk(ObjChunk& chunk)
+{
+	const char* end = chunk.end;
+	std::vector<ObjCorner> polygon;
+	for (const char* p = chunk.begin; p < end; p = NextLine(p, end))
+	{
+		chunk.lines++;
+		p = SkipBlanks(p, end);
+		bool ok = true;
+		if (end - p > 2 && p[0] == 'v' && (p[1] == ' ' || p[1] == '\t'))
+		{
+			p += 2;
+			ok = ReadFloats(p, end, 3, chunk.positions);
+		}
+		else if (end - p > 3 && p[0] == 'v' && p[1] == 'n' && (p[2] == ' ' || p[2] == '\t'))
+		{
+			p += 3;
+			ok = ReadFloats(p, end, 3, chunk.normals);
+		}
+		else if (end - p > 2 && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t'))
+		{
+			p += 2;
+			polygon.clear();
+			int64_t positionCount = (int64_t)(chunk.positions.size() / 3), normalCount = (int64_t)(chunk.normals.size() / 3);
+			for (p = SkipBlanks(p, end); ok && p < end && *p != '\n' && *p != '\r'; p = SkipBlanks(p, end))
+			{
+				// v, v/vt, v//vn or v/vt/vn. Texture coordinates are skipped
+				ObjCorner corner = { 0, 0 };
+				int64_t unused = 0;
+				ok = ReadIndex(p, end, corner.position);
+				if (ok && p < end && *p == '/')
+				{
+					p++;
+					if (p < end && *p != '/')
+						ok = ReadIndex(p, end, unused);
+					if (ok && p < end && *p == '/')
+					{
+						p++;
+						ok = ReadIndex(p, end, corner.normal);
+					}
+				}
+				if (!ok)
+					break;
+				if (corner.position < 0)
+					corner.position += ChunkRelative + positionCount + 1;
+				if (corner.normal < 0)
+					corner.normal += ChunkRelative + normalCount + 1;
+				polygon.push_back(corner);
+			}
+			// polygons become fans, like every other OBJ reader does it
+			for (size_t k = 2; ok && k < polygon.size(); k++)
+				chunk.corners.insert(chunk.corners.end(), { polygon[0], polygon[k - 1], polygon[k] });
+		}
+		// everything else (vt, o, g, s, usemtl, mtllib, comments) isn't needed
+		if (!ok)
+		{
+			chunk.errorLine = chunk.lines;
+			return;
+		}
+	}
+}
+
+// a reference made absolute (1 based) with base entries in the chunks before, 0 if it's not in [1, total]
+static uint64_t ResolveObjIndex(int64_t value, size_t base, size_t total)
+{
+	if (value < 0)
+		value += (int64_t)base - ChunkRelative;
+	return value >= 1 && (uint64_t)value <= total ? (uint64_t)value : 0;
+}
+
+bool ParseOBJ(const std::string& path, IndexedMesh& mesh, ThreadPool& pool)
+{
+	std::string text;
+	if (!ReadWholeFile(path, text))
+	{
+		std::cout << "Can't read " << path << std::endl;
+		return false;
+	}
+
+	// pass 1: whole lines per chunk, about 4 chunks per worker so a slow one doesn't hold up the rest
+	std::vector<ObjChunk> chunks;
+	size_t chunkBytes = std::max(ObjMinChunkBytes, text.size() / ((size_t)pool.Threads() * 4) + 1);
+	const char* end = text.data() + text.size();
+	for (const char* p = text.data(); p < end;)
+	{
+		chunks.emplace_back();
+		chunks.back().begin = p;
+		p = (size_t)(end - p) > chunkBytes ? NextLine(p + chunkBytes, end) : end;
+		chunks.back().end = p;
+	}
+	ParallelEach(pool, chunks.size(), [&chunks](size_t c) { ParseObjChunk(chunks[c]); });
+
+	size_t positionCount = 0, normalCount = 0, cornerCount = 0, lineCount = 0;
+	for (ObjChunk& chunk : chunks)
+	{
+		chunk.positionBase = positionCount;
+		chunk.normalBase = normalCount;
+		chunk.cornerBase = cornerCount;
+		chunk.lineBase = lineCount;
+		if (chunk.errorLine != 0)
+		{
+			std::cout << path << ":" << chunk.lineBase + chunk.errorLine << ": can't read this line" << std::endl;
+			return false;
+		}
+		positionCount += chunk.positions.size() / 3;
+		normalCount += chunk.normals.size() / 3;
+		cornerCount += chunk.corners.size();
+		lineCount += chunk.lines;
+	}
+	if (cornerCount == 0)
+	{
+		std::cout << path << ": no faces" << std::endl;
+		return false;
+	}
+	if (cornerCount > 0xffffffffu)
+	{
+		std::cout << path << ": too many triangles for 32 bit indices" << std::endl;
+		return false;
+	}
+
+	// the chunks' positions and normals end to end, so a resolved reference is an index into these
+	std::vector<float> positions(positionCount * 3), normals(normalCount * 3);
+	ParallelEach(pool, chunks.size(), [&](size_t c)
+	{
+		ObjChunk& chunk = chunks[c];
+		std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + chunk.positionBase * 3);
+		std::copy(chunk.normals.begin(), chunk.normals.end(), normals.begin() + chunk.normalBase * 3);
+		std::vector<float>().swap(chunk.positions);
+		std::vector<float>().swap(chunk.normals);
+	});
+
+	// pass 2: (position, normal) keys, and each chunk's corners by shard
+	std::vector<uint64_t> keys(cornerCount);
+	ParallelEach(pool, chunks.size(), [&](size_t c)
+	{
+		ObjChunk& chunk = chunks[c];
+		chunk.shardCorners.resize(ObjShards);
+		for (size_t i = 0; i < chunk.corners.size(); i++)
+		{
+			const ObjCorner& corner = chunk.corners[i];
+			uint64_t position = ResolveObjIndex(corner.position, chunk.positionBase, positionCount);
+			uint64_t normal = corner.normal == 0 ? 0 : ResolveObjIndex(corner.normal, chunk.normalBase, normalCount);
+			if (position == 0 || (corner.normal != 0 && normal == 0))
+			{
+				chunk.badReference = true;
+				return;
+			}
+			uint64_t key = position << 32 | normal;
+			keys[chunk.cornerBase + i] = key;
+			chunk.shardCorners[MixKey(key) >> (64 - ObjShardBits)].push_back((uint32_t)(chunk.cornerBase + i));
+		}
+		std::vector<ObjCorner>().swap(chunk.corners);
+	});
+	for (const ObjChunk& chunk : chunks)
+	{
+		if (chunk.badReference)
+		{
+			std::cout << path << ": a face refers to a vertex or normal that isn't in the file" << std::endl;
+			return false;
+		}
+	}
+
+	// pass 3: each shard numbers its keys in the order the chunks (and so the file) use them, marking first uses.
+	// The shard-local numbers go into the index array for now
+	mesh = IndexedMesh();
+	mesh.floatsPerVertex = FloatsPerVertex;
+	mesh.indices.resize(cornerCount);
+	std::vector<uint32_t> vertexIds(cornerCount, 0);
+	std::vector<std::vector<uint32_t>> shardFirstUses(ObjShards);
+	ParallelEach(pool, ObjShards, [&](size_t shard)
+	{
+		// closed meshes have about one vertex per 6 corners
+		VertexMap vertexMap(cornerCount / 6 / ObjShards);
+		std::vector<uint32_t>& firstUses = shardFirstUses[shard];
+		for (const ObjChunk& chunk : chunks)
+		{
+			for (uint32_t corner : chunk.shardCorners[shard])
+			{
+				bool inserted = false;
+				GLuint id = vertexMap.FindOrInsert(keys[corner], (GLuint)firstUses.size(), inserted);
+				if (inserted)
+				{
+					firstUses.push_back(corner);
+					vertexIds[corner] = 1;
+				}
+				mesh.indices[corner] = id;
+			}
+		}
+	});
+
+	// the final vertex id of a first use is how many first uses come before it in the file: counted per chunk,
+	// added up over the chunks, then handed out per chunk
+	ParallelEach(pool, chunks.size(), [&](size_t c)
+	{
+		ObjChunk& chunk = chunks[c];
+		size_t last = c + 1 < chunks.size() ? chunks[c + 1].cornerBase : cornerCount;
+		for (size_t i = chunk.cornerBase; i < last; i++)
+			chunk.firstUses += vertexIds[i];
+	});
+	size_t vertexCount = 0;
+	for (ObjChunk& chunk : chunks)
+	{
+		chunk.firstUseBase = vertexCount;
+		vertexCount += chunk.firstUses;
+	}
+	ParallelEach(pool, chunks.size(), [&](size_t c)
+	{
+		size_t last = c + 1 < chunks.size() ? chunks[c + 1].cornerBase : cornerCount;
+		uint32_t next = (uint32_t)chunks[c].firstUseBase;
+		for (size_t i = chunks[c].cornerBase; i < last; i++)
+			if (vertexIds[i] != 0)
+				vertexIds[i] = next++;
+	});
+
+	// every shard writes its vertices where they go, and turns its indices from shard-local to final ids
+	mesh.vertices.resize(vertexCount * FloatsPerVertex);
+	ParallelEach(pool, ObjShards, [&](size_t shard)
+	{
+		const std::vector<uint32_t>& firstUses = shardFirstUses[shard];
+		std::vector<uint32_t> finalIds(firstUses.size());
+		for (size_t local = 0; local < firstUses.size(); local++)
+		{
+			uint32_t id = vertexIds[firstUses[local]];
+			finalIds[local] = id;
+			uint64_t key = keys[firstUses[local]];
+			size_t position = (size_t)(key >> 32) - 1, normal = (size_t)(key & 0xffffffffu);
+			float* vertex = &mesh.vertices[(size_t)id * FloatsPerVertex];
+			std::memcpy(vertex, &positions[position * 3], 3 * sizeof(float));
+			if (normal != 0)
+				std::memcpy(vertex + 3, &normals[(normal - 1) * 3], 3 * sizeof(float));
+			else
+				vertex[3] = vertex[4] = vertex[5] = 0.0f;
+		}
+		for (const ObjChunk& chunk : chunks)
+			for (uint32_t corner : chunk.shardCorners[shard])
+				mesh.indices[corner] = finalIds[mesh.indices[corner]];
+	});
+
+	FillMissingNormals(mesh);
+	return true;
+}
+
+// ---------------------------------------------------------------------------------------------------- JSON
+
+// just enough JSON for glTF: the whole document becomes a tree of these
+struct JsonValue
+{
+	enum Type { Null, Bool, Number, String, Array, Object };
+	Type type = Null;
+	bool boolean = false;
+	double number = 0.0;
+	std::string string;
+	std::vector<JsonValue> items;
+	std::vector<std::pair<std::string, JsonValue>> members;
+
+	// nullptr when it's not an object or the key isn't there
+	const JsonValue* Get(const char* key) const
+	{
+		for (const auto& member : members)
+			if (member.first == key)
+				return &member.second;
+		return nullptr;
+	}
+
+	const JsonValue* At(size_t index) const { return type == Array && index < items.size() ? &items[index] : nullptr; }
+
+	double NumberOr(const char* key, double fallback) const
+	{
+		const JsonValue* value = Get(key);
+		return value != nullptr && value->type == Number ? value->number : fallback;
+	}
+};
+
+class JsonParser
+{
+public:
+	JsonParser(const char* begin, const char* end) : p(begin), end(end) {}
+
+	bool Parse(JsonValue& out)
+	{
+		return ParseValue(out, 0) && (SkipSpace(), p == end);
+	}
+
+private:
+	void SkipSpace()
+	{
+		while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+			p++;
+	}
+
+	bool Literal(const char* word)
+	{
+		size_t length = std::strlen(word);
+		if ((size_t)(end - p) < length || std::strncmp(p, word, length) != 0)
+			return false;
+		p += length;
+		return true;
+	}
+
+	static void AppendUtf8(std::string& out, uint32_t code)
+	{
+		if (code < 0x80)
+			out += (char)code;
+		else if (code < 0x800)
+		{
+			out += (char)(0xc0 | code >> 6);
+			out += (char)(0x80 | (code & 0x3f));
+		}
+		else if (code < 0x10000)
+		{
+			out += (char)(0xe0 | code >> 12);
+			out += (char)(0x80 | (code >> 6 & 0x3f));
+			out += (char)(0x80 | (code & 0x3f));
+		}
+		else
+		{
+			out += (char)(0xf0 | code >> 18);
+			out += (char)(0x80 | (code >> 12 & 0x3f));
+			out += (char)(0x80 | (code >> 6 & 0x3f));
+			out += (char)(0x80 | (code & 0x3f));
+		}
+	}
+
+	bool Hex4(uint32_t& out)
+	{
+		if (end - p < 4)
+			return false;
+		out = 0;
+		for (int i = 0; i < 4; i++, p++)
+		{
+			char c = *p;
+			int digit = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+			if (digit < 0)
+				return false;
+			out = out << 4 | (uint32_t)digit;
+		}
+		return true;
+	}
+
+	bool ParseString(std::string& out)
+	{
+		p++; // the opening quote
+		while (p < end && *p != '"')
+		{
+			if (*p != '\\')
+			{
+				out += *p++;
+				continue;
+			}
+			if (++p >= end)
+				return false;
+			char escape = *p++;
+			switch (escape)
+			{
+			case '"': out += '"'; break;
+			case '\\': out += '\\'; break;
+			case '/': out += '/'; break;
+			case 'b': out += '\b'; break;
+			case 'f': out += '\f'; break;
+			case 'n': out += '\n'; break;
+			case 'r': out += '\r'; break;
+			case 't': out += '\t'; break;
+			case 'u':
+			{
+				uint32_t code = 0, low = 0;
+				if (!Hex4(code))
+					return false;
+				// a surrogate pair is two \u escapes
+				if (code >= 0xd800 && code < 0xdc00 && end - p >= 6 && p[0] == '\\' && p[1] == 'u')
+				{
+					p += 2;
+					if (!Hex4(low))
+						return false;
+					code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+				}
+				AppendUtf8(out, code);
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+		if (p >= end)
+			return false;
+		p++; // the closing quote
+		return true;
+	}
+
+	bool ParseValue(JsonValue& out, int depth)
+	{
+		// nobody nests glTF this deep, it's a broken (or hostile) file
+		if (depth > 64)
+			return false;
+		SkipSpace();
+		if (p >= end)
+			return false;
+
+		if (*p == '{')
+		{
+			out.type = JsonValue::Object;
+			p++;
+			SkipSpace();
+			if (p < end && *p == '}')
+			{
+				p++;
+				return true;
+			}
+			for (;;)
+			{
+				SkipSpace();
+				if (p >= end || *p != '"')
+					return false;
+				out.members.emplace_back();
+				if (!ParseString(out.members.back().first))
+					return false;
+				SkipSpace();
+				if (p >= end || *p++ != ':')
+					return false;
+				if (!ParseValue(out.members.back().second, depth + 1))
+					return false;
+				SkipSpace();
+				if (p < end && *p == ',')
+				{
+					p++;
+					continue;
+				}
+				if (p < end && *p == '}')
+				{
+					p++;
+					return true;
+				}
+				return false;
+			}
+		}
+		if (*p == '[')
+		{
+			out.type = JsonValue::Array;
+			p++;
+			SkipSpace();
+			if (p < end && *p == ']')
+			{
+				p++;
+				return true;
+			}
+			for (;;)
+			{
+				out.items.emplace_back();
+				if (!ParseValue(out.items.back(), depth + 1))
+					return false;
+				SkipSpace();
+				if (p < end && *p == ',')
+				{
+					p++;
+					continue;
+				}
+				if (p < end && *p == ']')
+				{
+					p++;
+					return true;
+				}
+				return false;
+			}
+		}
+		if (*p == '"')
+		{
+			out.type = JsonValue::String;
+			return ParseString(out.string);
+		}
+		if (Literal("true") || Literal("false"))
+		{
+			out.type = JsonValue::Bool;
+			out.boolean = p[-1] == 'e' && p[-2] == 'u';
+			return true;
+		}
+		if (Literal("null"))
+			return true;
+
+		// strtod would happily read past the end of a buffer that isn't null terminated, so copy the number out
+		const char* start = p;
+		while (p < end && (std::strchr("+-.eE", *p) != nullptr || (*p >= '0' && *p <= '9')))
+			p++;
+		if (p == start || p - start > 63)
+			return false;
+		char number[64];
+		std::memcpy(number, start, p - start);
+		number[p - start] = '\0';
+		char* numberEnd = nullptr;
+		out.type = JsonValue::Number;
+		out.number = std::strtod(number, &numberEnd);
+		return *numberEnd == '\0';
+	}
+
+	const char* p;
+	const char* end;
+};
+
+// ---------------------------------------------------------------------------------------------------- glTF
+
+static const uint32_t GlbMagic = 0x46546c67;     // "glTF"
+static const uint32_t GlbJsonChunk = 0x4e4f534a; // "JSON"
+static const uint32_t GlbBinChunk = 0x004e4942;  // "BIN\0"
+
+static const int GltfUnsignedByte = 5121;
+static const int GltfUnsignedShort = 5123;
+static const int GltfUnsignedInt = 5125;
+static const int GltfFloat = 5126;
+
+static bool DecodeBase64(const char* text, size_t length, std::string& out)
+{
+	auto value = [](char c) -> int
+	{
+		if (c >= 'A' && c <= 'Z') return c - 'A';
+		if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+		if (c >= '0' && c <= '9') return c - '0' + 52;
+		if (c == '+') return 62;
+		if (c == '/') return 63;
+		return -1;
+	};
+	uint32_t bits = 0;
+	int bitCount = 0;
+	for (size_t i = 0; i < length && text[i] != '='; i++)
+	{
+		int v = value(text[i]);
+		if (v < 0)
+			return false;
+		bits = bits << 6 | (uint32_t)v;
+		bitCount += 6;
+		if (bitCount >= 8)
+		{
+			bitCount -= 8;
+			out += (char)(bits >> bitCount & 0xff);
+		}
+	}
+	return true;
+}
+
+// column major 4x4, like glTF writes them
+struct GltfMatrix
+{
+	float m[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+
+	GltfMatrix operator*(const GltfMatrix& other) const
+	{
+		GltfMatrix result;
+		for (int column = 0; column < 4; column++)
+			for (int row = 0; row < 4; row++)
+			{
+				float sum = 0.0f;
+				for (int k = 0; k < 4; k++)
+					sum += m[k * 4 + row] * other.m[column * 4 + k];
+				result.m[column * 4 + row] = sum;
+			}
+		return result;
+	}
+};
+
+// a node's local transform: its matrix, or translation * rotation * scale
+static GltfMatrix NodeMatrix(const JsonValue& node)
+{
+	GltfMatrix result;
+	const JsonValue* matrix = node.Get("matrix");
+	if (matrix != nullptr && matrix->type == JsonValue::Array && matrix->items.size() == 16)
+	{
+		for (int i = 0; i < 16; i++)
+			result.m[i] = (float)matrix->items[i].number;
+		return result;
+	}
+	auto read = [&node](const char* key, float* out, int n)
+	{
+		const JsonValue* value = node.Get(key);
+		if (value != nullptr && value->type == JsonValue::Array && value->items.size() == (size_t)n)
+			for (int i = 0; i < n; i++)
+				out[i] = (float)value->items[i].number;
+	};
+	float t[3] = { 0, 0, 0 }, r[4] = { 0, 0, 0, 1 }, s[3] = { 1, 1, 1 };
+	read("translation", t, 3);
+	read("rotation", r, 4);
+	read("scale", s, 3);
+	float x = r[0], y = r[1], z = r[2], w = r[3];
+	float rotation[9] =
+	{
+		1 - 2 * (y * y + z * z), 2 * (x * y + z * w), 2 * (x * z - y * w),
+		2 * (x * y - z * w), 1 - 2 * (x * x + z * z), 2 * (y * z + x * w),
+		2 * (x * z + y * w), 2 * (y * z - x * w), 1 - 2 * (x * x + y * y)
+	};
+	for (int column = 0; column < 3; column++)
+		for (int row = 0; row < 3; row++)
+			result.m[column * 4 + row] = rotation[column * 3 + row] * s[column];
+	result.m[12] = t[0];
+	result.m[13] = t[1];
+	result.m[14] = t[2];
+	return result;
+}
+
+class GltfReader
+{
+public:
+	explicit GltfReader(ThreadPool& pool) : pool(pool) {}
+
+	bool Load(const std::string& path, IndexedMesh& mesh)
+	{
+		this->path = path;
+		if (!ReadWholeFile(path, file))
+			return Fail("can't read the file");
+
+		const char* jsonBegin = file.data();
+		const char* jsonEnd = file.data() + file.size();
+		if (file.size() >= 12 && ReadU32(0) == GlbMagic)
+		{
+			// .glb: 12 byte header, then a JSON chunk and optionally a BIN chunk
+			if (ReadU32(4) != 2)
+				return Fail("only glTF 2.0 is supported");
+			size_t offset = 12;
+			while (offset + 8 <= file.size())
+			{
+				uint32_t length = ReadU32(offset), type = ReadU32(offset + 4);
+				if (offset + 8 + (size_t)length > file.size())
+					return Fail("chunk runs past the end of the file");
+				if (type == GlbJsonChunk)
+				{
+					jsonBegin = file.data() + offset + 8;
+					jsonEnd = jsonBegin + length;
+				}
+				else if (type == GlbBinChunk)
+				{
+					glbBinary = file.data() + offset + 8;
+					glbBinaryLength = length;
+				}
+				offset += 8 + (size_t)((length + 3) & ~3u);
+			}
+		}
+		if (!JsonParser(jsonBegin, jsonEnd).Parse(json) || json.type != JsonValue::Object)
+			return Fail("not valid JSON");
+		if (!LoadBuffers())
+			return false;
+
+		mesh = IndexedMesh();
+		mesh.floatsPerVertex = FloatsPerVertex;
+
+		// the default scene's node tree, with the transforms applied. A file without scenes gets every mesh as is
+		const JsonValue* scenes = json.Get("scenes");
+		const JsonValue* nodes = json.Get("nodes");
+		if (scenes != nullptr && scenes->type == JsonValue::Array && !scenes->items.empty() && nodes != nullptr)
+		{
+			const JsonValue* scene = scenes->At((size_t)json.NumberOr("scene", 0));
+			const JsonValue* roots = scene != nullptr ? scene->Get("nodes") : nullptr;
+			if (roots != nullptr)
+				for (const JsonValue& root : roots->items)
+					if (!AddNode(*nodes, (size_t)root.number, GltfMatrix(), 0, mesh))
+						return false;
+		}
+		else if (const JsonValue* meshes = json.Get("meshes"))
+		{
+			for (size_t i = 0; i < meshes->items.size(); i++)
+				if (!AddMesh(i, GltfMatrix(), mesh))
+					return false;
+		}
+
+		if (skippedPrimitives > 0)
+			std::cout << path << ": skipped " << skippedPrimitives << " primitives that aren't triangle lists" << std::endl;
+		if (mesh.indices.empty())
+			return Fail("no triangles");
+		FillMissingNormals(mesh);
+		return true;
+	}
+
+private:
+	struct Accessor
+	{
+		const unsigned char* data = nullptr;
+		size_t count = 0;
+		size_t stride = 0;
+		int componentType = 0;
+		int components = 0;
+	};
+
+	bool Fail(const char* what)
+	{
+		std::cout << path << ": " << what << std::endl;
+		return false;
+	}
+
+	uint32_t ReadU32(size_t offset) const
+	{
+		uint32_t value;
+		std::memcpy(&value, file.data() + offset, 4);
+		return value;
+	}
+
+	bool LoadBuffers()
+	{
+		const JsonValue* buffers = json.Get("buffers");
+		if (buffers == nullptr)
+			return true;
+		std::filesystem::path directory = std::filesystem::path(path).parent_path();
+		for (const JsonValue& buffer : buffers->items)
+		{
+			size_t length = (size_t)buffer.NumberOr("byteLength", 0);
+			const JsonValue* uri = buffer.Get("uri");
+			std::string data;
+			if (uri == nullptr)
+			{
+				// the .glb's own binary chunk
+				if (glbBinary == nullptr)
+					return Fail("buffer without uri outside a .glb");
+				data.assign(glbBinary, glbBinaryLength);
+			}
+			else if (uri->string.compare(0, 5, "data:") == 0)
+			{
+				size_t comma = uri->string.find(";base64,");
+				if (comma == std::string::npos || !DecodeBase64(uri->string.c_str() + comma + 8, uri->string.size() - comma - 8, data))
+					return Fail("can't decode a data: buffer");
+			}
+			else if (!ReadWholeFile((directory / uri->string).string(), data))
+			{
+				std::cout << path << ": can't read buffer " << uri->string << std::endl;
+				return false;
+			}
+			if (data.size() < length)
+				return Fail("buffer is shorter than its byteLength");
+			bufferData.push_back(std::move(data));
+		}
+		return true;
+	}
+
+	// resolves accessor index to a pointer and stride, checking that every element is inside its buffer
+	bool GetAccessor(size_t index, Accessor& out)
+	{
+		const JsonValue* accessors = json.Get("accessors");
+		const JsonValue* accessor = accessors != nullptr ? accessors->At(index) : nullptr;
+		if (accessor == nullptr)
+			return Fail("accessor index out of range");
+		if (accessor->Get("sparse") != nullptr)
+			return Fail("sparse accessors aren't supported");
+		const JsonValue* type = accessor->Get("type");
+		std::string typeName = type != nullptr ? type->string : "";
+		out.components = typeName == "SCALAR" ? 1 : typeName == "VEC2" ? 2 : typeName == "VEC3" ? 3 : typeName == "VEC4" ? 4 : 0;
+		out.componentType = (int)accessor->NumberOr("componentType", 0);
+		out.count = (size_t)accessor->NumberOr("count", 0);
+		size_t componentSize = out.componentType == GltfUnsignedByte ? 1 : out.componentType == GltfUnsignedShort ? 2
+			: out.componentType == GltfUnsignedInt || out.componentType == GltfFloat ? 4 : 0;
+		if (out.components == 0 || componentSize == 0)
+			return Fail("accessor type isn't supported");
+
+		const JsonValue* views = json.Get("bufferViews");
+		const JsonValue* view = views != nullptr ? views->At((size_t)accessor->NumberOr("bufferView", -1)) : nullptr;
+		if (view == nullptr)
+			return Fail("accessor without a buffer view");
+		size_t bufferIndex = (size_t)view->NumberOr("buffer", -1);
+		if (bufferIndex >= bufferData.size())
+			return Fail("buffer view index out of range");
+		size_t viewOffset = (size_t)view->NumberOr("byteOffset", 0), viewLength = (size_t)view->NumberOr("byteLength", 0);
+		size_t elementSize = componentSize * out.components;
+		out.stride = (size_t)view->NumberOr("byteStride", 0);
+		if (out.stride == 0)
+			out.stride = elementSize;
+		size_t offset = (size_t)accessor->NumberOr("byteOffset", 0);
+		const std::string& buffer = bufferData[bufferIndex];
+		if (viewOffset + viewLength > buffer.size() || (out.count > 0 && offset + out.stride * (out.count - 1) + elementSize > viewLength))
+			return Fail("accessor reaches outside its buffer");
+		out.data = (const unsigned char*)buffer.data() + viewOffset + offset;
+		return true;
+	}
+
+	bool AddNode(const JsonValue& nodes, size_t index, const GltfMatrix& parent, int depth, IndexedMesh& mesh)
+	{
+		const JsonValue* node = nodes.At(index);
+		if (node == nullptr || depth > 64)
+			return Fail("bad node hierarchy");
+		GltfMatrix world = parent * NodeMatrix(*node);
+		if (const JsonValue* meshIndex = node->Get("mesh"))
+			if (!AddMesh((size_t)meshIndex->number, world, mesh))
+				return false;
+		if (const JsonValue* children = node->Get("children"))
+			for (const JsonValue& child : children->items)
+				if (!AddNode(nodes, (size_t)child.number, world, depth + 1, mesh))
+					return false;
+		return true;
+	}
+
+	bool AddMesh(size_t index, const GltfMatrix& world, IndexedMesh& mesh)
+	{
+		const JsonValue* meshes = json.Get("meshes");
+		const JsonValue* gltfMesh = meshes != nullptr ? meshes->At(index) : nullptr;
+		const JsonValue* primitives = gltfMesh != nullptr ? gltfMesh->Get("primitives") : nullptr;
+		if (primitives == nullptr)
+			return Fail("mesh index out of range");
+
+		// normals go through the inverse transpose of the upper 3x3: its columns are cross products of the
+		// matrix's columns (over the determinant, but they get normalized anyway, only its sign matters)
+		const float* m = world.m;
+		float c0[3] = { m[0], m[1], m[2] }, c1[3] = { m[4], m[5], m[6] }, c2[3] = { m[8], m[9], m[10] };
+		auto cross = [](const float* a, const float* b, float* out)
+		{
+			out[0] = a[1] * b[2] - a[2] * b[1];
+			out[1] = a[2] * b[0] - a[0] * b[2];
+			out[2] = a[0] * b[1] - a[1] * b[0];
+		};
+		float n0[3], n1[3], n2[3];
+		cross(c1, c2, n0);
+		cross(c2, c0, n1);
+		cross(c0, c1, n2);
+		float determinant = c0[0] * n0[0] + c0[1] * n0[1] + c0[2] * n0[2];
+		float sign = determinant < 0.0f ? -1.0f : 1.0f;
+		// most files have no transforms at all, their vertices go through bit for bit
+		static const GltfMatrix identity;
+		bool transformed = std::memcmp(world.m, identity.m, sizeof(world.m)) != 0;
+
+		for (const JsonValue& primitive : primitives->items)
+		{
+			if (primitive.NumberOr("mode", 4) != 4)
+			{
+				skippedPrimitives++;
+				continue;
+			}
+			const JsonValue* attributes = primitive.Get("attributes");
+			const JsonValue* position = attributes != nullptr ? attributes->Get("POSITION") : nullptr;
+			if (position == nullptr)
+				return Fail("primitive without POSITION");
+			Accessor positions, normals;
+			if (!GetAccessor((size_t)position->number, positions))
+				return false;
+			if (positions.componentType != GltfFloat || positions.components != 3)
+				return Fail("POSITION isn't float VEC3");
+			const JsonValue* normal = attributes->Get("NORMAL");
+			if (normal != nullptr)
+			{
+				if (!GetAccessor((size_t)normal->number, normals))
+					return false;
+				if (normals.componentType != GltfFloat || normals.components != 3 || normals.count != positions.count)
+					return Fail("NORMAL isn't float VEC3 for every vertex");
+			}
+
+			size_t base = mesh.VertexCount();
+			if (base + positions.count > 0xffffffffu)
+				return Fail("too many vertices for 32 bit indices");
+			// every vertex and every index on its own, so both loops are split across the pool
+			mesh.vertices.resize(mesh.vertices.size() + positions.count * FloatsPerVertex);
+			float* vertexOut = &mesh.vertices[base * FloatsPerVertex];
+			ParallelRanges(pool, positions.count, ParallelMinRange, [&](size_t begin, size_t end)
+			{
+				for (size_t v = begin; v < end; v++)
+				{
+					float p[3], n[3] = { 0.0f, 0.0f, 0.0f };
+					std::memcpy(p, positions.data + v * positions.stride, sizeof(p));
+					float* out = vertexOut + v * FloatsPerVertex;
+					out[0] = p[0];
+					out[1] = p[1];
+					out[2] = p[2];
+					if (transformed)
+						for (int row = 0; row < 3; row++)
+							out[row] = m[row] * p[0] + m[4 + row] * p[1] + m[8 + row] * p[2] + m[12 + row];
+					if (normals.data != nullptr)
+						std::memcpy(n, normals.data + v * normals.stride, sizeof(n));
+					if (normals.data != nullptr && transformed)
+					{
+						float t[3];
+						for (int row = 0; row < 3; row++)
+							t[row] = sign * (n0[row] * n[0] + n1[row] * n[1] + n2[row] * n[2]);
+						float length = std::sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+						for (int row = 0; row < 3; row++)
+							n[row] = length > 0.0f ? t[row] / length : 0.0f;
+					}
+					out[3] = n[0];
+					out[4] = n[1];
+					out[5] = n[2];
+				}
+			});
+
+			size_t firstIndex = mesh.indices.size();
+			const JsonValue* indices = primitive.Get("indices");
+			if (indices != nullptr)
+			{
+				Accessor accessor;
+				if (!GetAccessor((size_t)indices->number, accessor))
+					return false;
+				if (accessor.components != 1 || accessor.componentType == GltfFloat)
+					return Fail("indices aren't unsigned integers");
+				mesh.indices.resize(firstIndex + accessor.count / 3 * 3);
+				GLuint* indexOut = &mesh.indices[firstIndex];
+				std::atomic<bool> outOfRange(false);
+				ParallelRanges(pool, accessor.count / 3 * 3, ParallelMinRange, [&](size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; i++)
+					{
+						const unsigned char* element = accessor.data + i * accessor.stride;
+						uint32_t value = 0;
+						if (accessor.componentType == GltfUnsignedByte)
+							value = *element;
+						else if (accessor.componentType == GltfUnsignedShort)
+						{
+							uint16_t shortValue;
+							std::memcpy(&shortValue, element, 2);
+							value = shortValue;
+						}
+						else
+							std::memcpy(&value, element, 4);
+						if (value >= positions.count)
+						{
+							outOfRange = true;
+							return;
+						}
+						indexOut[i] = (GLuint)(base + value);
+					}
+				});
+				if (outOfRange)
+					return Fail("index out of range");
+			}
+			else
+			{
+				for (size_t v = 0; v + 2 < positions.count; v += 3)
+					mesh.indices.insert(mesh.indices.end(), { (GLuint)(base + v), (GLuint)(base + v + 1), (GLuint)(base + v + 2) });
+			}
+			// a mirroring transform turns the triangles inside out, the spec says to flip them back
+			if (determinant < 0.0f)
+				for (size_t t = firstIndex; t + 2 < mesh.indices.size(); t += 3)
+					std::swap(mesh.indices[t + 1], mesh.indices[t + 2]);
+		}
+		return true;
+	}
+
+	std::string path;
+	std::string file;
+	const char* glbBinary = nullptr;
+	size_t glbBinaryLength = 0;
+	JsonValue json;
+	std::vector<std::string> bufferData;
+	int skippedPrimitives = 0;
+	ThreadPool& pool;
+};
+
+bool ParseGLTF(const std::string& path, IndexedMesh& mesh, ThreadPool& pool)
+{
+	GltfReader reader(pool);
+	return reader.Load(path, mesh);
+}
+
+// ---------------------------------------------------------------------------------------------------- cache
+
+static size_t AlignUp(size_t value)
+{
+	return (value + MeshCacheAlignment - 1) / MeshCacheAlignment * MeshCacheAlignment;
+}
+
+// the source file's size and modification time
+static bool SourceStamp(const std::string& path, uint64_t& size, int64_t& time)
+{
+	std::error_code error;
+	size = (uint64_t)std::filesystem::file_size(path, error);
+	if (error)
+		return false;
+	auto written = std::filesystem::last_write_time(path, error);
+	if (error)
+		return false;
+	time = (int64_t)written.time_since_epoch().count();
+	return true;
+}
+
+// one cache file per source file (by absolute path), variant and vertex format: name_<path hash>_<variant>_<format>.glmc
+static std::string CachePathFor(const std::string& cacheDir, const std::string& path, uint32_t variant, VertexFormat format)
+{
+	std::error_code error;
+	std::string absolute = std::filesystem::absolute(path, error).string();
+	uint64_t hash = 14695981039346656037ull;
+	for (char c : absolute)
+	{
+		hash ^= (unsigned char)c;
+		hash *= 1099511628211ull;
+	}
+	char name[64];
+	std::snprintf(name, sizeof(name), "_%016llx_%u_%s.glmc", (unsigned long long)hash, variant, VertexFormatName(format));
+	return (std::filesystem::path(cacheDir) / (std::filesystem::path(path).stem().string() + name)).string();
+}
+
+// maps the cache file and points asset at its arrays, if it's there and belongs to this exact source
+static bool MapCache(const std::string& cachePath, uint64_t sourceSize, int64_t sourceTime, uint32_t variant, VertexFormat format,
+	MeshAsset& asset)
+{
+	MappedFile mapped;
+	if (!mapped.Open(cachePath) || mapped.Size() < sizeof(MeshCacheHeader))
+		return false;
+	MeshCacheHeader header;
+	std::memcpy(&header, mapped.Data(), sizeof(header));
+	if (std::memcmp(header.magic, "GLMC", 4) != 0 || header.fileVersion != MeshCacheFileVersion
+		|| header.sourceSize != sourceSize || header.sourceTime != sourceTime || header.variant != variant
+		|| header.requestedFormat != (uint32_t)format || header.vertexFormat >= (uint32_t)VertexFormat::Auto)
+		return false;
+	VertexEncoding encoding = MakeVertexEncoding((VertexFormat)header.vertexFormat, header.boundsMin, header.boundsMax);
+	if (header.vertexStride != (uint32_t)encoding.layout.Stride())
+		return false;
+	// the sizes have to fit the file. The index VALUES aren't checked, that would be a pass over all of them:
+	// the file is only ever written whole (temporary + rename), so they're as good as when they were written
+	uint64_t vertexBytes = header.vertexCount * header.vertexStride;
+	uint64_t indexBytes = header.indexCount * sizeof(GLuint);
+	if (header.vertexOffset % MeshCacheAlignment != 0 || header.indexOffset % MeshCacheAlignment != 0
+		|| header.vertexOffset + vertexBytes > mapped.Size() || header.indexOffset + indexBytes > mapped.Size()
+		|| header.vertexCount > 0xffffffffu)
+		return false;
+
+	asset.vertexData = mapped.Data() + header.vertexOffset;
+	asset.vertices = encoding.format == VertexFormat::Float ? (const float*)asset.vertexData : nullptr;
+	asset.encoding = encoding;
+	asset.indices = (const GLuint*)(mapped.Data() + header.indexOffset);
+	asset.vertexCount = (size_t)header.vertexCount;
+	asset.indexCount = (size_t)header.indexCount;
+	asset.floatsPerVertex = FloatsPerVertex;
+	std::memcpy(asset.boundsMin, header.boundsMin, sizeof(header.boundsMin));
+	std::memcpy(asset.boundsMax, header.boundsMax, sizeof(header.boundsMax));
+	asset.mapped = std::move(mapped);
+	return true;
+}
+
+static bool WriteCache(const std::string& cachePath, const MeshCacheHeader& header, const void* vertexData, const IndexedMesh& mesh)
+{
+	std::error_code error;
+	std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), error);
+
+	// write to a temporary file and rename it into place, so a crash halfway never leaves a broken cache file
+	std::string temporary = cachePath + ".tmp";
+	{
+		std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+		static const char zeros[MeshCacheAlignment] = {};
+		file.write((const char*)&header, sizeof(header));
+		file.write(zeros, header.vertexOffset - sizeof(header));
+		size_t vertexBytes = (size_t)(header.vertexCount * header.vertexStride);
+		file.write((const char*)vertexData, vertexBytes);
+		file.write(zeros, header.indexOffset - header.vertexOffset - vertexBytes);
+		file.write((const char*)mesh.indices.data(), mesh.indices.size() * sizeof(GLuint));
+		if (!file)
+		{
+			std::cout << "Can't write mesh cache file " << temporary << std::endl;
+			file.close();
+			std::filesystem::remove(temporary, error);
+			return false;
+		}
+	}
+	std::filesystem::rename(temporary, cachePath, error);
+	if (error)
+	{
+		std::filesystem::remove(temporary, error);
+		return false;
+	}
+	return true;
+}
+
+void EncodeMeshVertices(MeshAsset& asset, VertexFormat format)
+{
+	if (format == VertexFormat::Auto)
+		format = ChooseVertexFormat(asset.vertices, asset.vertexCount, asset.indices, asset.indexCount, asset.boundsMin, asset.boundsMax);
+	asset.encoding = MakeVertexEncoding(format, asset.boundsMin, asset.boundsMax);
+	asset.packed.clear();
+	if (asset.encoding.format == VertexFormat::Float)
+	{
+		asset.vertexData = asset.vertices;
+		return;
+	}
+	auto start = std::chrono::steady_clock::now();
+	asset.packed = EncodeVertices(asset.encoding, asset.vertices, asset.vertexCount);
+	asset.vertexData = asset.packed.data();
+	asset.times.encodeMs = MillisecondsSince(start);
+}
+
+bool LoadMesh(const std::string& path, const std::string& cacheDir, int threads, uint32_t variant, VertexFormat format,
+	const std::function<void(IndexedMesh&)>& prepare, MeshAsset& asset)
+{
+	uint64_t sourceSize = 0;
+	int64_t sourceTime = 0;
+	if (!SourceStamp(path, sourceSize, sourceTime))
+	{
+		std::cout << "Can't find mesh file " << path << std::endl;
+		return false;
+	}
+
+	// the fast way: a cache file from an earlier run
+	if (!cacheDir.empty())
+	{
+		asset.cachePath = CachePathFor(cacheDir, path, variant, format);
+		auto start = std::chrono::steady_clock::now();
+		bool mapped = MapCache(asset.cachePath, sourceSize, sourceTime, variant, format, asset);
+		asset.times.mapMs = MillisecondsSince(start);
+		if (mapped)
+		{
+			asset.fromCache = true;
+			return true;
+		}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::string extension = LowerExtension(path);
+	bool parsed = false;
+	ThreadPool pool(threads);
+	asset.times.parseThreads = pool.Threads();
+	if (extension == ".obj")
+		parsed = ParseOBJ(path, asset.mesh, pool);
+	else if (extension == ".gltf" || extension == ".glb")
+		parsed = ParseGLTF(path, asset.mesh, pool);
+	else
+		std::cout << path << ": unknown mesh format (.obj, .gltf and .glb are supported)" << std::endl;
+	if (!parsed)
+		return false;
+	asset.times.parseMs = MillisecondsSince(start);
+
+	if (prepare)
+	{
+		start = std::chrono::steady_clock::now();
+		prepare(asset.mesh);
+		asset.times.prepareMs = MillisecondsSince(start);
+	}
+
+	IndexedMesh& mesh = asset.mesh;
+	asset.vertices = mesh.vertices.data();
+	asset.indices = mesh.indices.data();
+	asset.vertexCount = mesh.VertexCount();
+	asset.indexCount = mesh.indices.size();
+	asset.floatsPerVertex = FloatsPerVertex;
+	for (int k = 0; k < 3; k++)
+	{
+		asset.boundsMin[k] = asset.vertexCount > 0 ? mesh.vertices[k] : 0.0f;
+		asset.boundsMax[k] = asset.boundsMin[k];
+	}
+	for (size_t v = 0; v < asset.vertexCount; v++)
+	{
+		for (int k = 0; k < 3; k++)
+		{
+			float value = mesh.vertices[v * FloatsPerVertex + k];
+			asset.boundsMin[k] = value < asset.boundsMin[k] ? value : asset.boundsMin[k];
+			asset.boundsMax[k] = value > asset.boundsMax[k] ? value : asset.boundsMax[k];
+		}
+	}
+	// packed once here, so a later load maps the packed vertices and has nothing left to do
+	EncodeMeshVertices(asset, format);
+
+	if (!cacheDir.empty())
+	{
+		start = std::chrono::steady_clock::now();
+		MeshCacheHeader header = {};
+		std::memcpy(header.magic, "GLMC", 4);
+		header.fileVersion = MeshCacheFileVersion;
+		header.sourceSize = sourceSize;
+		header.sourceTime = sourceTime;
+		header.variant = variant;
+		header.requestedFormat = (uint32_t)format;
+		header.vertexFormat = (uint32_t)asset.encoding.format;
+		header.vertexStride = (uint32_t)asset.encoding.layout.Stride();
+		header.vertexCount = asset.vertexCount;
+		header.indexCount = asset.indexCount;
+		header.vertexOffset = AlignUp(sizeof(MeshCacheHeader));
+		header.indexOffset = AlignUp(header.vertexOffset + asset.vertexCount * header.vertexStride);
+		std::memcpy(header.boundsMin, asset.boundsMin, sizeof(header.boundsMin));
+		std::memcpy(header.boundsMax, asset.boundsMax, sizeof(header.boundsMax));
+		WriteCache(asset.cachePath, header, asset.vertexData, mesh);
+		asset.times.writeMs = MillisecondsSince(start);
+	}
+	return true;
+}
+
+// ---------------------------------------------------------------------------------------------------- writing
+
+static bool SaveOBJ(const std::string& path, const IndexedMesh& mesh)
+{
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (file == nullptr)
+		return false;
+	std::fprintf(file, "# %zu vertices, %zu triangles\n", mesh.VertexCount(), mesh.TriangleCount());
+	// 9 significant digits: every float reads back as the exact same float
+	for (size_t v = 0; v < mesh.VertexCount(); v++)
+	{
+		const float* vertex = &mesh.vertices[v * mesh.floatsPerVertex];
+		std::fprintf(file, "v %.9g %.9g %.9g\n", vertex[0], vertex[1], vertex[2]);
+	}
+	for (size_t v = 0; v < mesh.VertexCount(); v++)
+	{
+		const float* vertex = &mesh.vertices[v * mesh.floatsPerVertex];
+		std::fprintf(file, "vn %.9g %.9g %.9g\n", vertex[3], vertex[4], vertex[5]);
+	}
+	for (size_t t = 0; t + 2 < mesh.indices.size(); t += 3)
+	{
+		unsigned a = mesh.indices[t] + 1, b = mesh.indices[t + 1] + 1, c = mesh.indices[t + 2] + 1;
+		std::fprintf(file, "f %u//%u %u//%u %u//%u\n", a, a, b, b, c, c);
+	}
+	return std::fclose(file) == 0;
+}
+
+// one interleaved vertex buffer view (position, normal) and one index view, in a .bin next to the .gltf
+static bool SaveGLTF(const std::string& path, const IndexedMesh& mesh)
+{
+	std::filesystem::path binPath = std::filesystem::path(path).replace_extension(".bin");
+	size_t vertexBytes = mesh.vertices.size() * sizeof(float), indexBytes = mesh.indices.size() * sizeof(GLuint);
+	{
+		std::ofstream bin(binPath, std::ios::binary | std::ios::trunc);
+		bin.write((const char*)mesh.vertices.data(), vertexBytes);
+		bin.write((const char*)mesh.indices.data(), indexBytes);
+		if (!bin)
+			return false;
+	}
+
+	float low[3] = { 0, 0, 0 }, high[3] = { 0, 0, 0 };
+	for (size_t v = 0; v < mesh.VertexCount(); v++)
+		for (int k = 0; k < 3; k++)
+		{
+			float value = mesh.vertices[v * mesh.floatsPerVertex + k];
+			low[k] = v == 0 || value < low[k] ? value : low[k];
+			high[k] = v == 0 || value > high[k] ? value : high[k];
+		}
+
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (file == nullptr)
+		return false;
+	std::fprintf(file,
+		"{\n"
+		"  \"asset\": { \"version\": \"2.0\", \"generator\": \"OpenGLYoutube\" },\n"
+		"  \"scene\": 0,\n"
+		"  \"scenes\": [ { \"nodes\": [ 0 ] } ],\n"
+		"  \"nodes\": [ { \"mesh\": 0 } ],\n"
+		"  \"meshes\": [ { \"primitives\": [ { \"attributes\": { \"POSITION\": 0, \"NORMAL\": 1 }, \"indices\": 2 } ] } ],\n"
+		"  \"buffers\": [ { \"uri\": \"%s\", \"byteLength\": %zu } ],\n"
+		"  \"bufferViews\": [\n"
+		"    { \"buffer\": 0, \"byteOffset\": 0, \"byteLength\": %zu, \"byteStride\": %zu, \"target\": 34962 },\n"
+		"    { \"buffer\": 0, \"byteOffset\": %zu, \"byteLength\": %zu, \"target\": 34963 }\n"
+		"  ],\n"
+		"  \"accessors\": [\n"
+		"    { \"bufferView\": 0, \"byteOffset\": 0, \"componentType\": 5126, \"count\": %zu, \"type\": \"VEC3\", \"min\": [ %.9g, %.9g, %.9g ], \"max\": [ %.9g, %.9g, %.9g ] },\n"
+		"    { \"bufferView\": 0, \"byteOffset\": 12, \"componentType\": 5126, \"count\": %zu, \"type\": \"VEC3\" },\n"
+		"    { \"bufferView\": 1, \"byteOffset\": 0, \"componentType\": 5125, \"count\": %zu, \"type\": \"SCALAR\" }\n"
+		"  ]\n"
+		"}\n",
+		binPath.filename().string().c_str(), vertexBytes + indexBytes, vertexBytes, mesh.floatsPerVertex * sizeof(float),
+		vertexBytes, indexBytes, mesh.VertexCount(), low[0], low[1], low[2], high[0], high[1], high[2],
+		mesh.VertexCount(), mesh.indices.size());
+	return std::fclose(file) == 0;
+}
+
+bool SaveMesh(const std::string& path, const IndexedMesh& mesh)
+{
+	if (mesh.floatsPerVertex != FloatsPerVertex)
+		return false;
+	std::string extension = LowerExtension(path);
+	bool saved = extension == ".gltf" ? SaveGLTF(path, mesh) : extension == ".obj" ? SaveOBJ(path, mesh) : false;
+	if (!saved)
+		std::cout << "Can't write mesh " << path << " (.obj or .gltf)" << std::endl;
+	return saved;
+}
@@ -0,0 +1,108 @@
+#ifndef MESH_LOADER_CLASS_H
+#define MESH_LOADER_CLASS_H
+
+#include<cstdint>
+#include<functional>
+#include<string>
+#include<vector>
+#include<glad/glad.h>
+#include"MappedFile.h"
+#include"MeshOptimizer.h"
+#include"ThreadPool.h"
+#include"VertexFormat.h"
+
+// * NOTE: mesh files from disk. Two ways in:
+//   text:   OBJ or glTF 2.0 (.gltf + .bin / data URIs, or .glb) parsed into unique vertices + indices on a thread
+//           pool (the OBJ text in chunks, see ParseOBJ), then whatever the caller wants done to them
+//           (optimizations), then written to the binary cache
+//   binary: the cache file from an earlier run. It's mapped into memory and the vertex and index arrays are
+//           used right where they are in the mapping: no parsing, no copies, straight into glBufferData
+//
+// Every vertex is position + normal (6 floats), what MeshScene draws. Meshes without normals get smooth ones
+// computed from their triangles. Texture coordinates and materials are skipped. The vertex buffer can be packed
+// smaller (VertexFormat.h): the cache file then holds the packed vertices, ready for glBufferData, instead of floats.
+//
+// Cache file (.glmc), little endian, everything at offsets that are multiples of MeshCacheAlignment:
+//   MeshCacheHeader, padding, vertexCount * vertexStride bytes of vertices, padding, indexCount uint32 indices
+// It's only used when the version, the source file's size and modification time, the caller's variant and the
+// requested vertex format all match, otherwise the source is parsed again and the cache rewritten
+
+const uint32_t MeshCacheFileVersion = 2;
+// one cache line: the arrays start on one, and anything (SIMD loads, the driver's copy) gets aligned data
+const size_t MeshCacheAlignment = 64;
+
+struct MeshCacheHeader
+{
+	char magic[4];            // "GLMC"
+	uint32_t fileVersion;     // MeshCacheFileVersion, bump when the layout changes
+	uint64_t sourceSize;      // the source file when the cache was written, a different one = stale cache
+	int64_t sourceTime;
+	uint32_t variant;         // what the caller did to the mesh after parsing (MeshScene: the --mesh-opt level)
+	uint32_t requestedFormat; // the VertexFormat asked for, Auto included
+	uint32_t vertexFormat;    // what the vertices are stored as (Auto picked one), the encoding is remade from the bounds
+	uint32_t vertexStride;    // bytes per vertex
+	uint64_t vertexCount;
+	uint64_t indexCount;
+	uint64_t vertexOffset;    // from the start of the file
+	uint64_t indexOffset;
+	float boundsMin[3];
+	float boundsMax[3];
+};
+
+// how long each step of LoadMesh took, 0 for the ones that didn't run
+struct MeshLoadTimes
+{
+	double parseMs = 0.0;    // text parse, including dedup and normals
+	int parseThreads = 0;    // threads it ran on
+	double prepareMs = 0.0;  // the caller's prepare step
+	double encodeMs = 0.0;   // packing the floats into the vertex format (0 for float, or when it came packed from the cache)
+	double writeMs = 0.0;    // writing the cache
+	double mapMs = 0.0;      // opening, mapping and checking the cache
+	double TotalMs() const { return parseMs + prepareMs + encodeMs + writeMs + mapMs; }
+};
+
+// a loaded mesh. The arrays point either into the mapped cache file or into mesh / packed, whichever it came from
+struct MeshAsset
+{
+	// position + normal floats. nullptr when a cache file of packed vertices was loaded: only vertexData is there then
+	const float* vertices = nullptr;
+	// the vertex buffer's contents, vertexCount * encoding.layout.Stride() bytes: the floats, or them packed
+	const void* vertexData = nullptr;
+	VertexEncoding encoding;
+	const GLuint* indices = nullptr;
+	size_t vertexCount = 0;
+	size_t indexCount = 0;
+	int floatsPerVertex = 6;
+	float boundsMin[3] = { 0.0f, 0.0f, 0.0f };
+	float boundsMax[3] = { 0.0f, 0.0f, 0.0f };
+
+	bool fromCache = false;
+	std::string cachePath;
+	MeshLoadTimes times;
+
+	// storage behind the pointers
+	MappedFile mapped;
+	IndexedMesh mesh;
+	std::vector<unsigned char> packed;
+};
+
+// packs asset's float vertices into format (Auto = picked for the mesh, see ChooseVertexFormat) and points vertexData
+// at them. Float just points it at the floats. Needs the vertices and the bounds filled in
+void EncodeMeshVertices(MeshAsset& asset, VertexFormat format);
+
+// loads path (.obj, .gltf or .glb) through the cache in cacheDir (empty = no cache, always parse), parsing with
+// threads threads (0 = one per hardware thread). prepare runs on freshly parsed meshes only, variant tells cache
+// files written after different prepare steps apart. The vertices come in format (and are cached that way), so
+// asset.vertices is only there for Float. Prints what went wrong and returns false on failure
+bool LoadMesh(const std::string& path, const std::string& cacheDir, int threads, uint32_t variant, VertexFormat format,
+	const std::function<void(IndexedMesh&)>& prepare, MeshAsset& asset);
+
+// the text parsers on their own: unique position + normal vertices and triangle indices, numbered in order of
+// first use in the file. The thread count doesn't change the result, down to the bit
+bool ParseOBJ(const std::string& path, IndexedMesh& mesh, ThreadPool& pool);
+bool ParseGLTF(const std::string& path, IndexedMesh& mesh, ThreadPool& pool);
+
+// writes a position + normal mesh as .obj, or as .gltf with a .bin next to it (picked by the extension)
+bool SaveMesh(const std::string& path, const IndexedMesh& mesh);
+
+#endif
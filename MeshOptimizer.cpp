@@ -0,0 +1,321 @@
+#include"MeshOptimizer.h"
+
+#include<algorithm>
+#include<cmath>
+#include<cstdint>
+#include<cstring>
+
+static const GLuint NoVertex = 0xffffffffu;
+
+// FNV-1a over the floats' bits, with a final mix so the low bits (the table slot) depend on everything
+static uint32_t HashVertex(const float* vertex, int floats)
+{
+	uint32_t hash = 2166136261u;
+	for (int i = 0; i < floats; i++)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &vertex[i], sizeof(bits));
+		hash = (hash ^ bits) * 16777619u;
+	}
+	hash ^= hash >> 15;
+	hash *= 0x2c1b3c6du;
+	hash ^= hash >> 12;
+	return hash;
+}
+
+IndexedMesh IndexVertices(const float* soup, size_t vertexCount, int floatsPerVertex)
+{
+	IndexedMesh mesh;
+	mesh.floatsPerVertex = floatsPerVertex;
+	mesh.indices.resize(vertexCount);
+	mesh.vertices.reserve(vertexCount * floatsPerVertex);
+
+	// open addressing hash table of unique vertex indices, at most half full so probes stay short
+	size_t tableSize = 16;
+	while (tableSize < vertexCount * 2)
+		tableSize *= 2;
+	std::vector<GLuint> table(tableSize, NoVertex);
+	size_t mask = tableSize - 1;
+	size_t vertexBytes = floatsPerVertex * sizeof(float);
+
+	for (size_t v = 0; v < vertexCount; v++)
+	{
+		const float* vertex = soup + v * floatsPerVertex;
+		size_t slot = HashVertex(vertex, floatsPerVertex) & mask;
+		for (;;)
+		{
+			GLuint unique = table[slot];
+			if (unique == NoVertex)
+			{
+				unique = (GLuint)mesh.VertexCount();
+				mesh.vertices.insert(mesh.vertices.end(), vertex, vertex + floatsPerVertex);
+				table[slot] = unique;
+			}
+			else if (std::memcmp(&mesh.vertices[(size_t)unique * floatsPerVertex], vertex, vertexBytes) != 0)
+			{
+				slot = (slot + 1) & mask;
+				continue;
+			}
+			mesh.indices[v] = unique;
+			break;
+		}
+	}
+	return mesh;
+}
+
+// * NOTE: a FIFO cache of size k is simulated with one timestamp per vertex: every miss pushes the vertex in and
+// bumps the clock, so a vertex is still in the cache while fewer than k misses happened after it went in
+
+VertexCacheStats SimulateVertexCache(const std::vector<GLuint>& indices, size_t vertexCount, int cacheSize)
+{
+	VertexCacheStats stats;
+	if (indices.empty() || vertexCount == 0)
+		return stats;
+
+	std::vector<unsigned> cacheTime(vertexCount, 0);
+	unsigned time = cacheSize + 1;
+	size_t misses = 0;
+	for (GLuint index : indices)
+	{
+		if (time - cacheTime[index] > (unsigned)cacheSize)
+		{
+			cacheTime[index] = time++;
+			misses++;
+		}
+	}
+	stats.acmr = (double)misses / (indices.size() / 3);
+	stats.atvr = (double)misses / vertexCount;
+	return stats;
+}
+
+void OptimizeVertexCache(std::vector<GLuint>& indices, size_t vertexCount, int cacheSize)
+{
+	size_t triangleCount = indices.size() / 3;
+	if (triangleCount == 0)
+		return;
+
+	// which triangles use each vertex (offsets into one flat array), and how many of them aren't emitted yet
+	std::vector<unsigned> live(vertexCount, 0);
+	for (GLuint index : indices)
+		live[index]++;
+	std::vector<size_t> offsets(vertexCount + 1, 0);
+	for (size_t v = 0; v < vertexCount; v++)
+		offsets[v + 1] = offsets[v] + live[v];
+	std::vector<unsigned> adjacency(indices.size());
+	{
+		std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+		for (size_t i = 0; i < indices.size(); i++)
+			adjacency[fill[indices[i]]++] = (unsigned)(i / 3);
+	}
+
+	std::vector<unsigned> cacheTime(vertexCount, 0);
+	std::vector<char> emitted(triangleCount, 0);
+	// vertices of recently emitted triangles, where to continue when the fan runs out (likely still cached)
+	std::vector<GLuint> deadEnds;
+	std::vector<GLuint> candidates;
+	std::vector<GLuint> result;
+	result.reserve(indices.size());
+
+	unsigned time = cacheSize + 1;
+	size_t cursor = 0;
+	GLuint fan = indices[0];
+	while (fan != NoVertex)
+	{
+		// emit every triangle around the fanning vertex that isn't out yet
+		candidates.clear();
+		for (size_t k = offsets[fan]; k < offsets[fan + 1]; k++)
+		{
+			unsigned triangle = adjacency[k];
+			if (emitted[triangle])
+				continue;
+			for (int c = 0; c < 3; c++)
+			{
+				GLuint v = indices[(size_t)triangle * 3 + c];
+				result.push_back(v);
+				deadEnds.push_back(v);
+				candidates.push_back(v);
+				live[v]--;
+				if (time - cacheTime[v] > (unsigned)cacheSize)
+					cacheTime[v] = time++;
+			}
+			emitted[triangle] = 1;
+		}
+
+		// next fan: the candidate that will still be in the cache after its own triangles went through it,
+		// the oldest of those (it's the first to fall out)
+		fan = NoVertex;
+		int bestPriority = -1;
+		for (GLuint v : candidates)
+		{
+			if (live[v] == 0)
+				continue;
+			int priority = 0;
+			if (time - cacheTime[v] + 2 * live[v] <= (unsigned)cacheSize)
+				priority = (int)(time - cacheTime[v]);
+			if (priority > bestPriority)
+			{
+				bestPriority = priority;
+				fan = v;
+			}
+		}
+
+		// dead end: back up through the recent vertices, then scan for anything left
+		while (fan == NoVertex && !deadEnds.empty())
+		{
+			GLuint v = deadEnds.back();
+			deadEnds.pop_back();
+			if (live[v] > 0)
+				fan = v;
+		}
+		while (fan == NoVertex && cursor < vertexCount)
+		{
+			if (live[cursor] > 0)
+				fan = (GLuint)cursor;
+			cursor++;
+		}
+	}
+
+	indices.swap(result);
+}
+
+// cache misses of one triangle, on the caller's FIFO clock
+static int TriangleMisses(const GLuint* triangle, std::vector<unsigned>& cacheTime, unsigned& time, int cacheSize)
+{
+	int misses = 0;
+	for (int c = 0; c < 3; c++)
+	{
+		if (time - cacheTime[triangle[c]] > (unsigned)cacheSize)
+		{
+			cacheTime[triangle[c]] = time++;
+			misses++;
+		}
+	}
+	return misses;
+}
+
+void OptimizeOverdraw(IndexedMesh& mesh, float threshold, int cacheSize)
+{
+	size_t triangleCount = mesh.TriangleCount();
+	if (triangleCount == 0)
+		return;
+	const GLuint* indices = mesh.indices.data();
+	std::vector<unsigned> cacheTime(mesh.VertexCount(), 0);
+	unsigned time = cacheSize + 1;
+
+	// hard boundaries: where the cache order starts over (a triangle with no cached vertex at all).
+	// Clusters can be moved around freely there without losing anything
+	std::vector<size_t> hard;
+	for (size_t t = 0; t < triangleCount; t++)
+		if (TriangleMisses(indices + t * 3, cacheTime, time, cacheSize) == 3 || t == 0)
+			hard.push_back(t);
+	hard.push_back(triangleCount);
+
+	// soft boundaries: split each hard cluster further wherever the piece so far is already within threshold of
+	// the whole cluster's ACMR (cutting there costs little). Every cluster starts with a cold cache
+	std::vector<size_t> clusters;
+	for (size_t h = 0; h + 1 < hard.size(); h++)
+	{
+		size_t start = hard[h], end = hard[h + 1];
+		time += cacheSize + 1;
+		int clusterMisses = 0;
+		for (size_t t = start; t < end; t++)
+			clusterMisses += TriangleMisses(indices + t * 3, cacheTime, time, cacheSize);
+		double limit = threshold * (double)clusterMisses / (end - start);
+
+		time += cacheSize + 1;
+		clusters.push_back(start);
+		size_t pieceStart = start;
+		int pieceMisses = 0;
+		for (size_t t = start; t < end; t++)
+		{
+			pieceMisses += TriangleMisses(indices + t * 3, cacheTime, time, cacheSize);
+			if (t + 1 < end && pieceMisses <= limit * (t + 1 - pieceStart))
+			{
+				clusters.push_back(t + 1);
+				pieceStart = t + 1;
+				pieceMisses = 0;
+				time += cacheSize + 1;
+			}
+		}
+	}
+	clusters.push_back(triangleCount);
+
+	// sort key per cluster: how far its (area weighted) center sits out along its average normal, seen from the
+	// mesh's center. Outward facing clusters on the outside hide the rest, so they go first
+	auto position = [&mesh](GLuint v) { return &mesh.vertices[(size_t)v * mesh.floatsPerVertex]; };
+	struct Cluster
+	{
+		size_t start, end;
+		double center[3] = { 0.0, 0.0, 0.0 };
+		double normal[3] = { 0.0, 0.0, 0.0 };
+		double area = 0.0;
+		double key = 0.0;
+	};
+	std::vector<Cluster> sorted(clusters.size() - 1);
+	double meshCenter[3] = { 0.0, 0.0, 0.0 };
+	double meshArea = 0.0;
+	for (size_t c = 0; c + 1 < clusters.size(); c++)
+	{
+		Cluster& cluster = sorted[c];
+		cluster.start = clusters[c];
+		cluster.end = clusters[c + 1];
+		for (size_t t = cluster.start; t < cluster.end; t++)
+		{
+			const float* a = position(indices[t * 3 + 0]);
+			const float* b = position(indices[t * 3 + 1]);
+			const float* d = position(indices[t * 3 + 2]);
+			double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+			double e2[3] = { d[0] - a[0], d[1] - a[1], d[2] - a[2] };
+			// the cross product's length is twice the area, so summing it is an area weighted normal
+			double n[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+			double area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) * 0.5;
+			for (int i = 0; i < 3; i++)
+			{
+				cluster.normal[i] += n[i];
+				cluster.center[i] += area * (a[i] + b[i] + d[i]) / 3.0;
+			}
+			cluster.area += area;
+		}
+		for (int i = 0; i < 3; i++)
+			meshCenter[i] += cluster.center[i];
+		meshArea += cluster.area;
+	}
+	if (meshArea > 0.0)
+		for (int i = 0; i < 3; i++)
+			meshCenter[i] /= meshArea;
+
+	for (Cluster& cluster : sorted)
+	{
+		double length = std::sqrt(cluster.normal[0] * cluster.normal[0] + cluster.normal[1] * cluster.normal[1] + cluster.normal[2] * cluster.normal[2]);
+		if (cluster.area <= 0.0 || length <= 0.0)
+			continue;
+		for (int i = 0; i < 3; i++)
+			cluster.key += (cluster.center[i] / cluster.area - meshCenter[i]) * cluster.normal[i] / length;
+	}
+	std::stable_sort(sorted.begin(), sorted.end(), [](const Cluster& a, const Cluster& b) { return a.key > b.key; });
+
+	std::vector<GLuint> result;
+	result.reserve(mesh.indices.size());
+	for (const Cluster& cluster : sorted)
+		result.insert(result.end(), indices + cluster.start * 3, indices + cluster.end * 3);
+	mesh.indices.swap(result);
+}
+
+void OptimizeVertexFetch(IndexedMesh& mesh)
+{
+	std::vector<GLuint> remap(mesh.VertexCount(), NoVertex);
+	GLuint next = 0;
+	for (GLuint& index : mesh.indices)
+	{
+		if (remap[index] == NoVertex)
+			remap[index] = next++;
+		index = remap[index];
+	}
+
+	std::vector<float> vertices((size_t)next * mesh.floatsPerVertex);
+	size_t vertexBytes = mesh.floatsPerVertex * sizeof(float);
+	for (size_t v = 0; v < remap.size(); v++)
+		if (remap[v] != NoVertex)
+			std::memcpy(&vertices[(size_t)remap[v] * mesh.floatsPerVertex], &mesh.vertices[v * mesh.floatsPerVertex], vertexBytes);
+	mesh.vertices.swap(vertices);
+}
@@ -0,0 +1,62 @@
+#ifndef MESH_OPTIMIZER_CLASS_H
+#define MESH_OPTIMIZER_CLASS_H
+
+#include<cstddef>
+#include<vector>
+#include<glad/glad.h>
+
+// * NOTE: the GPU doesn't run the vertex shader once per INDEX. Recently transformed vertices sit in a small
+// post-transform cache, and an index that hits the cache reuses the result. So the same indexed mesh can cost
+// anywhere from ~0.5 to 3 vertex shader runs per triangle depending on the ORDER of its triangles.
+//   IndexVertices:       triangle soup (every triangle has its own 3 vertices, what glDrawArrays needs) ->
+//                        unique vertices + an index buffer
+//   OptimizeVertexCache: reorders the triangles so neighbours come one after another (Tipsify, Sander, Nehab &
+//                        Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw", 2007)
+//   OptimizeOverdraw:    cuts the cache-ordered triangles into clusters and draws the outward facing clusters
+//                        first, so the depth test rejects more of what's drawn later (same paper), while keeping
+//                        most of the cache order
+//   OptimizeVertexFetch: renumbers the vertices in the order the indices first use them, so the vertex fetches
+//                        walk through memory instead of jumping around
+//
+// ACMR (average cache miss ratio) = vertex shader runs per triangle, through a simulated FIFO cache.
+// 3 is the worst case (nothing shared), ~0.5 is as good as a regular grid gets.
+// ATVR = vertex shader runs per unique vertex, 1 is the best possible
+
+// the post-transform cache size the optimizers and ACMR assume. Real ones are roughly this size or bigger
+const int DefaultVertexCacheSize = 16;
+
+// vertices: floatsPerVertex floats each, the first three are the position
+struct IndexedMesh
+{
+	std::vector<float> vertices;
+	std::vector<GLuint> indices;
+	int floatsPerVertex = 3;
+
+	size_t VertexCount() const { return vertices.size() / floatsPerVertex; }
+	size_t TriangleCount() const { return indices.size() / 3; }
+};
+
+struct VertexCacheStats
+{
+	double acmr = 0.0;
+	double atvr = 0.0;
+};
+
+// merges vertices whose floats are bit-for-bit equal. Vertex order is first appearance, so the indices are 0..n
+// in soup order
+IndexedMesh IndexVertices(const float* soup, size_t vertexCount, int floatsPerVertex);
+
+// simulates a FIFO post-transform cache of cacheSize entries over the indices
+VertexCacheStats SimulateVertexCache(const std::vector<GLuint>& indices, size_t vertexCount, int cacheSize = DefaultVertexCacheSize);
+
+// Tipsify: linear time triangle reordering for the post-transform cache
+void OptimizeVertexCache(std::vector<GLuint>& indices, size_t vertexCount, int cacheSize = DefaultVertexCacheSize);
+
+// reorders clusters of the (already cache optimized) indices to reduce overdraw. threshold: how much worse than
+// the cache order the ACMR may get (1.05 = 5%), smaller clusters sort better but share fewer vertices
+void OptimizeOverdraw(IndexedMesh& mesh, float threshold = 1.05f, int cacheSize = DefaultVertexCacheSize);
+
+// renumbers the vertices in order of first use. Drops vertices no index refers to
+void OptimizeVertexFetch(IndexedMesh& mesh);
+
+#endif
@@ -0,0 +1,426 @@
+#include"MeshScene.h"
+
+#include<chrono>
+#include<cmath>
+#include<cstdint>
+#include<cstdio>
+#include<vector>
+
+// spins the mesh around Y and tilts it towards the camera so the hole shows, then lights it from the upper left
+static const char* meshVertexSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 1) in vec3 aNormal;\n"
+"uniform vec4 uSpin; // cos, sin of the spin angle, cos, sin of the tilt\n"
+"uniform vec4 uPositionScale;  // xyz: aPos * scale + offset = position in the view. Undoes the vertex format's\n"
+"uniform vec4 uPositionOffset; // quantization and fits a loaded mesh into the view in one go\n"
+"out vec3 normal;\n"
+"vec3 Rotate(vec3 v)\n"
+"{\n"
+"	v = vec3(v.x * uSpin.x + v.z * uSpin.y, v.y, -v.x * uSpin.y + v.z * uSpin.x);\n"
+"	return vec3(v.x, v.y * uSpin.z - v.z * uSpin.w, v.y * uSpin.w + v.z * uSpin.z);\n"
+"}\n"
+"void main()\n"
+"{\n"
+"	gl_Position = vec4(Rotate(aPos * uPositionScale.xyz + uPositionOffset.xyz), 1.0);\n"
+"	normal = Rotate(aNormal);\n"
+"}\n";
+
+static const char* meshFragmentSource = "#version 330 core\n"
+"in vec3 normal;\n"
+"out vec4 FragColor;\n"
+"void main()\n"
+"{\n"
+"	vec3 toLight = normalize(vec3(-0.4, 0.5, -1.0));\n"
+"	float diffuse = max(dot(normalize(normal), toLight), 0.0);\n"
+"	FragColor = vec4(vec3(0.8, 0.3, 0.02) * (0.2 + 0.8 * diffuse), 1.0);\n"
+"}\n";
+
+// position + normal
+static const int FloatsPerVertex = 6;
+
+// small deterministic random numbers, so every run draws the same thing
+static uint32_t NextRandom(uint32_t& seed)
+{
+	seed = seed * 1664525u + 1013904223u;
+	return seed >> 8;
+}
+
+// point on the lumpy torus at grid angles u (around the hole) and v (around the tube)
+static void TorusPoint(float u, float v, float* out)
+{
+	const float major = 0.62f, minor = 0.28f;
+	// whole numbers of bumps both ways, so the surface closes up without a seam
+	float radius = minor * (1.0f + 0.12f * std::sin(9.0f * u) * std::sin(4.0f * v));
+	out[0] = (major + radius * std::cos(v)) * std::cos(u);
+	out[1] = radius * std::sin(v);
+	out[2] = (major + radius * std::cos(v)) * std::sin(u);
+}
+
+// triangle soup for about `triangles` triangles, in shuffled order. Every copy of a grid vertex has the exact same
+// floats, so IndexVertices can find them again
+static std::vector<float> BuildTorusSoup(int triangles, int& rings, int& sides)
+{
+	// the ring around the hole is ~2.5 times longer than around the tube, keep the quads about square
+	sides = (int)std::sqrt(triangles / 2 / 2.5);
+	if (sides < 3)
+		sides = 3;
+	rings = triangles / 2 / sides;
+	if (rings < 3)
+		rings = 3;
+
+	const float tau = 6.28318530718f;
+	std::vector<float> grid((size_t)rings * sides * FloatsPerVertex);
+	auto at = [&grid, rings, sides](int i, int j) { return &grid[(((size_t)((i + rings) % rings)) * sides + (j + sides) % sides) * FloatsPerVertex]; };
+	for (int i = 0; i < rings; i++)
+		for (int j = 0; j < sides; j++)
+			TorusPoint(tau * i / rings, tau * j / sides, at(i, j));
+
+	// normals from the neighbouring grid points: cross(along the tube, along the ring) points out
+	for (int i = 0; i < rings; i++)
+	{
+		for (int j = 0; j < sides; j++)
+		{
+			const float* ringPrev = at(i - 1, j);
+			const float* ringNext = at(i + 1, j);
+			const float* tubePrev = at(i, j - 1);
+			const float* tubeNext = at(i, j + 1);
+			float du[3] = { ringNext[0] - ringPrev[0], ringNext[1] - ringPrev[1], ringNext[2] - ringPrev[2] };
+			float dv[3] = { tubeNext[0] - tubePrev[0], tubeNext[1] - tubePrev[1], tubeNext[2] - tubePrev[2] };
+			float n[3] = { dv[1] * du[2] - dv[2] * du[1], dv[2] * du[0] - dv[0] * du[2], dv[0] * du[1] - dv[1] * du[0] };
+			float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+			float* vertex = at(i, j);
+			for (int c = 0; c < 3; c++)
+				vertex[3 + c] = n[c] / length;
+		}
+	}
+
+	// two triangles per grid cell, then shuffled (Fisher-Yates)
+	std::vector<int> corners;
+	corners.reserve((size_t)rings * sides * 6);
+	for (int i = 0; i < rings; i++)
+	{
+		for (int j = 0; j < sides; j++)
+		{
+			int a[2] = { i, j }, b[2] = { i + 1, j }, c[2] = { i + 1, j + 1 }, d[2] = { i, j + 1 };
+			corners.insert(corners.end(), { a[0], a[1], c[0], c[1], b[0], b[1] });
+			corners.insert(corners.end(), { a[0], a[1], d[0], d[1], c[0], c[1] });
+		}
+	}
+	size_t triangleCount = corners.size() / 6;
+	uint32_t seed = 12345u;
+	for (size_t t = triangleCount - 1; t > 0; t--)
+	{
+		size_t other = NextRandom(seed) % (t + 1);
+		for (int k = 0; k < 6; k++)
+			std::swap(corners[t * 6 + k], corners[other * 6 + k]);
+	}
+
+	std::vector<float> soup;
+	soup.reserve(triangleCount * 3 * FloatsPerVertex);
+	for (size_t k = 0; k < corners.size(); k += 2)
+	{
+		const float* vertex = at(corners[k], corners[k + 1]);
+		soup.insert(soup.end(), vertex, vertex + FloatsPerVertex);
+	}
+	return soup;
+}
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+MeshScene::MeshScene(int triangles, MeshOptimization optimization, const std::string& meshFile, const std::string& cacheDir, int loadThreads,
+	VertexFormat vertexFormat)
+	: requestedTriangles(triangles), optimization(optimization), meshFile(meshFile), cacheDir(cacheDir), loadThreads(loadThreads),
+	requestedFormat(vertexFormat)
+{
+	// a file comes out of the parser indexed already, there's no soup to draw
+	if (!meshFile.empty() && optimization == MeshOptimization::Off)
+		this->optimization = MeshOptimization::Index;
+}
+
+MeshScene::~MeshScene()
+{
+	// the cache forgets the VAO reading our buffers before the members delete them
+	if (vertexArrays != nullptr)
+	{
+		vertexArrays->Release(vertices.ID);
+		vertexArrays->Release(indices.ID);
+	}
+}
+
+void MeshScene::Optimize(IndexedMesh& mesh)
+{
+	uniqueVertices = mesh.VertexCount();
+	indexedStats = SimulateVertexCache(mesh.indices, mesh.VertexCount());
+
+	if (optimization == MeshOptimization::Cache || optimization == MeshOptimization::Full)
+	{
+		auto start = std::chrono::steady_clock::now();
+		OptimizeVertexCache(mesh.indices, mesh.VertexCount());
+		cacheMs = MillisecondsSince(start);
+		cacheStats = SimulateVertexCache(mesh.indices, mesh.VertexCount());
+	}
+	if (optimization == MeshOptimization::Full)
+	{
+		auto start = std::chrono::steady_clock::now();
+		OptimizeOverdraw(mesh);
+		overdrawMs = MillisecondsSince(start);
+		overdrawStats = SimulateVertexCache(mesh.indices, mesh.VertexCount());
+	}
+	// last, so the vertices follow the final triangle order
+	if (optimization != MeshOptimization::Index)
+		OptimizeVertexFetch(mesh);
+}
+
+void MeshScene::BuildTorus()
+{
+	int rings = 0, sides = 0;
+	std::vector<float> soup = BuildTorusSoup(requestedTriangles, rings, sides);
+	soupVertices = soup.size() / FloatsPerVertex;
+
+	IndexedMesh& mesh = asset.mesh;
+	if (optimization == MeshOptimization::Off)
+	{
+		// the original way: every triangle brings its own three vertices
+		mesh.vertices.swap(soup);
+		mesh.floatsPerVertex = FloatsPerVertex;
+	}
+	else
+	{
+		auto start = std::chrono::steady_clock::now();
+		mesh = IndexVertices(soup.data(), soupVertices, FloatsPerVertex);
+		indexMs = MillisecondsSince(start);
+		Optimize(mesh);
+	}
+
+	asset.vertices = mesh.vertices.data();
+	asset.indices = mesh.indices.empty() ? nullptr : mesh.indices.data();
+	asset.vertexCount = mesh.VertexCount();
+	asset.indexCount = mesh.indices.size();
+
+	// the loader fills these in for a file, the quantized vertex formats need them for the torus too
+	for (int k = 0; k < 3; k++)
+	{
+		asset.boundsMin[k] = mesh.vertices.empty() ? 0.0f : mesh.vertices[k];
+		asset.boundsMax[k] = asset.boundsMin[k];
+	}
+	for (size_t v = 0; v < asset.vertexCount; v++)
+	{
+		for (int k = 0; k < 3; k++)
+		{
+			float value = mesh.vertices[v * FloatsPerVertex + k];
+			asset.boundsMin[k] = std::fmin(asset.boundsMin[k], value);
+			asset.boundsMax[k] = std::fmax(asset.boundsMax[k], value);
+		}
+	}
+}
+
+bool MeshScene::BuildMesh(VertexFormat format)
+{
+	if (meshFile.empty())
+	{
+		BuildTorus();
+		EncodeMeshVertices(asset, format);
+		triangleCount = (int)(soupVertices / 3);
+		return true;
+	}
+
+	// a cache file remembers which optimizations it went through, so --mesh-opt index and full don't share one.
+	// The loader packs the vertices and caches them packed, in a file per format
+	if (!::LoadMesh(meshFile, cacheDir, loadThreads, (uint32_t)optimization, format, [this](IndexedMesh& mesh) { Optimize(mesh); }, asset))
+		return false;
+	triangleCount = (int)(asset.indexCount / 3);
+
+	// center of the bounding box to the origin, and its corners onto a sphere of radius 0.9 so it fits whichever way it spins
+	float halfDiagonal = 0.0f;
+	for (int k = 0; k < 3; k++)
+	{
+		fit[k] = 0.5f * (asset.boundsMin[k] + asset.boundsMax[k]);
+		float half = 0.5f * (asset.boundsMax[k] - asset.boundsMin[k]);
+		halfDiagonal += half * half;
+	}
+	fit[3] = halfDiagonal > 0.0f ? 0.9f / std::sqrt(halfDiagonal) : 1.0f;
+	return true;
+}
+
+bool MeshScene::SaveGenerated(const std::string& path)
+{
+	if (optimization == MeshOptimization::Off)
+		optimization = MeshOptimization::Index;
+	BuildTorus();
+	return SaveMesh(path, asset.mesh);
+}
+
+void MeshScene::AddPrograms(ShaderManager& manager)
+{
+	shaders = &manager;
+	program = shaders->Add("mesh", meshVertexSource, meshFragmentSource);
+}
+
+bool MeshScene::BuildGeometry(VertexArrayCache& cache)
+{
+	vertexArrays = &cache;
+	if (!BuildMesh(requestedFormat))
+		return false;
+
+	// (attribute * encoding scale + encoding offset - center) * fit scale, multiplied out
+	const VertexEncoding& encoding = asset.encoding;
+	for (int k = 0; k < 3; k++)
+	{
+		positionScale[k] = encoding.positionScale[k] * fit[3];
+		positionOffset[k] = (encoding.positionOffset[k] - fit[k]) * fit[3];
+	}
+
+	// the vertices go straight from wherever the loader left them, packed already: with a cache file that's the
+	// mapping, so the driver copies from the OS file cache and nothing was parsed, packed or copied on the way
+	auto start = std::chrono::steady_clock::now();
+	// the EBO is bound while it's created: keep it out of whichever VAO happens to be bound
+	glBindVertexArray(0);
+	vertices = VBO(asset.vertexData, asset.vertexCount * encoding.layout.Stride());
+	if (asset.indices == nullptr)
+		drawCount = (GLsizei)asset.vertexCount;
+	else
+	{
+		indices = EBO(asset.indices, asset.indexCount * sizeof(GLuint));
+		drawCount = (GLsizei)asset.indexCount;
+	}
+	vertexArray = vertexArrays->Get(encoding.layout, VertexBuffers(vertices.ID, indices.ID));
+	uploadMs = MillisecondsSince(start);
+	return true;
+}
+
+bool MeshScene::InitSoftware()
+{
+	// the rasterizer reads the floats
+	if (!BuildMesh(VertexFormat::Float))
+		return false;
+	shaded.resize(asset.vertexCount);
+	return true;
+}
+
+void MeshScene::Draw(StateCache& state, int frame)
+{
+	GLuint id = shaders->Get(program);
+	if (id == 0)
+		return;
+	state.UseProgram(id);
+	if (angleLocation == -1)
+	{
+		angleLocation = glGetUniformLocation(id, "uSpin");
+		scaleLocation = glGetUniformLocation(id, "uPositionScale");
+		offsetLocation = glGetUniformLocation(id, "uPositionOffset");
+	}
+
+	float angle = frame * 0.01f;
+	const float tilt = 0.9f;
+	GLfloat spin[4] = { std::cos(angle), std::sin(angle), std::cos(tilt), std::sin(tilt) };
+	glUniform4fv(angleLocation, 1, spin);
+	glUniform4fv(scaleLocation, 1, positionScale);
+	glUniform4fv(offsetLocation, 1, positionOffset);
+
+	// the only scene that needs depth, so it clears it itself and leaves the test off for whoever draws next
+	state.Enable(GL_DEPTH_TEST);
+	glClear(GL_DEPTH_BUFFER_BIT);
+	state.BindVertexArray(vertexArray);
+	if (asset.indices == nullptr)
+		glDrawArrays(GL_TRIANGLES, 0, drawCount);
+	else
+		glDrawElements(GL_TRIANGLES, drawCount, GL_UNSIGNED_INT, (void*)0);
+	state.Disable(GL_DEPTH_TEST);
+}
+
+// the vertex and fragment shader above on the CPU. The lighting is done per vertex here (the rasterizer only
+// interpolates colors), which on a mesh this dense looks the same. The soup shades every copy of a vertex, like the GPU does
+void MeshScene::DrawSoftware(SoftRasterizer& raster, int frame)
+{
+	float angle = frame * 0.01f;
+	const float tilt = 0.9f;
+	const float spin[4] = { std::cos(angle), std::sin(angle), std::cos(tilt), std::sin(tilt) };
+	const float light[3] = { -0.4f / 1.1874342f, 0.5f / 1.1874342f, -1.0f / 1.1874342f };
+	auto rotate = [&spin](const float* v, float* out)
+	{
+		float x = v[0] * spin[0] + v[2] * spin[1], z = -v[0] * spin[1] + v[2] * spin[0];
+		out[0] = x;
+		out[1] = v[1] * spin[2] - z * spin[3];
+		out[2] = v[1] * spin[3] + z * spin[2];
+	};
+
+	raster.ParallelFor(shaded.size(), [&](size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			const float* vertex = &asset.vertices[i * FloatsPerVertex];
+			float fitted[3] = { (vertex[0] - fit[0]) * fit[3], (vertex[1] - fit[1]) * fit[3], (vertex[2] - fit[2]) * fit[3] };
+			float position[3], normal[3];
+			rotate(fitted, position);
+			rotate(vertex + 3, normal);
+			float diffuse = normal[0] * light[0] + normal[1] * light[1] + normal[2] * light[2];
+			float brightness = 0.2f + 0.8f * (diffuse > 0.0f ? diffuse : 0.0f);
+			shaded[i] = { position[0], position[1], position[2], 0.8f * brightness, 0.3f * brightness, 0.02f * brightness };
+		}
+	});
+
+	raster.SetDepthTest(true);
+	raster.DrawTriangles(shaded.data(), shaded.size(), asset.indices, asset.indexCount);
+}
+
+void MeshScene::PrintReport() const
+{
+	if (!meshFile.empty())
+	{
+		const MeshLoadTimes& times = asset.times;
+		std::printf("mesh: %s, %d triangles, %zu vertices\n", meshFile.c_str(), triangleCount, asset.vertexCount);
+		if (asset.fromCache)
+		{
+			// nothing else to show: the ACMR numbers were measured when the cache file was written
+			std::printf("  loaded from cache %s in %.2f ms (mapped, nothing parsed), uploaded in %.2f ms\n", asset.cachePath.c_str(), times.mapMs, uploadMs);
+			PrintVertexFormat();
+			return;
+		}
+		std::printf("  parsed in %.2f ms (%d threads), --mesh-opt steps %.2f ms", times.parseMs, times.parseThreads, times.prepareMs);
+		if (!cacheDir.empty())
+			std::printf(", cache written in %.2f ms (%s)", times.writeMs, asset.cachePath.c_str());
+		std::printf(", %.2f ms in all, uploaded in %.2f ms\n", times.TotalMs(), uploadMs);
+		std::printf("  vertex cache (FIFO %d) ACMR / ATVR:  indexed %.3f / %.3f", DefaultVertexCacheSize, indexedStats.acmr, indexedStats.atvr);
+	}
+	else
+	{
+		std::printf("mesh: %d triangles, %zu soup vertices", triangleCount, soupVertices);
+		if (optimization == MeshOptimization::Off)
+		{
+			std::printf(", drawn as triangle soup (ACMR 3.000: every vertex shaded for every triangle)\n");
+			PrintVertexFormat();
+			return;
+		}
+		std::printf(" -> %zu unique (%.2f ms to index)\n", uniqueVertices, indexMs);
+		std::printf("  vertex cache (FIFO %d) ACMR / ATVR:  soup 3.000 / %.3f", DefaultVertexCacheSize, (double)soupVertices / uniqueVertices);
+		std::printf(", indexed %.3f / %.3f", indexedStats.acmr, indexedStats.atvr);
+	}
+	if (optimization == MeshOptimization::Cache || optimization == MeshOptimization::Full)
+		std::printf(", cache order %.3f / %.3f (%.2f ms)", cacheStats.acmr, cacheStats.atvr, cacheMs);
+	if (optimization == MeshOptimization::Full)
+		std::printf(", overdraw order %.3f / %.3f (%.2f ms)", overdrawStats.acmr, overdrawStats.atvr, overdrawMs);
+	std::printf("\n");
+	PrintVertexFormat();
+}
+
+void MeshScene::PrintVertexFormat() const
+{
+	// --soft draws from the floats, there's no vertex buffer
+	if (vertices.ID == 0)
+		return;
+	const VertexEncoding& encoding = asset.encoding;
+	GLsizei stride = encoding.layout.Stride();
+	size_t floatBytes = FloatsPerVertex * sizeof(float);
+	std::printf("  vertex buffer: %s%s, %d bytes/vertex", VertexFormatName(encoding.format), requestedFormat == VertexFormat::Auto ? " (auto)" : "", (int)stride);
+	if (encoding.format != VertexFormat::Float)
+		std::printf(" vs %zu as floats (%.2fx smaller)", floatBytes, (double)floatBytes / stride);
+	std::printf(", %.2f MB", (double)stride * asset.vertexCount / (1024.0 * 1024.0));
+	if (encoding.format != VertexFormat::Float && asset.fromCache)
+		std::printf(", packed in the cache file");
+	else if (encoding.format != VertexFormat::Float)
+		std::printf(", encoded in %.2f ms", asset.times.encodeMs);
+	std::printf("\n");
+}
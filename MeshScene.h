@@ -0,0 +1,98 @@
+#ifndef MESH_SCENE_CLASS_H
+#define MESH_SCENE_CLASS_H
+
+#include<string>
+#include<vector>
+#include"EBO.h"
+#include"MeshLoader.h"
+#include"MeshOptimizer.h"
+#include"Options.h"
+#include"Scene.h"
+#include"SoftRasterizer.h"
+#include"VBO.h"
+#include"VertexArrayCache.h"
+#include"VertexFormat.h"
+
+// one big spinning lumpy torus with position + normal per vertex, depth tested. It starts out as a triangle soup
+// in shuffled order (like a mesh exported without any thought for the GPU) and goes through MeshOptimizer up to
+// the --mesh-opt step, so the frame times and the ACMR in the report show what each step buys.
+// With --mesh-file it draws a model from disk instead (see MeshLoader.h), moved and scaled to fit the view.
+// The vertex buffer holds the vertices in --vertex-format (see VertexFormat.h), the rest of the scene only sees floats
+class MeshScene : public Scene
+{
+public:
+	// meshFile empty = the generated torus. cacheDir empty = parse the file every time. loadThreads: parser
+	// threads, 0 = one per hardware thread. vertexFormat: what the vertex buffer holds, Auto = picked for the mesh
+	MeshScene(int triangles, MeshOptimization optimization, const std::string& meshFile = std::string(),
+		const std::string& cacheDir = std::string(), int loadThreads = 0, VertexFormat vertexFormat = VertexFormat::Auto);
+	~MeshScene() override;
+
+	const char* Name() const override { return "mesh"; }
+	void AddPrograms(ShaderManager& shaders) override;
+	bool BuildGeometry(VertexArrayCache& vertexArrays) override;
+	void Draw(StateCache& state, int frame) override;
+	bool InitSoftware() override;
+	void DrawSoftware(SoftRasterizer& raster, int frame) override;
+	int Objects() const override { return triangleCount; }
+	void PrintReport() const override;
+
+	// writes the generated torus (indexed, after the optimizations) as .obj or .gltf, for --save-mesh
+	bool SaveGenerated(const std::string& path);
+
+private:
+	// fills asset with its vertices in format: the mesh file through the loader, or the generated torus. Leaves the
+	// indices empty only for the torus with MeshOptimization::Off
+	bool BuildMesh(VertexFormat format);
+	void BuildTorus();
+	// the --mesh-opt steps after indexing, recording the ACMR after each one
+	void Optimize(IndexedMesh& mesh);
+	// the vertex buffer line of the report
+	void PrintVertexFormat() const;
+
+	int requestedTriangles;
+	MeshOptimization optimization;
+	std::string meshFile;
+	std::string cacheDir;
+	int loadThreads;
+	VertexFormat requestedFormat;
+
+	// what gets drawn. The arrays in it point into the mapped cache file or its own vectors
+	MeshAsset asset;
+	// center xyz, scale: moves a file's mesh into the view. The torus is made to fit already
+	float fit[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+	// the uniforms taking the vertex buffer's positions straight into the view: the encoding's dequantization
+	// (asset.encoding) and the fit folded into one multiply-add
+	float positionScale[4] = { 1.0f, 1.0f, 1.0f, 0.0f };
+	float positionOffset[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+	ShaderManager* shaders = nullptr;
+	ProgramHandle program = -1;
+	GLint angleLocation = -1;
+	GLint scaleLocation = -1;
+	GLint offsetLocation = -1;
+
+	// the context's VAOs (see VertexArrayCache.h), nullptr until BuildGeometry
+	VertexArrayCache* vertexArrays = nullptr;
+	GLuint vertexArray = 0;
+	VBO vertices;
+	EBO indices;
+	int triangleCount = 0;
+	GLsizei drawCount = 0;
+
+	// --soft: the shaded vertices the rasterizer gets every frame
+	std::vector<SoftVertex> shaded;
+
+	// filled in by BuildGeometry for the report
+	size_t soupVertices = 0;
+	size_t uniqueVertices = 0;
+	VertexCacheStats indexedStats;
+	VertexCacheStats cacheStats;
+	VertexCacheStats overdrawStats;
+	double indexMs = 0.0;
+	double cacheMs = 0.0;
+	double overdrawMs = 0.0;
+	// glBufferData of the vertices and indices. From a fresh mapping this is where the file is actually read
+	double uploadMs = 0.0;
+};
+
+#endif
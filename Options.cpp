@@ -0,0 +1,287 @@
+#include"Options.h"
+
+#include<cstdio>
+#include<cstdlib>
+#include<cstring>
+#include<iostream>
+
+static void PrintUsage(const char* program)
+{
+	std::cout << "usage: " << program << " [options]\n"
+		<< "  --headless         render offscreen through EGL, no window needed\n"
+		<< "  --window           render into a GLFW window (default)\n"
+		<< "  --soft             no GL: draw on the CPU with the tile rasterizer (triangle and mesh scenes)\n"
+		<< "  --soft-threads N   rasterizer threads (default one per hardware thread)\n"
+		<< "  --soft-simd MODE   rasterizer kernel: auto (default) | scalar | sse2 | avx2\n"
+		<< "  --frames N         stop after N frames (0 = until the window is closed; headless defaults to 1000, --bench measures N frames)\n"
+		<< "  --size WxH         framebuffer size in pixels (default 800x800)\n"
+		<< "  --shader-cache DIR program binary cache directory (default shader_cache)\n"
+		<< "  --no-shader-cache  always compile shaders, don't read or write the cache\n"
+		<< "  --lazy-gl          resolve GL functions on first call instead of all at startup\n"
+		<< "  --reload-bench N   time N reloads of the GL functions per loader mode (dlopen each time vs. resident cache)\n"
+		<< "  --scene NAME       triangle (default) | naive | instanced | queue | mesh\n"
+		<< "  --instances N      triangles drawn by the naive/instanced stress scenes and the mesh scene, objects in the queue scene (default 100000)\n"
+		<< "  --no-sort          queue scene: issue draws in submission order instead of sorting them by state\n"
+		<< "  --mesh-opt MODE    mesh scene: off (triangle soup) | index | cache (+ vertex cache order) | full (+ overdraw order, default)\n"
+		<< "  --mesh-file FILE   mesh scene: draw this .obj, .gltf or .glb instead of the generated torus\n"
+		<< "  --mesh-cache DIR   binary cache of parsed mesh files, mapped instead of parsing next time (default mesh_cache)\n"
+		<< "  --no-mesh-cache    always parse the mesh file, don't read or write the cache\n"
+		<< "  --mesh-threads N   threads parsing the mesh file (default one per hardware thread)\n"
+		<< "  --vertex-format F  mesh scene vertex buffer: auto (default, picked per mesh) | float | half | quant16 | quant10\n"
+		<< "  --save-mesh FILE   write the generated torus (--instances, --mesh-opt) to FILE as .obj or .gltf and quit\n"
+		<< "  --stream MODE      animate the triangle, uploading it every frame through: ring | bufferdata\n"
+		<< "  --no-persistent    ring buffer uses glMapBufferRange + fences instead of persistent mapping\n"
+		<< "  --readback MODE    read every frame back to the CPU: sync (glReadPixels) | pbo (pixel buffer ring + fences)\n"
+		<< "  --readback-depth N frames the pbo ring holds before the oldest is mapped (default 3)\n"
+		<< "  --dump DIR         write every frame to DIR (reads back through pbo unless --readback sync)\n"
+		<< "  --dump-format FMT  png (default) | ppm | raw (RGBA bytes)\n"
+		<< "  --dump-threads N   encoder threads (default one per hardware thread)\n"
+		<< "  --dump-queue N     frames waiting or being written at once before the render loop waits (default 8)\n"
+		<< "  --dump-drop        drop frames when the queue is full instead of waiting\n"
+		<< "  --bench            time every frame and report CPU/GPU p50/p95/p99/max\n"
+		<< "  --warmup N         frames rendered before measuring starts (default 100)\n"
+		<< "  --csv FILE         write per-frame benchmark times as CSV\n"
+		<< "  --json FILE        write the benchmark summary + samples as JSON\n"
+		<< "  --capture FILE     record the GL calls of the run into FILE, play it back with gl_replay\n";
+}
+
+// reads the string that follows a flag, e.g. "--csv out.csv"
+static bool ReadString(int argc, char** argv, int& i, std::string& out)
+{
+	if (i + 1 >= argc)
+		return false;
+	out = argv[++i];
+	return true;
+}
+
+// reads the integer that follows a flag, e.g. "--frames 200"
+static bool ReadInt(int argc, char** argv, int& i, int& out)
+{
+	if (i + 1 >= argc)
+		return false;
+	char* end = NULL;
+	long value = std::strtol(argv[++i], &end, 10);
+	if (*end != '\0' || value < 0)
+		return false;
+	out = (int)value;
+	return true;
+}
+
+bool ParseOptions(int argc, char** argv, AppOptions& options)
+{
+	bool framesGiven = false;
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		bool ok = true;
+
+		if (std::strcmp(arg, "--headless") == 0)
+			options.backend = BackendType::Headless;
+		else if (std::strcmp(arg, "--window") == 0)
+			options.backend = BackendType::Window;
+		else if (std::strcmp(arg, "--soft") == 0)
+			options.backend = BackendType::Software;
+		else if (std::strcmp(arg, "--soft-threads") == 0)
+			ok = ReadInt(argc, argv, i, options.softThreads);
+		else if (std::strcmp(arg, "--soft-simd") == 0)
+		{
+			ok = i + 1 < argc;
+			if (ok && std::strcmp(argv[i + 1], "auto") == 0)
+				options.softSimd = SoftSimd::Auto;
+			else if (ok && std::strcmp(argv[i + 1], "scalar") == 0)
+				options.softSimd = SoftSimd::Scalar;
+			else if (ok && std::strcmp(argv[i + 1], "sse2") == 0)
+				options.softSimd = SoftSimd::Sse2;
+			else if (ok && std::strcmp(argv[i + 1], "avx2") == 0)
+				options.softSimd = SoftSimd::Avx2;
+			else
+				ok = false;
+			i++;
+		}
+		else if (std::strcmp(arg, "--frames") == 0)
+			ok = framesGiven = ReadInt(argc, argv, i, options.frames);
+		else if (std::strcmp(arg, "--size") == 0)
+			ok = i + 1 < argc && std::sscanf(argv[++i], "%dx%d", &options.width, &options.height) == 2
+				&& options.width > 0 && options.height > 0;
+		else if (std::strcmp(arg, "--shader-cache") == 0)
+			ok = ReadString(argc, argv, i, options.shaderCacheDir) && !options.shaderCacheDir.empty();
+		else if (std::strcmp(arg, "--no-shader-cache") == 0)
+			options.shaderCacheDir.clear();
+		else if (std::strcmp(arg, "--lazy-gl") == 0)
+			options.lazyGL = true;
+		else if (std::strcmp(arg, "--reload-bench") == 0)
+			ok = ReadInt(argc, argv, i, options.reloadBench) && options.reloadBench > 0;
+		else if (std::strcmp(arg, "--scene") == 0)
+		{
+			ok = i + 1 < argc;
+			if (ok && std::strcmp(argv[i + 1], "triangle") == 0)
+				options.scene = SceneType::Triangle;
+			else if (ok && std::strcmp(argv[i + 1], "naive") == 0)
+				options.scene = SceneType::Naive;
+			else if (ok && std::strcmp(argv[i + 1], "instanced") == 0)
+				options.scene = SceneType::Instanced;
+			else if (ok && std::strcmp(argv[i + 1], "queue") == 0)
+				options.scene = SceneType::Queue;
+			else if (ok && std::strcmp(argv[i + 1], "mesh") == 0)
+				options.scene = SceneType::Mesh;
+			else
+				ok = false;
+			i++;
+		}
+		else if (std::strcmp(arg, "--instances") == 0)
+			ok = ReadInt(argc, argv, i, options.instances) && options.instances > 0;
+		else if (std::strcmp(arg, "--no-sort") == 0)
+			options.sortDraws = false;
+		else if (std::strcmp(arg, "--mesh-opt") == 0)
+		{
+			ok = i + 1 < argc;
+			if (ok && std::strcmp(argv[i + 1], "off") == 0)
+				options.meshOpt = MeshOptimization::Off;
+			else if (ok && std::strcmp(argv[i + 1], "index") == 0)
+				options.meshOpt = MeshOptimization::Index;
+			else if (ok && std::strcmp(argv[i + 1], "cache") == 0)
+				options.meshOpt = MeshOptimization::Cache;
+			else if (ok && std::strcmp(argv[i + 1], "full") == 0)
+				options.meshOpt = MeshOptimization::Full;
+			else
+				ok = false;
+			i++;
+		}
+		else if (std::strcmp(arg, "--mesh-file") == 0)
+			ok = ReadString(argc, argv, i, options.meshFile) && !options.meshFile.empty();
+		else if (std::strcmp(arg, "--mesh-cache") == 0)
+			ok = ReadString(argc, argv, i, options.meshCacheDir) && !options.meshCacheDir.empty();
+		else if (std::strcmp(arg, "--no-mesh-cache") == 0)
+			options.meshCacheDir.clear();
+		else if (std::strcmp(arg, "--mesh-threads") == 0)
+			ok = ReadInt(argc, argv, i, options.meshThreads);
+		else if (std::strcmp(arg, "--vertex-format") == 0)
+		{
+			ok = i + 1 < argc;
+			if (ok && std::strcmp(argv[i + 1], "auto") == 0)
+				options.vertexFormat = VertexFormat::Auto;
+			else if (ok && std::strcmp(argv[i + 1], "float") == 0)
+				options.vertexFormat = VertexFormat::Float;
+			else if (ok && std::strcmp(argv[i + 1], "half") == 0)
+				options.vertexFormat = VertexFormat::Half;
+			else if (ok && std::strcmp(argv[i + 1], "quant16") == 0)
+				options.vertexFormat = VertexFormat::Quantized16;
+			else if (ok && std::strcmp(argv[i + 1], "quant10") == 0)
+				options.vertexFormat = VertexFormat::Quantized10;
+			else
+				ok = false;
+			i++;
+		}
+		else if (std::strcmp(arg, "--save-mesh") == 0)
+			ok = ReadString(argc, argv, i, options.saveMeshPath) && !options.saveMeshPath.empty();
+		else if (std::strcmp(arg, "--stream") == 0)
+		{
+			ok = i + 1 < argc;
+			if (ok && std::strcmp(argv[i + 1], "ring") == 0)
+				options.stream = StreamMode::Ring;
+			else if (ok && std::strcmp(argv[i + 1], "bufferdata") == 0)
+				options.stream = StreamMode::BufferData;
+			else
+				ok = false;
+			i++;
+		}
+		else if (std::strcmp(arg, "--no-persistent") == 0)
+			options.persistentMapping = false;
+		else if (std::strcmp(arg, "--readback") == 0)
+		{
+			ok = i + 1 < argc;
+			if (ok && std::strcmp(argv[i + 1], "sync") == 0)
+				options.readback = ReadbackOption::Sync;
+			else if (ok && std::strcmp(argv[i + 1], "pbo") == 0)
+				options.readback = ReadbackOption::Pbo;
+			else
+				ok = false;
+			i++;
+		}
+		else if (std::strcmp(arg, "--readback-depth") == 0)
+			ok = ReadInt(argc, argv, i, options.readbackDepth) && options.readbackDepth > 0;
+		else if (std::strcmp(arg, "--dump") == 0)
+			ok = ReadString(argc, argv, i, options.dumpDir) && !options.dumpDir.empty();
+		else if (std::strcmp(arg, "--dump-format") == 0)
+		{
+			ok = i + 1 < argc;
+			if (ok && std::strcmp(argv[i + 1], "png") == 0)
+				options.dumpFormat = ImageFormat::Png;
+			else if (ok && std::strcmp(argv[i + 1], "ppm") == 0)
+				options.dumpFormat = ImageFormat::Ppm;
+			else if (ok && std::strcmp(argv[i + 1], "raw") == 0)
+				options.dumpFormat = ImageFormat::Raw;
+			else
+				ok = false;
+			i++;
+		}
+		else if (std::strcmp(arg, "--dump-threads") == 0)
+			ok = ReadInt(argc, argv, i, options.dumpThreads);
+		else if (std::strcmp(arg, "--dump-queue") == 0)
+			ok = ReadInt(argc, argv, i, options.dumpQueue) && options.dumpQueue > 0;
+		else if (std::strcmp(arg, "--dump-drop") == 0)
+			options.dumpDrop = true;
+		else if (std::strcmp(arg, "--bench") == 0)
+			options.bench = true;
+		else if (std::strcmp(arg, "--warmup") == 0)
+			ok = ReadInt(argc, argv, i, options.warmupFrames);
+		else if (std::strcmp(arg, "--csv") == 0)
+			ok = ReadString(argc, argv, i, options.csvPath);
+		else if (std::strcmp(arg, "--json") == 0)
+			ok = ReadString(argc, argv, i, options.jsonPath);
+		else if (std::strcmp(arg, "--capture") == 0)
+			ok = ReadString(argc, argv, i, options.capturePath) && !options.capturePath.empty();
+		else if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0)
+			ok = false;
+		else
+		{
+			std::cout << "unknown option: " << arg << std::endl;
+			ok = false;
+		}
+
+		if (!ok)
+		{
+			PrintUsage(argv[0]);
+			return false;
+		}
+	}
+
+	// writing results only makes sense when there are results (first, so the frame checks below see the benchmark)
+	if (!options.csvPath.empty() || !options.jsonPath.empty())
+		options.bench = true;
+
+	// nobody is going to close a window that doesn't exist, and a benchmark needs a fixed number of frames
+	if ((options.backend != BackendType::Window || options.bench) && !framesGiven)
+		options.frames = 1000;
+	// --frames 0 means "until the window is closed", which never happens without one, and a benchmark of no frames has nothing to measure
+	if ((options.backend != BackendType::Window || options.bench) && options.frames == 0)
+	{
+		std::cout << "--frames must be at least 1 without a window or with --bench" << std::endl;
+		PrintUsage(argv[0]);
+		return false;
+	}
+
+	// the software renderer's frames are in memory already, and it has no GL calls to capture
+	if (options.backend == BackendType::Software)
+	{
+		if (options.readback != ReadbackOption::Off || !options.capturePath.empty())
+			std::cout << "--soft: ignoring --readback and --capture, there's no GL to read back from or record" << std::endl;
+		options.readback = ReadbackOption::Off;
+		options.capturePath.clear();
+		return true;
+	}
+
+	// frames can't be dumped without reading them back first
+	if (!options.dumpDir.empty() && options.readback == ReadbackOption::Off)
+		options.readback = ReadbackOption::Pbo;
+
+	// what a capture can't record (see GLCapture.h) is switched off, so the file replays the same thing we drew
+	if (!options.capturePath.empty() && (options.persistentMapping || options.lazyGL || !options.shaderCacheDir.empty()))
+	{
+		std::cout << "capturing: using --no-persistent and --no-shader-cache, without --lazy-gl" << std::endl;
+		options.persistentMapping = false;
+		options.lazyGL = false;
+		options.shaderCacheDir.clear();
+	}
+	return true;
+}
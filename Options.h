@@ -0,0 +1,112 @@
+#ifndef OPTIONS_CLASS_H
+#define OPTIONS_CLASS_H
+
+#include<string>
+#include"Backend.h"
+#include"ImageWriter.h"
+#include"SoftRasterizer.h"
+#include"VertexFormat.h"
+
+// how the dynamic (changes every frame) copy of the triangle gets its vertices to the GPU
+enum class StreamMode
+{
+	Off,        // no dynamic geometry, just the static triangle
+	Ring,       // StreamBuffer: persistent mapped ring buffer (or unsynchronized mapping) + fences
+	BufferData  // glBufferData every frame, what the ring replaces
+};
+
+// how finished frames get back to the CPU, see Readback.h
+enum class ReadbackOption
+{
+	Off,
+	Sync, // glReadPixels straight into memory
+	Pbo   // glReadPixels into a ring of pixel buffer objects, mapped a few frames later
+};
+
+// what gets drawn, see Scene.h
+enum class SceneType
+{
+	Triangle,  // the original orange triangle
+	Naive,     // stress test: one draw call per triangle
+	Instanced, // stress test: one instanced draw call for all of them
+	Queue,     // objects with random program/mesh/texture/material, drawn through the sorting RenderQueue
+	Mesh       // one big lit mesh, drawn indexed after the optimizations picked with --mesh-opt
+};
+
+// what the mesh scene does to its triangle soup before uploading it, each step includes the ones before (see MeshOptimizer.h)
+enum class MeshOptimization
+{
+	Off,   // triangle soup, glDrawArrays
+	Index, // unique vertices + index buffer, glDrawElements
+	Cache, // + triangles reordered for the post-transform vertex cache, vertices in order of first use
+	Full   // + clusters reordered to cut overdraw
+};
+
+// everything main() can be told from the command line
+struct AppOptions
+{
+	BackendType backend = BackendType::Window;
+	int width = 800;
+	int height = 800;
+	// how many frames to render before quitting, 0 = until the window is closed
+	int frames = 0;
+
+	// where linked program binaries are cached between launches, empty = always compile
+	std::string shaderCacheDir = "shader_cache";
+
+	// resolve GL functions on their first call instead of all of them at startup
+	bool lazyGL = false;
+	// times this many GL function reloads per loader mode at startup, 0 = don't
+	int reloadBench = 0;
+
+	SceneType scene = SceneType::Triangle;
+	// how many triangles the stress scenes draw (objects for the queue scene, about the triangle count of the mesh scene)
+	int instances = 100000;
+	// whether the RenderQueue sorts the draws by state, off = submission order
+	bool sortDraws = true;
+	MeshOptimization meshOpt = MeshOptimization::Full;
+	// mesh scene: draw this .obj/.gltf/.glb instead of the generated torus, and where its binary cache goes (empty = no cache)
+	std::string meshFile;
+	std::string meshCacheDir = "mesh_cache";
+	// threads parsing the mesh file, 0 = one per hardware thread
+	int meshThreads = 0;
+	// how the mesh scene stores its vertices on the GPU, Auto = picked per mesh (see VertexFormat.h)
+	VertexFormat vertexFormat = VertexFormat::Auto;
+	// writes the generated torus to this .obj/.gltf and quits, empty = don't
+	std::string saveMeshPath;
+
+	// dynamic geometry upload path, and whether the ring may use ARB_buffer_storage persistent mapping
+	StreamMode stream = StreamMode::Off;
+	bool persistentMapping = true;
+
+	// benchmark mode: time warmup + measured frames and print percentiles
+	bool bench = false;
+	int warmupFrames = 100;
+	// optional dumps of the benchmark results, empty = don't write
+	std::string csvPath;
+	std::string jsonPath;
+
+	// read every frame back to the CPU, and how many frames the pbo ring holds
+	ReadbackOption readback = ReadbackOption::Off;
+	int readbackDepth = 3;
+
+	// writes every frame read back into this directory, empty = don't (see FrameDumper.h)
+	std::string dumpDir;
+	ImageFormat dumpFormat = ImageFormat::Png;
+	// encoder threads (0 = one per hardware thread), frames allowed in flight, and drop instead of wait when full
+	int dumpThreads = 0;
+	int dumpQueue = 8;
+	bool dumpDrop = false;
+
+	// records every GL call into this file for gl_replay, empty = don't
+	std::string capturePath;
+
+	// --soft: rasterizer threads (0 = one per hardware thread) and which SIMD kernel
+	int softThreads = 0;
+	SoftSimd softSimd = SoftSimd::Auto;
+};
+
+// fills in options from argv. Returns false (after printing usage) when an argument makes no sense
+bool ParseOptions(int argc, char** argv, AppOptions& options);
+
+#endif
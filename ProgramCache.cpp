@@ -0,0 +1,171 @@
+#include"ProgramCache.h"
+
+#include<cstdio>
+#include<cstring>
+#include<filesystem>
+#include<fstream>
+#include<iostream>
+#include<vector>
+
+// what we write in front of the driver's blob
+struct ProgramCacheHeader
+{
+	char magic[4];        // "GLPB"
+	uint32_t fileVersion; // bump when this struct changes
+	uint64_t key;         // same hash as the file name, catches renamed/mixed up files
+	uint32_t binaryFormat;
+	uint32_t length;
+};
+
+static const uint32_t ProgramCacheFileVersion = 1;
+
+// 64-bit FNV-1a, fed the strings one after another (including their terminators so "ab"+"c" != "a"+"bc")
+static uint64_t HashString(uint64_t hash, const char* s)
+{
+	do
+	{
+		hash ^= (unsigned char)*s;
+		hash *= 1099511628211ull;
+	} while (*s++ != '\0');
+	return hash;
+}
+
+ProgramCache::ProgramCache(const std::string& directory)
+	: directory(directory)
+{
+	if (directory.empty() || !GLAD_GL_ARB_get_program_binary)
+		return;
+
+	// the extension can be there with no formats at all (some drivers do this when their own cache is off)
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	if (formats <= 0)
+		return;
+
+	const char* vendor = (const char*)glGetString(GL_VENDOR);
+	const char* renderer = (const char*)glGetString(GL_RENDERER);
+	const char* version = (const char*)glGetString(GL_VERSION);
+	driver = std::string(vendor ? vendor : "") + '\n' + (renderer ? renderer : "") + '\n' + (version ? version : "");
+	enabled = true;
+}
+
+uint64_t ProgramCache::Key(const char* vertexSource, const char* fragmentSource) const
+{
+	uint64_t hash = 14695981039346656037ull;
+	hash = HashString(hash, vertexSource);
+	hash = HashString(hash, fragmentSource);
+	hash = HashString(hash, driver.c_str());
+	return hash;
+}
+
+std::string ProgramCache::PathFor(uint64_t key) const
+{
+	char name[32];
+	std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+	return (std::filesystem::path(directory) / name).string();
+}
+
+GLuint ProgramCache::Load(const char* vertexSource, const char* fragmentSource)
+{
+	if (!enabled)
+		return 0;
+
+	uint64_t key = Key(vertexSource, fragmentSource);
+	std::ifstream file(PathFor(key), std::ios::binary);
+	if (!file)
+	{
+		misses++;
+		return 0;
+	}
+
+	ProgramCacheHeader header;
+	bool valid = file.read((char*)&header, sizeof(header))
+		&& std::memcmp(header.magic, "GLPB", 4) == 0
+		&& header.fileVersion == ProgramCacheFileVersion
+		&& header.key == key
+		&& header.length > 0;
+
+	std::vector<char> binary;
+	if (valid)
+	{
+		binary.resize(header.length);
+		valid = (bool)file.read(binary.data(), header.length);
+	}
+	if (!valid)
+	{
+		// truncated or from an older version of this program, treat it like it isn't there
+		misses++;
+		return 0;
+	}
+
+	GLuint program = glCreateProgram();
+	glProgramBinary(program, header.binaryFormat, binary.data(), (GLsizei)header.length);
+
+	// glProgramBinary reports success or failure through the link status, same as glLinkProgram
+	GLint linked = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &linked);
+	if (!linked)
+	{
+		glDeleteProgram(program);
+		rejected++;
+		return 0;
+	}
+
+	hits++;
+	return program;
+}
+
+void ProgramCache::PrepareForLink(GLuint program)
+{
+	if (enabled)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+bool ProgramCache::Store(GLuint program, const char* vertexSource, const char* fragmentSource)
+{
+	if (!enabled)
+		return false;
+
+	GLint linked = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &linked);
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (!linked || length <= 0)
+		return false;
+
+	std::vector<char> binary(length);
+	GLenum format = 0;
+	GLsizei written = 0;
+	glGetProgramBinary(program, length, &written, &format, binary.data());
+	if (written <= 0)
+		return false;
+
+	std::error_code error;
+	std::filesystem::create_directories(directory, error);
+
+	ProgramCacheHeader header;
+	std::memcpy(header.magic, "GLPB", 4);
+	header.fileVersion = ProgramCacheFileVersion;
+	header.key = Key(vertexSource, fragmentSource);
+	header.binaryFormat = format;
+	header.length = (uint32_t)written;
+
+	// write to a temporary file and rename it into place, so a crash halfway never leaves a broken cache entry
+	std::string path = PathFor(header.key);
+	std::string temporary = path + ".tmp";
+	{
+		std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+		if (!file.write((const char*)&header, sizeof(header)) || !file.write(binary.data(), written))
+		{
+			std::cout << "Can't write program cache file " << temporary << std::endl;
+			return false;
+		}
+	}
+	std::filesystem::rename(temporary, path, error);
+	if (error)
+	{
+		std::filesystem::remove(temporary, error);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,52 @@
+#ifndef PROGRAM_CACHE_CLASS_H
+#define PROGRAM_CACHE_CLASS_H
+
+#include<cstdint>
+#include<string>
+#include<glad/glad.h>
+
+// * NOTE: compiling + linking GLSL is slow, and we do the exact same work on every launch.
+// With ARB_get_program_binary the driver can give us the LINKED program as a blob, which we save to disk
+// and hand back (glProgramBinary) next time instead of compiling again.
+// A binary only works on the same driver, so the file name is a hash of the shader sources AND the
+// vendor / renderer / version strings. The driver is still allowed to reject a binary (e.g. after an update
+// that kept the version string), in that case we just compile like normal and overwrite the file.
+
+class ProgramCache
+{
+public:
+	// needs a current context with glad loaded. An empty directory disables the cache
+	explicit ProgramCache(const std::string& directory);
+
+	// false when the driver doesn't expose ARB_get_program_binary (or exposes zero binary formats)
+	bool Enabled() const { return enabled; }
+
+	// creates a program from the cached binary for these sources.
+	// Returns 0 when there is no cache file or the driver rejected it: compile the program yourself then
+	GLuint Load(const char* vertexSource, const char* fragmentSource);
+
+	// call between glCreateProgram and glLinkProgram, tells the driver we're going to ask for the binary
+	void PrepareForLink(GLuint program);
+
+	// writes the binary of a successfully linked program next to the others
+	bool Store(GLuint program, const char* vertexSource, const char* fragmentSource);
+
+	int Hits() const { return hits; }
+	int Misses() const { return misses; }
+	int Rejected() const { return rejected; }
+
+private:
+	uint64_t Key(const char* vertexSource, const char* fragmentSource) const;
+	std::string PathFor(uint64_t key) const;
+
+	std::string directory;
+	// vendor + renderer + version, part of every key
+	std::string driver;
+	bool enabled = false;
+
+	int hits = 0;
+	int misses = 0;
+	int rejected = 0;
+};
+
+#endif
@@ -0,0 +1,192 @@
+#include"QueueScene.h"
+
+#include<cmath>
+#include<string>
+
+// position per vertex, transform as a constant attribute set by the queue, texture coordinates made from the position
+static const char* queueVertexSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 1) in vec4 aTransform; // offset.xy, scale, rotation\n"
+"out vec2 uv;\n"
+"void main()\n"
+"{\n"
+"	float c = cos(aTransform.w);\n"
+"	float s = sin(aTransform.w);\n"
+"	vec2 p = aPos.xy * aTransform.z;\n"
+"	p = vec2(p.x * c - p.y * s, p.x * s + p.y * c) + aTransform.xy;\n"
+"	gl_Position = vec4(p, aPos.z, 1.0);\n"
+"	uv = aPos.xy + 0.5;\n"
+"}\n";
+
+// the four programs only differ in the last line, that's enough to make them separate programs to switch between
+static const char* queueFragmentVariants[QueueScene::ProgramCount] =
+{
+	"	FragColor = color;\n",
+	"	FragColor = vec4(color.rgb * vec3(1.0, 0.8, 0.8), color.a);\n",
+	"	FragColor = vec4(vec3(dot(color.rgb, vec3(0.299, 0.587, 0.114))), color.a);\n",
+	"	FragColor = vec4(1.0 - color.rgb, color.a);\n"
+};
+
+static std::string QueueFragmentSource(int variant)
+{
+	return std::string("#version 330 core\n"
+		"in vec2 uv;\n"
+		"out vec4 FragColor;\n"
+		"uniform sampler2D tex0;\n"
+		"uniform vec4 uTint;\n"
+		"void main()\n"
+		"{\n"
+		"	vec4 color = texture(tex0, uv) * uTint;\n")
+		+ queueFragmentVariants[variant] + "}\n";
+}
+
+// small deterministic random numbers, so every run draws the same thing
+static uint32_t NextRandom(uint32_t& seed)
+{
+	seed = seed * 1664525u + 1013904223u;
+	return seed >> 8;
+}
+
+QueueScene::QueueScene(int count, bool sort)
+	: count(count), queue(sort)
+{
+}
+
+QueueScene::~QueueScene()
+{
+	// never made if BuildGeometry didn't run (e.g. --soft, where there's no context to delete them with)
+	if (textures[0] != 0)
+		glDeleteTextures(TextureCount, textures);
+	// the cache forgets the VAOs reading our buffers before the members delete them
+	if (vertexArrays != nullptr)
+	{
+		vertexArrays->Release(vertices.ID);
+		vertexArrays->Release(indices.ID);
+	}
+}
+
+void QueueScene::AddPrograms(ShaderManager& manager)
+{
+	shaders = &manager;
+	for (int i = 0; i < ProgramCount; i++)
+		programs[i] = shaders->Add("queue " + std::to_string(i), queueVertexSource, QueueFragmentSource(i));
+}
+
+bool QueueScene::BuildGeometry(VertexArrayCache& cache)
+{
+	vertexArrays = &cache;
+
+	// three meshes in one buffer: a triangle (drawn without indices), a quad and a hexagon (indexed)
+	const float h = std::sqrt(3.0f) / 2.0f;
+	std::vector<float> positions =
+	{
+		// triangle
+		-0.5f, -h / 3.0f, 0.0f,   0.5f, -h / 3.0f, 0.0f,   0.0f, h * 2.0f / 3.0f, 0.0f,
+		// quad
+		-0.5f, -0.5f, 0.0f,   0.5f, -0.5f, 0.0f,   0.5f, 0.5f, 0.0f,   -0.5f, 0.5f, 0.0f,
+		// hexagon: center + 6 corners
+		0.0f, 0.0f, 0.0f
+	};
+	for (int i = 0; i < 6; i++)
+	{
+		float angle = i * 3.14159265f / 3.0f;
+		positions.insert(positions.end(), { 0.5f * std::cos(angle), 0.5f * std::sin(angle), 0.0f });
+	}
+	// indices are relative to each mesh's first vertex, the VAO's buffer offset takes care of the rest
+	std::vector<GLuint> elements = { 0, 1, 2, 0, 2, 3 };
+	for (GLuint i = 0; i < 6; i++)
+		elements.insert(elements.end(), { 0, 1 + i, 1 + (i + 1) % 6 });
+
+	// the EBO is bound while it's created: keep it out of whichever VAO happens to be bound
+	glBindVertexArray(0);
+	vertices = VBO(positions.data(), positions.size() * sizeof(float));
+	indices = EBO(elements.data(), elements.size() * sizeof(GLuint));
+
+	const size_t firstVertex[MeshCount] = { 0, 3, 7 };
+	// the quad's 6 indices come first in the element buffer, the hexagon's start after them
+	const GLint firstIndex[MeshCount] = { 0, 0, 6 };
+	const GLsizei counts[MeshCount] = { 3, 6, 18 };
+	for (int i = 0; i < MeshCount; i++)
+	{
+		Mesh& mesh = meshes[i];
+		mesh.first = firstIndex[i];
+		mesh.count = counts[i];
+		mesh.indexed = i > 0;
+		// same layout and buffers, but each mesh starts at its own offset, so each gets its own VAO: the queue sorts
+		// by VAO, and three of them is what gives the sort something to group
+		mesh.vao = vertexArrays->Get(VertexLayoutOf<PositionVertex>::layout,
+			VertexBuffers(vertices.ID, mesh.indexed ? indices.ID : 0, (GLintptr)(firstVertex[i] * sizeof(PositionVertex))));
+	}
+
+	// 2x2 checkerboards in different colors
+	glGenTextures(TextureCount, textures);
+	for (int i = 0; i < TextureCount; i++)
+	{
+		uint8_t r = (uint8_t)(i & 1 ? 255 : 96), g = (uint8_t)(i & 2 ? 255 : 96), b = (uint8_t)(i & 4 ? 255 : 96);
+		const uint8_t pixels[16] = { r, g, b, 255,  255, 255, 255, 255,  255, 255, 255, 255,  r, g, b, 255 };
+		glBindTexture(GL_TEXTURE_2D, textures[i]);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	uint16_t materials[MaterialCount];
+	for (int i = 0; i < MaterialCount; i++)
+		materials[i] = queue.AddMaterial(0.5f + 0.5f * (i % 2), 0.5f + 0.25f * (i / 2 % 3), 0.5f + 0.125f * (i / 6), 1.0f);
+
+	// a grid like the stress scenes, every object with random state
+	uint32_t seed = 12345;
+	int side = (int)std::ceil(std::sqrt((double)count));
+	float cell = 2.0f / side;
+	objects.resize(count);
+	for (int i = 0; i < count; i++)
+	{
+		Object& object = objects[i];
+		object.program = (int)(NextRandom(seed) % ProgramCount);
+		object.mesh = (int)(NextRandom(seed) % MeshCount);
+		object.texture = (int)(NextRandom(seed) % TextureCount);
+		object.material = materials[NextRandom(seed) % MaterialCount];
+		object.depth = (NextRandom(seed) & 0xFFFF) / 65535.0f;
+		object.transform[0] = -1.0f + (i % side + 0.5f) * cell;
+		object.transform[1] = -1.0f + (i / side + 0.5f) * cell;
+		object.transform[2] = cell * 0.9f;
+		object.transform[3] = (float)(i % 360) * 3.14159265f / 180.0f;
+	}
+	return true;
+}
+
+void QueueScene::Draw(StateCache& state, int)
+{
+	// waits for the programs the first time only
+	GLuint ids[ProgramCount];
+	for (int i = 0; i < ProgramCount; i++)
+	{
+		ids[i] = shaders->Get(programs[i]);
+		if (ids[i] == 0)
+			return;
+	}
+
+	for (const Object& object : objects)
+	{
+		const Mesh& mesh = meshes[object.mesh];
+		DrawItem item;
+		item.program = ids[object.program];
+		item.vao = mesh.vao;
+		item.texture = textures[object.texture];
+		item.material = object.material;
+		item.depth = object.depth;
+		item.first = mesh.first;
+		item.count = mesh.count;
+		item.indexed = mesh.indexed;
+		for (int i = 0; i < 4; i++)
+			item.transform[i] = object.transform[i];
+		queue.Submit(item);
+	}
+	queue.Flush(state);
+}
+
+void QueueScene::PrintReport() const
+{
+	queue.PrintReport();
+}
@@ -0,0 +1,70 @@
+#ifndef QUEUE_SCENE_CLASS_H
+#define QUEUE_SCENE_CLASS_H
+
+#include<vector>
+#include"EBO.h"
+#include"RenderQueue.h"
+#include"Scene.h"
+#include"VBO.h"
+#include"VertexArrayCache.h"
+
+// lots of objects that each pick a random program, mesh, texture and material, submitted in a random order
+// (the worst case for state changes). Every draw goes through the RenderQueue, which sorts them by state unless
+// --no-sort is given, so the report shows what the sorting saves
+class QueueScene : public Scene
+{
+public:
+	QueueScene(int count, bool sort);
+	~QueueScene() override;
+
+	const char* Name() const override { return "queue"; }
+	void AddPrograms(ShaderManager& shaders) override;
+	bool BuildGeometry(VertexArrayCache& vertexArrays) override;
+	void Draw(StateCache& state, int frame) override;
+	int Objects() const override { return (int)objects.size(); }
+	int DrawCalls() const override { return (int)objects.size(); }
+	void PrintReport() const override;
+
+	static const int ProgramCount = 4;
+	static const int MeshCount = 3;
+	static const int TextureCount = 8;
+	static const int MaterialCount = 16;
+
+private:
+	// what each object picked, the GL names are filled in once the programs are ready
+	struct Object
+	{
+		int program;
+		int mesh;
+		int texture;
+		uint16_t material;
+		float depth;
+		float transform[4];
+	};
+
+	// where a mesh's vertices are in the shared VBO / EBO
+	struct Mesh
+	{
+		GLuint vao = 0;
+		GLint first;    // first index when indexed (the VAO's offset already points at the first vertex)
+		GLsizei count;
+		bool indexed;
+	};
+
+	int count;
+	RenderQueue queue;
+
+	ShaderManager* shaders = nullptr;
+	ProgramHandle programs[ProgramCount];
+
+	VBO vertices;
+	EBO indices;
+	// the context's VAOs (see VertexArrayCache.h), nullptr until BuildGeometry
+	VertexArrayCache* vertexArrays = nullptr;
+	Mesh meshes[MeshCount];
+	GLuint textures[TextureCount] = {};
+
+	std::vector<Object> objects;
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include"Readback.h"
+
+#include<chrono>
+#include<cstdio>
+#include"Benchmark.h"
+
+Readback::Readback(ReadbackMode mode, int width, int height, int depth)
+	: mode(mode), width(width), height(height)
+{
+	if (mode == ReadbackMode::Sync)
+	{
+		pixels.resize(FrameBytes());
+		return;
+	}
+
+	// GL_STREAM_READ: written by GL once, read by us once
+	slots.resize(depth > 0 ? depth : 1);
+	for (Slot& slot : slots)
+	{
+		glGenBuffers(1, &slot.buffer);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+		glBufferData(GL_PIXEL_PACK_BUFFER, FrameBytes(), NULL, GL_STREAM_READ);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+Readback::~Readback()
+{
+	for (Slot& slot : slots)
+	{
+		if (slot.fence != nullptr)
+			glDeleteSync(slot.fence);
+		glDeleteBuffers(1, &slot.buffer);
+	}
+}
+
+void Readback::ReadFrame(GLuint framebuffer, int frame)
+{
+	auto start = std::chrono::steady_clock::now();
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+
+	if (mode == ReadbackMode::Sync)
+	{
+		// blocks until everything drawn so far is done
+		glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+		readTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		if (sink)
+			sink(pixels.data(), frame);
+		delivered++;
+		return;
+	}
+
+	// the slot we're about to reuse holds the frame from depth frames ago: hand it out first
+	Slot& slot = slots[next];
+	double sinkMs = 0.0;
+	if (slot.fence != nullptr)
+		sinkMs = Collect(slot);
+
+	// with a pack buffer bound, the last argument is an offset into it and the call doesn't wait
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+	glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	slot.frame = frame;
+	next = (next + 1) % (int)slots.size();
+
+	// the sink's time is left out of the read cost, same as for sync
+	readTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() - sinkMs);
+}
+
+double Readback::Collect(Slot& slot)
+{
+	double sinkMs = 0.0;
+	// timeout 0 only asks, so a fence that's not done yet is counted before we really wait for it
+	GLenum status = glClientWaitSync(slot.fence, 0, 0);
+	if (status == GL_TIMEOUT_EXPIRED)
+	{
+		stalls++;
+		do
+			status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+		while (status == GL_TIMEOUT_EXPIRED);
+	}
+	glDeleteSync(slot.fence);
+	slot.fence = nullptr;
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+	const unsigned char* data = (const unsigned char*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, FrameBytes(), GL_MAP_READ_BIT);
+	if (data != nullptr)
+	{
+		if (sink)
+		{
+			auto start = std::chrono::steady_clock::now();
+			sink(data, slot.frame);
+			sinkMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+		delivered++;
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	slot.frame = -1;
+	return sinkMs;
+}
+
+void Readback::Finish()
+{
+	// oldest first, so the sink still sees frames in order
+	for (size_t i = 0; i < slots.size(); i++)
+	{
+		Slot& slot = slots[(next + i) % slots.size()];
+		if (slot.fence != nullptr)
+			Collect(slot);
+	}
+}
+
+void Readback::PrintReport() const
+{
+	FrameStats stats = ComputeStats(readTimes);
+	if (mode == ReadbackMode::Sync)
+		std::printf("readback: sync glReadPixels, %dx%d, %d frames delivered\n", width, height, delivered);
+	else
+		std::printf("readback: pbo ring %d deep, %dx%d, %d frames delivered, %d stalls waiting on a fence\n",
+			(int)slots.size(), width, height, delivered, stalls);
+	std::printf("          %9s %9s %9s %9s %9s\n", "mean", "p50", "p95", "p99", "max");
+	std::printf("  read ms %9.4f %9.4f %9.4f %9.4f %9.4f\n", stats.mean, stats.p50, stats.p95, stats.p99, stats.max);
+}
@@ -0,0 +1,78 @@
+#ifndef READBACK_CLASS_H
+#define READBACK_CLASS_H
+
+#include<functional>
+#include<vector>
+#include<glad/glad.h>
+
+// * NOTE: getting a rendered frame back to the CPU (for video, screenshots, tests...).
+//   sync: glReadPixels into CPU memory. The call can't return before the GPU has finished the frame, so the render
+//         thread waits for the whole pipeline to drain, every frame
+//   pbo:  glReadPixels into a pixel buffer object (GL_PIXEL_PACK_BUFFER) returns right away, the copy happens on the
+//         GPU side whenever it gets there. A fence goes in behind it, and the buffer is only mapped when it comes
+//         around again in the ring, depth frames later, by which time the fence has (usually) signalled
+//
+// ! pbo frames arrive depth frames late, and Finish() delivers the ones still in flight after the last frame
+// ! pixels are RGBA8, bottom row first (GL's order)
+
+enum class ReadbackMode
+{
+	Sync,
+	Pbo
+};
+
+// gets each frame's pixels, in frame order. The pointer is only valid during the call
+using FrameSink = std::function<void(const unsigned char* rgba, int frame)>;
+
+class Readback
+{
+public:
+	Readback(ReadbackMode mode, int width, int height, int depth = 3);
+	~Readback();
+
+	Readback(const Readback&) = delete;
+	Readback& operator=(const Readback&) = delete;
+
+	void SetSink(FrameSink frameSink) { sink = frameSink; }
+
+	// reads framebuffer's color buffer. Call once the frame is drawn, before the buffers are swapped
+	void ReadFrame(GLuint framebuffer, int frame);
+	// waits for and delivers every frame still in flight
+	void Finish();
+
+	int Width() const { return width; }
+	int Height() const { return height; }
+	size_t FrameBytes() const { return (size_t)width * height * 4; }
+
+	// CPU time per ReadFrame call (minus the sink), what the render thread pays for reading back
+	void PrintReport() const;
+
+private:
+	struct Slot
+	{
+		GLuint buffer = 0;
+		GLsync fence = nullptr;
+		int frame = -1;
+	};
+
+	// maps a pbo slot (waiting for its fence if needed) and hands its pixels to the sink. Returns the sink's time in ms
+	double Collect(Slot& slot);
+
+	ReadbackMode mode;
+	int width;
+	int height;
+	FrameSink sink;
+
+	// sync
+	std::vector<unsigned char> pixels;
+	// pbo
+	std::vector<Slot> slots;
+	int next = 0;
+
+	int delivered = 0;
+	// times a pbo fence hadn't signalled yet when its slot came around
+	int stalls = 0;
+	std::vector<double> readTimes;
+};
+
+#endif
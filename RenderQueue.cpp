@@ -0,0 +1,206 @@
+#include"RenderQueue.h"
+
+#include<chrono>
+#include<cstdio>
+#include<cstring>
+#include<utility>
+
+static const int ProgramBits = 10;
+static const int VaoBits = 12;
+static const int TextureBits = 12;
+static const int MaterialBits = 14;
+static const int DepthBits = 16;
+
+static const int DepthShift = 0;
+static const int MaterialShift = DepthShift + DepthBits;
+static const int TextureShift = MaterialShift + MaterialBits;
+static const int VaoShift = TextureShift + TextureBits;
+static const int ProgramShift = VaoShift + VaoBits;
+static_assert(ProgramShift + ProgramBits == 64, "the sort key fields have to fill exactly 64 bits");
+
+RenderQueue::RenderQueue(bool sort)
+	: sort(sort)
+{
+	// material 0: no tint
+	AddMaterial(1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+uint16_t RenderQueue::AddMaterial(float r, float g, float b, float a)
+{
+	materials.insert(materials.end(), { r, g, b, a });
+	return (uint16_t)(materials.size() / 4 - 1);
+}
+
+void RenderQueue::Submit(const DrawItem& item)
+{
+	keys.push_back({ MakeKey(item), (uint32_t)items.size() });
+	items.push_back(item);
+}
+
+uint32_t RenderQueue::Slot(std::unordered_map<GLuint, uint32_t>& slots, GLuint name, uint32_t limit)
+{
+	// 0 stays 0 so "no texture" sorts first
+	if (name == 0)
+		return 0;
+	auto found = slots.find(name);
+	if (found != slots.end())
+		return found->second;
+	uint32_t slot = 1 + (uint32_t)slots.size() % (limit - 1);
+	slots.emplace(name, slot);
+	return slot;
+}
+
+uint64_t RenderQueue::MakeKey(const DrawItem& item)
+{
+	float depth = item.depth < 0.0f ? 0.0f : (item.depth > 1.0f ? 1.0f : item.depth);
+	uint64_t depthBits = (uint64_t)(depth * ((1 << DepthBits) - 1) + 0.5f);
+
+	return (uint64_t)Slot(programSlots, item.program, 1u << ProgramBits) << ProgramShift
+		| (uint64_t)Slot(vaoSlots, item.vao, 1u << VaoBits) << VaoShift
+		| (uint64_t)Slot(textureSlots, item.texture, 1u << TextureBits) << TextureShift
+		| (uint64_t)(item.material & ((1u << MaterialBits) - 1)) << MaterialShift
+		| depthBits << DepthShift;
+}
+
+void RenderQueue::RadixSort(std::vector<KeyIndex>& items, std::vector<KeyIndex>& scratch)
+{
+	// LSD radix sort, 8 bits per pass: each pass is a stable counting sort on one byte, starting with the lowest.
+	// All 8 histograms are built in one go, and a pass where every key has the same byte is skipped
+	// (common: few programs/VAOs means most of the high bytes are identical)
+	size_t count = items.size();
+	if (count < 2)
+		return;
+	scratch.resize(count);
+
+	uint32_t histograms[8][256];
+	std::memset(histograms, 0, sizeof(histograms));
+	for (const KeyIndex& item : items)
+		for (int pass = 0; pass < 8; pass++)
+			histograms[pass][(item.key >> (pass * 8)) & 0xFF]++;
+
+	KeyIndex* from = items.data();
+	KeyIndex* to = scratch.data();
+	for (int pass = 0; pass < 8; pass++)
+	{
+		uint32_t* histogram = histograms[pass];
+		if (histogram[(from[0].key >> (pass * 8)) & 0xFF] == count)
+			continue;
+
+		// histogram -> where each byte value's run starts in the output
+		uint32_t offset = 0;
+		for (int value = 0; value < 256; value++)
+		{
+			uint32_t n = histogram[value];
+			histogram[value] = offset;
+			offset += n;
+		}
+		for (size_t i = 0; i < count; i++)
+			to[histogram[(from[i].key >> (pass * 8)) & 0xFF]++] = from[i];
+		std::swap(from, to);
+	}
+
+	// an odd number of passes leaves the result in scratch
+	if (from != items.data())
+		items.swap(scratch);
+}
+
+GLint RenderQueue::TintLocation(GLuint program)
+{
+	auto found = tintLocations.find(program);
+	if (found != tintLocations.end())
+		return found->second;
+	GLint location = glGetUniformLocation(program, "uTint");
+	tintLocations.emplace(program, location);
+	return location;
+}
+
+QueueChanges RenderQueue::CountChanges(const std::vector<KeyIndex>& order) const
+{
+	QueueChanges changes;
+	const DrawItem* previous = nullptr;
+	for (const KeyIndex& key : order)
+	{
+		const DrawItem& item = items[key.index];
+		bool newProgram = previous == nullptr || item.program != previous->program;
+		changes.program += newProgram;
+		changes.vao += previous == nullptr || item.vao != previous->vao;
+		changes.texture += previous == nullptr || item.texture != previous->texture;
+		// uniforms belong to the program, so a new program needs its tint set again
+		changes.material += newProgram || item.material != previous->material;
+		previous = &item;
+	}
+	return changes;
+}
+
+void RenderQueue::Flush(StateCache& state)
+{
+	QueueChanges before = CountChanges(keys);
+	unsorted.program += before.program;
+	unsorted.vao += before.vao;
+	unsorted.texture += before.texture;
+	unsorted.material += before.material;
+
+	if (sort)
+	{
+		auto sortStart = std::chrono::steady_clock::now();
+		RadixSort(keys, scratch);
+		sortSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - sortStart).count();
+	}
+
+	QueueChanges after = CountChanges(keys);
+	sorted.program += after.program;
+	sorted.vao += after.vao;
+	sorted.texture += after.texture;
+	sorted.material += after.material;
+
+	// the tint is uniform state we track ourselves: it has to be set again whenever the program changes
+	GLuint tintProgram = 0;
+	uint16_t tintMaterial = 0;
+	bool tintSet = false;
+
+	state.ActiveTexture(GL_TEXTURE0);
+	for (const KeyIndex& key : keys)
+	{
+		const DrawItem& item = items[key.index];
+
+		state.UseProgram(item.program);
+		state.BindVertexArray(item.vao);
+		state.BindTexture(GL_TEXTURE_2D, item.texture);
+
+		if (!tintSet || tintProgram != item.program || tintMaterial != item.material)
+		{
+			GLint location = TintLocation(item.program);
+			if (location >= 0)
+				glUniform4fv(location, 1, &materials[(item.material < materials.size() / 4 ? item.material : 0) * 4]);
+			tintProgram = item.program;
+			tintMaterial = item.material;
+			tintSet = true;
+		}
+
+		glVertexAttrib4fv(1, item.transform);
+		if (item.indexed)
+			glDrawElements(item.mode, item.count, GL_UNSIGNED_INT, (void*)(item.first * sizeof(GLuint)));
+		else
+			glDrawArrays(item.mode, item.first, item.count);
+	}
+
+	draws += items.size();
+	frames++;
+	items.clear();
+	keys.clear();
+}
+
+void RenderQueue::PrintReport() const
+{
+	if (frames == 0)
+		return;
+
+	std::printf("render queue: %.0f draws per frame, %s, %.3f ms/frame sorting\n", (double)draws / frames,
+		sort ? "sorted by state" : "submission order", sort ? 1000.0 * sortSeconds / frames : 0.0);
+	std::printf("  %-20s %10s %10s\n", "state changes", "submitted", "issued");
+	std::printf("  %-20s %10.1f %10.1f\n", "program", (double)unsorted.program / frames, (double)sorted.program / frames);
+	std::printf("  %-20s %10.1f %10.1f\n", "vao", (double)unsorted.vao / frames, (double)sorted.vao / frames);
+	std::printf("  %-20s %10.1f %10.1f\n", "texture", (double)unsorted.texture / frames, (double)sorted.texture / frames);
+	std::printf("  %-20s %10.1f %10.1f\n", "material", (double)unsorted.material / frames, (double)sorted.material / frames);
+	std::printf("  %-20s %10.1f %10.1f\n", "total", (double)unsorted.Total() / frames, (double)sorted.Total() / frames);
+}
@@ -0,0 +1,113 @@
+#ifndef RENDER_QUEUE_CLASS_H
+#define RENDER_QUEUE_CLASS_H
+
+#include<cstdint>
+#include<unordered_map>
+#include<vector>
+#include<glad/glad.h>
+#include"StateCache.h"
+
+// * NOTE: switching program is the most expensive state change, then VAO, then textures, then uniforms (material).
+// If draws are issued in whatever order the scene happens to produce them, we switch all of those constantly.
+// The queue collects every draw of the frame first, turns the state each one needs into ONE 64-bit number (the sort
+// key), sorts the keys and then issues the draws in key order, so draws that share state end up next to each other.
+//
+// key layout, most significant bits first (sorting by the key = sorting by program, then VAO, then ...):
+//   63..54  program   (10 bits)
+//   53..42  VAO       (12 bits)
+//   41..30  texture   (12 bits)
+//   29..16  material  (14 bits)
+//   15..0   depth     (16 bits, near first: with a depth buffer the hidden pixels get rejected before shading)
+//
+// GL names can be any number, so every program/VAO/texture gets a small "slot" the first time the queue sees it.
+// If there are more than fit, slots get shared: the order just gets a bit worse, the draws are still correct because
+// the state is compared by GL name when issuing.
+
+// one draw call and all the state it needs
+struct DrawItem
+{
+	GLuint program = 0;
+	GLuint vao = 0;
+	GLuint texture = 0;      // GL_TEXTURE_2D on unit 0, 0 = none
+	uint16_t material = 0;   // from RenderQueue::AddMaterial
+	float depth = 0.0f;      // 0 = near .. 1 = far
+
+	GLenum mode = GL_TRIANGLES;
+	GLint first = 0;
+	GLsizei count = 0;
+	bool indexed = false;    // GL_UNSIGNED_INT indices from the VAO's element buffer, starting at first
+
+	// offset.xy, scale, rotation: set as a constant value of attribute 1 (like the naive stress scene)
+	float transform[4] = { 0.0f, 0.0f, 1.0f, 0.0f };
+};
+
+// how many times each kind of state had to change over the draws of one or more frames
+struct QueueChanges
+{
+	uint64_t program = 0;
+	uint64_t vao = 0;
+	uint64_t texture = 0;
+	uint64_t material = 0;
+
+	uint64_t Total() const { return program + vao + texture + material; }
+};
+
+class RenderQueue
+{
+public:
+	// sort = false issues the draws in submission order, to compare against
+	explicit RenderQueue(bool sort = true);
+
+	// a material is a tint color, set as the vec4 uniform "uTint" of whatever program draws with it
+	uint16_t AddMaterial(float r, float g, float b, float a);
+
+	// queues a draw for this frame
+	void Submit(const DrawItem& item);
+
+	// sorts the frame's draws (if enabled), issues them through the state cache and empties the queue
+	void Flush(StateCache& state);
+
+	// state changes the draws would have needed in submission order, and the ones they needed in issue order
+	const QueueChanges& Unsorted() const { return unsorted; }
+	const QueueChanges& Sorted() const { return sorted; }
+	int Frames() const { return frames; }
+
+	// per-frame averages of the counters above, plus the time spent sorting
+	void PrintReport() const;
+
+	// sorts keys (and the draw indices riding along with them) from smallest to largest, keeping equal keys in
+	// submission order. scratch is resized as needed
+	struct KeyIndex
+	{
+		uint64_t key;
+		uint32_t index;
+	};
+	static void RadixSort(std::vector<KeyIndex>& items, std::vector<KeyIndex>& scratch);
+
+private:
+	uint64_t MakeKey(const DrawItem& item);
+	static uint32_t Slot(std::unordered_map<GLuint, uint32_t>& slots, GLuint name, uint32_t limit);
+	GLint TintLocation(GLuint program);
+
+	// counts the state changes of issuing the items in the given order
+	QueueChanges CountChanges(const std::vector<KeyIndex>& order) const;
+
+	bool sort;
+	std::vector<DrawItem> items;
+	std::vector<KeyIndex> keys;
+	std::vector<KeyIndex> scratch;
+
+	std::unordered_map<GLuint, uint32_t> programSlots;
+	std::unordered_map<GLuint, uint32_t> vaoSlots;
+	std::unordered_map<GLuint, uint32_t> textureSlots;
+	std::unordered_map<GLuint, GLint> tintLocations;
+	std::vector<float> materials; // 4 floats each
+
+	QueueChanges unsorted;
+	QueueChanges sorted;
+	int frames = 0;
+	uint64_t draws = 0;
+	double sortSeconds = 0.0;
+};
+
+#endif
@@ -0,0 +1,75 @@
+#include<cstdlib>
+#include<cstring>
+#include<iostream>
+#include<glad/glad.h>
+
+#include"Backend.h"
+#include"GLReplay.h"
+
+// gl_replay: plays a file written by "openGL --capture FILE" back, headless when the build has EGL
+//   gl_replay capture.glcap [--loops N]
+int main(int argc, char** argv)
+{
+	const char* path = nullptr;
+	int loops = 1;
+	bool ok = true;
+	for (int i = 1; i < argc && ok; i++)
+	{
+		if (std::strcmp(argv[i], "--loops") == 0 && i + 1 < argc)
+			loops = std::atoi(argv[++i]);
+		else if (argv[i][0] != '-' && path == nullptr)
+			path = argv[i];
+		else
+			ok = false;
+	}
+	if (!ok || path == nullptr || loops < 1)
+	{
+		std::cout << "usage: " << argv[0] << " CAPTURE [--loops N]\n"
+			<< "  --loops N   play the captured frames N times (the setup and cleanup only once)" << std::endl;
+		return -1;
+	}
+
+	GLReplayer replayer;
+	if (!replayer.Load(path))
+		return -1;
+
+	// no window needed to replay, but a window will do if that's all this build has
+	std::unique_ptr<Backend> backend = CreateBackend(BackendType::Headless);
+	if (backend == nullptr)
+		backend = CreateBackend(BackendType::Window);
+	if (backend == nullptr || !backend->Init(replayer.Width(), replayer.Height(), "gl_replay"))
+	{
+		std::cout << "No backend to replay with" << std::endl;
+		return -1;
+	}
+
+#ifdef GLAD_MX
+	// the gl* macros go through the thread's table in a GLAD_MX build (see main.cpp)
+	static GladGLContext glContext;
+	int loaded = gladLoadGLContext(&glContext, backend->GetProcLoader());
+	gladSetGLContext(&glContext);
+#else
+	int loaded = gladLoadGLLoader(backend->GetProcLoader());
+#endif
+	if (!loaded)
+	{
+		std::cout << "Failed to load OpenGL functions" << std::endl;
+		backend->Shutdown();
+		return -1;
+	}
+	if (!backend->CreateTargets())
+	{
+		backend->Shutdown();
+		return -1;
+	}
+	std::cout << "replaying " << path << " on " << backend->Name() << " (" << glGetString(GL_RENDERER) << "), "
+		<< replayer.Width() << "x" << replayer.Height() << std::endl;
+
+	// whatever the captured run drew into its window now goes into our framebuffer
+	replayer.SetDefaultFramebuffer(backend->Framebuffer());
+	ok = replayer.Play(loops);
+	replayer.PrintReport();
+
+	backend->Shutdown();
+	return ok ? 0 : -1;
+}
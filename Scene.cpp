@@ -0,0 +1,25 @@
+#include"Scene.h"
+
+#include"MeshScene.h"
+#include"Options.h"
+#include"QueueScene.h"
+#include"StressScene.h"
+#include"TriangleScene.h"
+
+std::unique_ptr<Scene> CreateScene(const AppOptions& options)
+{
+	switch (options.scene)
+	{
+	case SceneType::Triangle:
+		return std::unique_ptr<Scene>(new TriangleScene(options.stream, options.persistentMapping));
+	case SceneType::Naive:
+		return std::unique_ptr<Scene>(new StressScene(false, options.instances));
+	case SceneType::Instanced:
+		return std::unique_ptr<Scene>(new StressScene(true, options.instances));
+	case SceneType::Queue:
+		return std::unique_ptr<Scene>(new QueueScene(options.instances, options.sortDraws));
+	case SceneType::Mesh:
+		return std::unique_ptr<Scene>(new MeshScene(options.instances, options.meshOpt, options.meshFile, options.meshCacheDir, options.meshThreads, options.vertexFormat));
+	}
+	return nullptr;
+}
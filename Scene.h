@@ -0,0 +1,54 @@
+#ifndef SCENE_CLASS_H
+#define SCENE_CLASS_H
+
+#include<memory>
+#include"ShaderManager.h"
+#include"StateCache.h"
+
+struct AppOptions;
+
+// * NOTE: a scene is "what gets drawn": its buffers, VAOs, programs and the draw calls.
+// main.cpp owns the context, the loop and the clear, and just asks the current scene to draw each frame,
+// so every scene gets the same backends, benchmark and state cache for free.
+//
+// ! a scene's GL objects are deleted in its destructor, so destroy the scene BEFORE the backend destroys the context
+
+class SoftRasterizer;
+class VertexArrayCache;
+
+class Scene
+{
+public:
+	virtual ~Scene() {}
+
+	virtual const char* Name() const = 0;
+
+	// queues the scene's programs on the manager, and nothing else. The caller submits them right away, so the
+	// driver compiles while BuildGeometry runs; programs are only waited for the first time Draw needs them
+	virtual void AddPrograms(ShaderManager& shaders) = 0;
+
+	// creates buffers and VAOs (and loads whatever the scene draws), after the programs were submitted. The VAOs
+	// come from the context's cache, shared with whatever else draws; the scene Releases its buffers from it in
+	// its destructor, before deleting them (see VertexArrayCache.h)
+	virtual bool BuildGeometry(VertexArrayCache& vertexArrays) = 0;
+
+	// issues the draws for one frame, after the backend bound the target and main cleared it
+	virtual void Draw(StateCache& state, int frame) = 0;
+
+	// the CPU rasterizer path (--soft, see SoftRasterizer.h): there's no GL context then, so these stand in for
+	// AddPrograms + BuildGeometry and Draw. Scenes that don't have one keep the defaults and --soft refuses them
+	virtual bool InitSoftware() { return false; }
+	virtual void DrawSoftware(SoftRasterizer& raster, int frame) { (void)raster; (void)frame; }
+
+	// objects drawn and draw calls issued per frame, so main can turn frames/sec into objects/sec
+	virtual int Objects() const { return 1; }
+	virtual int DrawCalls() const { return 1; }
+
+	// scene specific numbers printed after the loop
+	virtual void PrintReport() const {}
+};
+
+// the scene selected with --scene, nullptr if the name is unknown
+std::unique_ptr<Scene> CreateScene(const AppOptions& options);
+
+#endif
@@ -0,0 +1,196 @@
+#include"ShaderManager.h"
+
+#include<iostream>
+#include<utility>
+#include"ProgramCache.h"
+
+ShaderManager::ShaderManager(ProgramCache* cache)
+	: cache(cache)
+{
+	if (GLAD_GL_KHR_parallel_shader_compile)
+	{
+		// let the driver use as many compiler threads as it wants (0xFFFFFFFF = implementation maximum)
+		glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+		parallel = true;
+	}
+}
+
+ShaderManager::~ShaderManager()
+{
+	for (Entry& entry : programs)
+	{
+		if (entry.vertexShader != 0)
+			glDeleteShader(entry.vertexShader);
+		if (entry.fragmentShader != 0)
+			glDeleteShader(entry.fragmentShader);
+	}
+}
+
+ProgramHandle ShaderManager::Add(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource)
+{
+	Entry entry;
+	entry.name = name;
+	entry.vertexSource = vertexSource;
+	entry.fragmentSource = fragmentSource;
+	programs.push_back(std::move(entry));
+	return (ProgramHandle)programs.size() - 1;
+}
+
+void ShaderManager::Submit()
+{
+	// all compiles first, so a threaded compiler has every shader queued before the first link needs results
+	for (Entry& entry : programs)
+		if (entry.state == State::Queued)
+			Compile(entry);
+	for (Entry& entry : programs)
+		if (entry.state == State::Compiling)
+			Link(entry);
+}
+
+void ShaderManager::Compile(Entry& entry)
+{
+	// a binary from the program cache is already linked, skip straight to Ready
+	if (cache != nullptr)
+	{
+		entry.program = Shader(cache->Load(entry.vertexSource.c_str(), entry.fragmentSource.c_str()));
+		if (entry.program.ID != 0)
+		{
+			entry.state = State::Ready;
+			fromCache++;
+			return;
+		}
+	}
+
+	const char* vertexSource = entry.vertexSource.c_str();
+	const char* fragmentSource = entry.fragmentSource.c_str();
+
+	// OpenGL variable version type of a uint ("positive" integer). Sort of like a code number to refer to that shader now
+		// Creates a GLuint variable to reference the vertex shader CREATED BY the glCreateShader function
+	entry.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+
+	// GL shader source specifies the shader source to our shader object
+		// 1st param is the shader object created (GLuint)
+		// 3rd param is a reference to the source string
+	glShaderSource(entry.vertexShader, 1, &vertexSource, NULL);
+
+	// compiled into machine code so that it can be used by the GPU.
+	// this only QUEUES the compile: the driver may do it right now or on another thread
+	glCompileShader(entry.vertexShader);
+
+	// same thing for the fragment shader
+	entry.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(entry.fragmentShader, 1, &fragmentSource, NULL);
+	glCompileShader(entry.fragmentShader);
+
+	entry.state = State::Compiling;
+}
+
+void ShaderManager::Link(Entry& entry)
+{
+	// creates a shader program
+	entry.program = Shader(glCreateProgram());
+	// similar deal, attaching the vertex and fragment shaders to the shader program
+	glAttachShader(entry.program.ID, entry.vertexShader);
+	glAttachShader(entry.program.ID, entry.fragmentShader);
+
+	// asks the driver to keep the linked binary around so the cache can save it
+	if (cache != nullptr)
+		cache->PrepareForLink(entry.program.ID);
+
+	// LINKING is different than attaching. Really combines the attached shaders to the program to be executed on the GPU.
+	// like compiling, this doesn't wait: it's the status query in Finish that does
+	glLinkProgram(entry.program.ID);
+
+	entry.state = State::Linking;
+}
+
+// prints the info log of a shader or program
+static void PrintLog(const std::string& name, const char* what, GLuint object, bool isProgram)
+{
+	GLint length = 0;
+	if (isProgram)
+		glGetProgramiv(object, GL_INFO_LOG_LENGTH, &length);
+	else
+		glGetShaderiv(object, GL_INFO_LOG_LENGTH, &length);
+
+	std::string log(length > 0 ? length : 1, '\0');
+	if (isProgram)
+		glGetProgramInfoLog(object, (GLsizei)log.size(), NULL, &log[0]);
+	else
+		glGetShaderInfoLog(object, (GLsizei)log.size(), NULL, &log[0]);
+	std::cout << "Shader program \"" << name << "\": " << what << " failed\n" << log.c_str() << std::endl;
+}
+
+void ShaderManager::Finish(Entry& entry)
+{
+	// THIS is where we actually wait for the driver
+	GLint linked = GL_FALSE;
+	glGetProgramiv(entry.program.ID, GL_LINK_STATUS, &linked);
+
+	if (!linked)
+	{
+		// the link failing is usually a compile error, show that one if there is one
+		GLint compiled = GL_FALSE;
+		glGetShaderiv(entry.vertexShader, GL_COMPILE_STATUS, &compiled);
+		if (!compiled)
+			PrintLog(entry.name, "vertex shader compile", entry.vertexShader, false);
+		glGetShaderiv(entry.fragmentShader, GL_COMPILE_STATUS, &compiled);
+		if (!compiled)
+			PrintLog(entry.name, "fragment shader compile", entry.fragmentShader, false);
+		PrintLog(entry.name, "link", entry.program.ID, true);
+	}
+
+	// deletes the shaders from taking up memory since the linking essentially "copies" all the data it needs to from them to put them in one program
+	glDetachShader(entry.program.ID, entry.vertexShader);
+	glDetachShader(entry.program.ID, entry.fragmentShader);
+	glDeleteShader(entry.vertexShader);
+	glDeleteShader(entry.fragmentShader);
+	entry.vertexShader = entry.fragmentShader = 0;
+
+	if (!linked)
+	{
+		entry.program.Delete();
+		entry.state = State::Failed;
+		failed++;
+		return;
+	}
+
+	if (cache != nullptr)
+		cache->Store(entry.program.ID, entry.vertexSource.c_str(), entry.fragmentSource.c_str());
+	entry.state = State::Ready;
+}
+
+GLuint ShaderManager::Get(ProgramHandle handle)
+{
+	Entry& entry = programs[handle];
+	if (entry.state == State::Queued || entry.state == State::Compiling)
+		Submit();
+	if (entry.state == State::Linking)
+		Finish(entry);
+	return entry.program.ID;
+}
+
+bool ShaderManager::IsReady(ProgramHandle handle)
+{
+	Entry& entry = programs[handle];
+	if (entry.state == State::Ready || entry.state == State::Failed)
+		return true;
+	// not even submitted yet
+	if (entry.state != State::Linking)
+		return false;
+	// no way to ask without blocking
+	if (!parallel)
+		return true;
+
+	GLint done = GL_FALSE;
+	glGetProgramiv(entry.program.ID, GL_COMPLETION_STATUS_KHR, &done);
+	return done == GL_TRUE;
+}
+
+void ShaderManager::WaitAll()
+{
+	Submit();
+	for (Entry& entry : programs)
+		if (entry.state == State::Linking)
+			Finish(entry);
+}
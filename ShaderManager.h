@@ -0,0 +1,84 @@
+#ifndef SHADER_MANAGER_CLASS_H
+#define SHADER_MANAGER_CLASS_H
+
+#include<string>
+#include<vector>
+#include<glad/glad.h>
+#include"shaderClass.h"
+
+class ProgramCache;
+
+// * NOTE: glCompileShader and glLinkProgram don't actually have to block. Many drivers compile on background threads,
+// and the only thing that forces us to WAIT is asking for the result (GL_COMPILE_STATUS / GL_LINK_STATUS).
+// So the manager queues every program first, then issues all the compiles, then all the links, and only checks the
+// status of a program the first time somebody needs it. With KHR_parallel_shader_compile we can also ask
+// "is it done yet?" (GL_COMPLETION_STATUS_KHR) without blocking.
+
+// index of a program inside the manager, stays valid for the manager's lifetime
+typedef int ProgramHandle;
+
+class ShaderManager
+{
+public:
+	// cache is optional, programs found in it skip compiling altogether
+	explicit ShaderManager(ProgramCache* cache = nullptr);
+	// deletes every program it created (the Shader handles do that) and any shaders still compiling
+	~ShaderManager();
+
+	ShaderManager(const ShaderManager&) = delete;
+	ShaderManager& operator=(const ShaderManager&) = delete;
+
+	// queues a program. Nothing is compiled until Submit (or the first Get)
+	ProgramHandle Add(const std::string& name, const std::string& vertexSource, const std::string& fragmentSource);
+
+	// issues compiles for every queued program, then links for all of them. Doesn't wait for any of them
+	void Submit();
+
+	// the program's GL name, or 0 if it failed to build. The first call per program waits for it and checks for errors
+	GLuint Get(ProgramHandle handle);
+
+	// true once Get won't block. Without KHR_parallel_shader_compile there's no way to ask, so this is always true then
+	bool IsReady(ProgramHandle handle);
+
+	// waits for every program and checks them all
+	void WaitAll();
+
+	int Count() const { return (int)programs.size(); }
+	int FromCache() const { return fromCache; }
+	int Failed() const { return failed; }
+	bool Parallel() const { return parallel; }
+
+private:
+	enum class State
+	{
+		Queued,    // only the sources exist
+		Compiling, // shaders are compiling, program not linked yet
+		Linking,   // glLinkProgram issued, status not checked yet
+		Ready,
+		Failed
+	};
+
+	// move-only because of the Shader handle, so the vector relocates entries without touching GL
+	struct Entry
+	{
+		std::string name;
+		std::string vertexSource;
+		std::string fragmentSource;
+		GLuint vertexShader = 0;
+		GLuint fragmentShader = 0;
+		Shader program;
+		State state = State::Queued;
+	};
+
+	void Compile(Entry& entry);
+	void Link(Entry& entry);
+	void Finish(Entry& entry);
+
+	ProgramCache* cache;
+	std::vector<Entry> programs;
+	bool parallel = false;
+	int fromCache = 0;
+	int failed = 0;
+};
+
+#endif
@@ -0,0 +1,13 @@
+#include"SoftRasterKernel.h"
+
+// * NOTE: the only file built with AVX2 enabled (-mavx2, see CMakeLists.txt / the vcxproj). Nothing else goes in here:
+// any code in this file may use AVX2 instructions, and it must only ever run after SoftRasterizer checked the CPU
+
+SoftTriangleKernel SoftAvx2Kernel()
+{
+#if defined(__AVX2__)
+	return &RasterTriangle<Avx2Lanes>;
+#else
+	return nullptr;
+#endif
+}
@@ -0,0 +1,313 @@
+#ifndef SOFT_RASTER_KERNEL_CLASS_H
+#define SOFT_RASTER_KERNEL_CLASS_H
+
+#include<cstddef>
+#include<cstdint>
+
+// * NOTE: the inner loop of SoftRasterizer: one set-up triangle into one tile, N pixels of a row at a time.
+// It's written once against a small "lanes" interface and compiled for plain C++ (1 lane), SSE2 (4) and AVX2 (8).
+// The AVX2 copy lives in its own file built with -mavx2, and SoftRasterizer only calls it when the CPU has AVX2.
+//
+// ! everything with code in it is in an anonymous namespace ON PURPOSE: every file that includes this gets its own
+// copy, so the linker can't merge the AVX2 file's copy of a helper into the SSE2 path (illegal instruction on CPUs
+// without AVX2). Same reason there's no std::min/max in here: in a debug build those are real functions, and the
+// linker keeps whichever copy it sees first
+
+// a triangle after setup, in pixels (x right, y UP like GL's window coordinates). Counter-clockwise.
+// Edge functions are in 1/16 pixel fixed point: E = a * X + b * Y + c at sample (X, Y) = (16 * x + 8, 16 * y + 8),
+// inside where all three are >= 0 (the fill rule is folded into c). Attributes are planes over pixel centers:
+// value(x, y) = plane[0] + plane[1] * x + plane[2] * y
+struct SoftTriangle
+{
+	int minX, minY, maxX, maxY; // pixel bounding box, inclusive, already clipped to the screen
+	int32_t a[3];
+	int32_t b[3];
+	int64_t c[3];
+	float depth[3];             // 0..1, like gl_FragCoord.z
+	float red[3];
+	float green[3];
+	float blue[3];
+};
+
+// what a tile job draws into. Rows are stride pixels apart and stride is a multiple of 8, so a full group of lanes
+// never reaches into the next row (another tile, maybe another thread)
+struct SoftTarget
+{
+	uint32_t* color; // RGBA8, bottom row first
+	float* depth;
+	int stride;
+};
+
+// the pixels [x0, x1) x [y0, y1) one job owns. x0 is a multiple of 8
+struct SoftRect
+{
+	int x0, y0, x1, y1;
+};
+
+// rasterizes t inside rect, returns how many pixels it wrote
+typedef uint64_t(*SoftTriangleKernel)(const SoftTriangle& t, const SoftRect& rect, const SoftTarget& target, bool depthTest);
+
+// the AVX2 copy (SoftRasterAvx2.cpp), nullptr when that file wasn't built with AVX2 enabled
+SoftTriangleKernel SoftAvx2Kernel();
+
+namespace
+{
+	template<class T> inline T KernelMin(T a, T b) { return a < b ? a : b; }
+	template<class T> inline T KernelMax(T a, T b) { return a > b ? a : b; }
+
+	template<class L>
+	uint64_t RasterTriangle(const SoftTriangle& t, const SoftRect& rect, const SoftTarget& target, bool depthTest)
+	{
+		typedef typename L::Int Int;
+		typedef typename L::Float Float;
+
+		int x0 = KernelMax(t.minX, rect.x0), x1 = KernelMin(t.maxX + 1, rect.x1);
+		int y0 = KernelMax(t.minY, rect.y0), y1 = KernelMin(t.maxY + 1, rect.y1);
+		if (x0 >= x1 || y0 >= y1)
+			return 0;
+		// groups of lanes start on a multiple of the lane count, the ones before x0 get masked off
+		int xStart = x0 & ~(L::Count - 1);
+
+		// classify the rectangle against every edge at its corner samples: all outside -> nothing to do,
+		// all inside -> the edge can't reject anything here, so it's left out of the per-pixel test (it's set to 0,
+		// which passes). Only edges that really cross the rectangle stay, and those are small enough for 32 bits
+		int32_t edgeRow[3], stepX[3], stepY[3];
+		for (int e = 0; e < 3; e++)
+		{
+			int64_t sx0 = (int64_t)xStart * 16 + 8, sx1 = (int64_t)(x1 - 1) * 16 + 8;
+			int64_t sy0 = (int64_t)y0 * 16 + 8, sy1 = (int64_t)(y1 - 1) * 16 + 8;
+			int64_t e00 = t.a[e] * sx0 + t.b[e] * sy0 + t.c[e];
+			int64_t e10 = t.a[e] * sx1 + t.b[e] * sy0 + t.c[e];
+			int64_t e01 = t.a[e] * sx0 + t.b[e] * sy1 + t.c[e];
+			int64_t e11 = t.a[e] * sx1 + t.b[e] * sy1 + t.c[e];
+			int64_t low = KernelMin(KernelMin(e00, e10), KernelMin(e01, e11));
+			int64_t high = KernelMax(KernelMax(e00, e10), KernelMax(e01, e11));
+			if (high < 0)
+				return 0;
+			if (low >= 0)
+			{
+				edgeRow[e] = stepX[e] = stepY[e] = 0;
+				continue;
+			}
+			edgeRow[e] = (int32_t)e00;
+			stepX[e] = t.a[e] * 16;
+			stepY[e] = t.b[e] * 16;
+		}
+
+		const Int laneIndex = L::RampI(1);
+		const Int first = L::SetI(x0 - 1);
+		const Int last = L::SetI(x1);
+		Int edgeStep[3], edgeGroup[3];
+		for (int e = 0; e < 3; e++)
+		{
+			edgeStep[e] = L::RampI(stepX[e]);
+			edgeGroup[e] = L::SetI(stepX[e] * L::Count);
+		}
+		const float* planes[4] = { t.depth, t.red, t.green, t.blue };
+		Float planeStep[4], planeGroup[4];
+		float planeRow[4];
+		for (int p = 0; p < 4; p++)
+		{
+			planeStep[p] = L::RampF(planes[p][1]);
+			planeGroup[p] = L::SetF(planes[p][1] * L::Count);
+			planeRow[p] = planes[p][0] + planes[p][1] * xStart + planes[p][2] * y0;
+		}
+		const Float zero = L::SetF(0.0f), one = L::SetF(1.0f), scale = L::SetF(255.0f), half = L::SetF(0.5f);
+		const Int alpha = L::SetI((int32_t)0xff000000u);
+
+		uint64_t written = 0;
+		for (int y = y0; y < y1; y++)
+		{
+			Int e0 = L::AddI(L::SetI(edgeRow[0]), edgeStep[0]);
+			Int e1 = L::AddI(L::SetI(edgeRow[1]), edgeStep[1]);
+			Int e2 = L::AddI(L::SetI(edgeRow[2]), edgeStep[2]);
+			Float depth = L::AddF(L::SetF(planeRow[0]), planeStep[0]);
+			Float red = L::AddF(L::SetF(planeRow[1]), planeStep[1]);
+			Float green = L::AddF(L::SetF(planeRow[2]), planeStep[2]);
+			Float blue = L::AddF(L::SetF(planeRow[3]), planeStep[3]);
+			uint32_t* colorRow = target.color + (size_t)y * target.stride;
+			float* depthRow = target.depth + (size_t)y * target.stride;
+
+			for (int x = xStart; x < x1; x += L::Count)
+			{
+				// inside all three edges = none of them negative, and inside [x0, x1)
+				Int xs = L::AddI(L::SetI(x), laneIndex);
+				Int mask = L::AndNotI(L::SignI(L::OrI(L::OrI(e0, e1), e2)), L::AndI(L::GreaterI(xs, first), L::GreaterI(last, xs)));
+				if (L::Any(mask))
+				{
+					// depth outside 0..1 is outside the near/far planes, GL would have clipped it
+					mask = L::AndI(mask, L::AndI(L::GreaterEqualF(depth, zero), L::GreaterEqualF(one, depth)));
+					if (depthTest)
+					{
+						Float stored = L::LoadF(depthRow + x);
+						mask = L::AndI(mask, L::GreaterF(stored, depth));
+						L::StoreF(depthRow + x, L::SelectF(mask, depth, stored));
+					}
+					if (L::Any(mask))
+					{
+						Int r = L::ToInt(L::AddF(L::MulF(L::MinF(L::MaxF(red, zero), one), scale), half));
+						Int g = L::ToInt(L::AddF(L::MulF(L::MinF(L::MaxF(green, zero), one), scale), half));
+						Int b = L::ToInt(L::AddF(L::MulF(L::MinF(L::MaxF(blue, zero), one), scale), half));
+						Int rgba = L::OrI(L::OrI(r, L::template ShiftLeftI<8>(g)), L::OrI(L::template ShiftLeftI<16>(b), alpha));
+						L::StoreI(colorRow + x, L::SelectI(mask, rgba, L::LoadI(colorRow + x)));
+						written += L::Count1(mask);
+					}
+				}
+				e0 = L::AddI(e0, edgeGroup[0]);
+				e1 = L::AddI(e1, edgeGroup[1]);
+				e2 = L::AddI(e2, edgeGroup[2]);
+				depth = L::AddF(depth, planeGroup[0]);
+				red = L::AddF(red, planeGroup[1]);
+				green = L::AddF(green, planeGroup[2]);
+				blue = L::AddF(blue, planeGroup[3]);
+			}
+
+			for (int e = 0; e < 3; e++)
+				edgeRow[e] += stepY[e];
+			for (int p = 0; p < 4; p++)
+				planeRow[p] += planes[p][2];
+		}
+		return written;
+	}
+
+	// one pixel at a time, what the other lane types are checked against. Masks are 0 / -1
+	struct ScalarLanes
+	{
+		static const int Count = 1;
+		typedef int32_t Int;
+		typedef float Float;
+
+		static Int SetI(int32_t v) { return v; }
+		static Int RampI(int32_t) { return 0; }
+		static Int AddI(Int a, Int b) { return (Int)((uint32_t)a + (uint32_t)b); }
+		static Int OrI(Int a, Int b) { return a | b; }
+		static Int AndI(Int a, Int b) { return a & b; }
+		// ~a & b
+		static Int AndNotI(Int a, Int b) { return ~a & b; }
+		// -1 where negative
+		static Int SignI(Int a) { return a < 0 ? -1 : 0; }
+		static Int GreaterI(Int a, Int b) { return a > b ? -1 : 0; }
+		template<int Bits> static Int ShiftLeftI(Int a) { return (Int)((uint32_t)a << Bits); }
+		static Int SelectI(Int mask, Int a, Int b) { return mask ? a : b; }
+		static Int LoadI(const uint32_t* p) { return (Int)*p; }
+		static void StoreI(uint32_t* p, Int v) { *p = (uint32_t)v; }
+		static bool Any(Int mask) { return mask != 0; }
+		static int Count1(Int mask) { return mask != 0 ? 1 : 0; }
+
+		static Float SetF(float v) { return v; }
+		static Float RampF(float) { return 0.0f; }
+		static Float AddF(Float a, Float b) { return a + b; }
+		static Float MulF(Float a, Float b) { return a * b; }
+		static Float MinF(Float a, Float b) { return a < b ? a : b; }
+		static Float MaxF(Float a, Float b) { return a > b ? a : b; }
+		static Int GreaterF(Float a, Float b) { return a > b ? -1 : 0; }
+		static Int GreaterEqualF(Float a, Float b) { return a >= b ? -1 : 0; }
+		static Int ToInt(Float a) { return (Int)a; }
+		static Float SelectF(Int mask, Float a, Float b) { return mask ? a : b; }
+		static Float LoadF(const float* p) { return *p; }
+		static void StoreF(float* p, Float v) { *p = v; }
+	};
+}
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOFT_RASTER_SSE2 1
+#include<emmintrin.h>
+
+namespace
+{
+	struct Sse2Lanes
+	{
+		static const int Count = 4;
+		typedef __m128i Int;
+		typedef __m128 Float;
+
+		static Int SetI(int32_t v) { return _mm_set1_epi32(v); }
+		static Int RampI(int32_t step) { return _mm_setr_epi32(0, step, step * 2, step * 3); }
+		static Int AddI(Int a, Int b) { return _mm_add_epi32(a, b); }
+		static Int OrI(Int a, Int b) { return _mm_or_si128(a, b); }
+		static Int AndI(Int a, Int b) { return _mm_and_si128(a, b); }
+		static Int AndNotI(Int a, Int b) { return _mm_andnot_si128(a, b); }
+		static Int SignI(Int a) { return _mm_srai_epi32(a, 31); }
+		static Int GreaterI(Int a, Int b) { return _mm_cmpgt_epi32(a, b); }
+		template<int Bits> static Int ShiftLeftI(Int a) { return _mm_slli_epi32(a, Bits); }
+		// no blendv before SSE4.1
+		static Int SelectI(Int mask, Int a, Int b) { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+		static Int LoadI(const uint32_t* p) { return _mm_loadu_si128((const __m128i*)p); }
+		static void StoreI(uint32_t* p, Int v) { _mm_storeu_si128((__m128i*)p, v); }
+		static bool Any(Int mask) { return _mm_movemask_ps(_mm_castsi128_ps(mask)) != 0; }
+		static int Count1(Int mask)
+		{
+			int bits = _mm_movemask_ps(_mm_castsi128_ps(mask));
+			return (bits & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + ((bits >> 3) & 1);
+		}
+
+		static Float SetF(float v) { return _mm_set1_ps(v); }
+		static Float RampF(float step) { return _mm_setr_ps(0.0f, step, step * 2.0f, step * 3.0f); }
+		static Float AddF(Float a, Float b) { return _mm_add_ps(a, b); }
+		static Float MulF(Float a, Float b) { return _mm_mul_ps(a, b); }
+		static Float MinF(Float a, Float b) { return _mm_min_ps(a, b); }
+		static Float MaxF(Float a, Float b) { return _mm_max_ps(a, b); }
+		static Int GreaterF(Float a, Float b) { return _mm_castps_si128(_mm_cmpgt_ps(a, b)); }
+		static Int GreaterEqualF(Float a, Float b) { return _mm_castps_si128(_mm_cmpge_ps(a, b)); }
+		static Int ToInt(Float a) { return _mm_cvttps_epi32(a); }
+		static Float SelectF(Int mask, Float a, Float b)
+		{
+			__m128 m = _mm_castsi128_ps(mask);
+			return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+		}
+		static Float LoadF(const float* p) { return _mm_loadu_ps(p); }
+		static void StoreF(float* p, Float v) { _mm_storeu_ps(p, v); }
+	};
+}
+#endif
+
+#if defined(__AVX2__)
+#include<immintrin.h>
+
+namespace
+{
+	struct Avx2Lanes
+	{
+		static const int Count = 8;
+		typedef __m256i Int;
+		typedef __m256 Float;
+
+		static Int SetI(int32_t v) { return _mm256_set1_epi32(v); }
+		static Int RampI(int32_t step) { return _mm256_mullo_epi32(_mm256_set1_epi32(step), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)); }
+		static Int AddI(Int a, Int b) { return _mm256_add_epi32(a, b); }
+		static Int OrI(Int a, Int b) { return _mm256_or_si256(a, b); }
+		static Int AndI(Int a, Int b) { return _mm256_and_si256(a, b); }
+		static Int AndNotI(Int a, Int b) { return _mm256_andnot_si256(a, b); }
+		static Int SignI(Int a) { return _mm256_srai_epi32(a, 31); }
+		static Int GreaterI(Int a, Int b) { return _mm256_cmpgt_epi32(a, b); }
+		template<int Bits> static Int ShiftLeftI(Int a) { return _mm256_slli_epi32(a, Bits); }
+		static Int SelectI(Int mask, Int a, Int b) { return _mm256_blendv_epi8(b, a, mask); }
+		static Int LoadI(const uint32_t* p) { return _mm256_loadu_si256((const __m256i*)p); }
+		static void StoreI(uint32_t* p, Int v) { _mm256_storeu_si256((__m256i*)p, v); }
+		static bool Any(Int mask) { return !_mm256_testz_si256(mask, mask); }
+		static int Count1(Int mask)
+		{
+			unsigned bits = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(mask));
+			int count = 0;
+			for (; bits != 0; bits &= bits - 1)
+				count++;
+			return count;
+		}
+
+		static Float SetF(float v) { return _mm256_set1_ps(v); }
+		static Float RampF(float step) { return _mm256_mul_ps(_mm256_set1_ps(step), _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7)); }
+		static Float AddF(Float a, Float b) { return _mm256_add_ps(a, b); }
+		static Float MulF(Float a, Float b) { return _mm256_mul_ps(a, b); }
+		static Float MinF(Float a, Float b) { return _mm256_min_ps(a, b); }
+		static Float MaxF(Float a, Float b) { return _mm256_max_ps(a, b); }
+		static Int GreaterF(Float a, Float b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+		static Int GreaterEqualF(Float a, Float b) { return _mm256_castps_si256(_mm256_cmp_ps(a, b, _CMP_GE_OQ)); }
+		static Int ToInt(Float a) { return _mm256_cvttps_epi32(a); }
+		static Float SelectF(Int mask, Float a, Float b) { return _mm256_blendv_ps(b, a, _mm256_castsi256_ps(mask)); }
+		static Float LoadF(const float* p) { return _mm256_loadu_ps(p); }
+		static void StoreF(float* p, Float v) { _mm256_storeu_ps(p, v); }
+	};
+}
+#endif
+
+#endif
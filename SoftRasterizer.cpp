@@ -0,0 +1,360 @@
+#include"SoftRasterizer.h"
+
+#include<algorithm>
+#include<chrono>
+#include<cmath>
+#include<cstdio>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include<intrin.h>
+#include<immintrin.h>
+#endif
+
+// vertices further out than this (in NDC) would overflow the kernel's 32 bit edge steps, see SoftRasterizer.h
+static const float GuardBand = 8.0f;
+
+// whether the CPU (and the OS, it has to save the wider registers) can run AVX2 code
+static bool CpuHasAvx2()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	return __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
+	__cpuid(info, 1);
+	bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+	if (!osSavesYmm)
+		return false;
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return false;
+#endif
+}
+
+// rounds down, also for negative numbers (>> on negative values is implementation defined before C++20)
+static int FloorDiv16(int64_t value)
+{
+	return (int)(value >= 0 ? value / 16 : -((-value + 15) / 16));
+}
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static uint32_t PackColor(float r, float g, float b, float a)
+{
+	auto channel = [](float v) { return (uint32_t)((v < 0.0f ? 0.0f : v > 1.0f ? 1.0f : v) * 255.0f + 0.5f); };
+	return channel(r) | channel(g) << 8 | channel(b) << 16 | channel(a) << 24;
+}
+
+const char* SoftSimdName(SoftSimd simd)
+{
+	switch (simd)
+	{
+	case SoftSimd::Auto: return "auto";
+	case SoftSimd::Scalar: return "scalar";
+	case SoftSimd::Sse2: return "sse2";
+	case SoftSimd::Avx2: return "avx2";
+	}
+	return "?";
+}
+
+SoftRasterizer::SoftRasterizer(int width, int height, int threads, SoftSimd simd)
+	: width(width), height(height), stride((width + 7) & ~7),
+	tilesX((width + TileSize - 1) / TileSize), tilesY((height + TileSize - 1) / TileSize),
+	simd(simd), kernel(nullptr), pool(threads), nextTile(0)
+{
+	color.resize((size_t)stride * height);
+	depth.resize((size_t)stride * height, 1.0f);
+
+	// widest kernel there is, unless told otherwise. Asking for one this build or CPU can't run falls back
+	SoftTriangleKernel avx2 = SoftAvx2Kernel();
+	bool hasAvx2 = avx2 != nullptr && CpuHasAvx2();
+#ifdef SOFT_RASTER_SSE2
+	const bool hasSse2 = true;
+#else
+	const bool hasSse2 = false;
+#endif
+	if (this->simd == SoftSimd::Auto)
+		this->simd = hasAvx2 ? SoftSimd::Avx2 : hasSse2 ? SoftSimd::Sse2 : SoftSimd::Scalar;
+	if ((this->simd == SoftSimd::Avx2 && !hasAvx2) || (this->simd == SoftSimd::Sse2 && !hasSse2))
+	{
+		SoftSimd fallback = this->simd == SoftSimd::Avx2 && hasSse2 ? SoftSimd::Sse2 : SoftSimd::Scalar;
+		std::printf("soft rasterizer: no %s kernel in this build or on this CPU, using %s\n", SoftSimdName(this->simd), SoftSimdName(fallback));
+		this->simd = fallback;
+	}
+
+	if (this->simd == SoftSimd::Avx2)
+		kernel = avx2;
+#ifdef SOFT_RASTER_SSE2
+	else if (this->simd == SoftSimd::Sse2)
+		kernel = &RasterTriangle<Sse2Lanes>;
+#endif
+	else
+		kernel = &RasterTriangle<ScalarLanes>;
+}
+
+void SoftRasterizer::BeginFrame(float r, float g, float b, float a)
+{
+	// the clear itself happens per tile in EndFrame, on the thread that owns the tile
+	clearColor = PackColor(r, g, b, a);
+	setups.clear();
+	usedBinSets = 0;
+}
+
+SoftRasterizer::BinSet& SoftRasterizer::NextBinSet()
+{
+	if (usedBinSets == binSets.size())
+	{
+		binSets.emplace_back();
+		binSets.back().tiles.resize((size_t)tilesX * tilesY);
+	}
+	BinSet& binSet = binSets[usedBinSets++];
+	for (std::vector<uint32_t>& tile : binSet.tiles)
+		tile.clear();
+	return binSet;
+}
+
+size_t SoftRasterizer::SetupChunk(const SoftVertex* vertices, const GLuint* indices, size_t first, size_t last, size_t setupBase, BinSet& binSet)
+{
+	const float halfWidth = width * 0.5f, halfHeight = height * 0.5f;
+	size_t count = 0;
+	for (size_t t = first; t < last; t++)
+	{
+		const SoftVertex* v[3];
+		for (int k = 0; k < 3; k++)
+			v[k] = &vertices[indices != nullptr ? indices[t * 3 + k] : t * 3 + k];
+
+		// entirely on the wrong side of one of the view planes
+		if ((v[0]->x < -1.0f && v[1]->x < -1.0f && v[2]->x < -1.0f) || (v[0]->x > 1.0f && v[1]->x > 1.0f && v[2]->x > 1.0f)
+			|| (v[0]->y < -1.0f && v[1]->y < -1.0f && v[2]->y < -1.0f) || (v[0]->y > 1.0f && v[1]->y > 1.0f && v[2]->y > 1.0f)
+			|| (v[0]->z < -1.0f && v[1]->z < -1.0f && v[2]->z < -1.0f) || (v[0]->z > 1.0f && v[1]->z > 1.0f && v[2]->z > 1.0f))
+			continue;
+		// ! crosses the view but reaches past the guard band: would need real clipping, dropped instead
+		bool outsideGuard = false;
+		for (int k = 0; k < 3; k++)
+			outsideGuard |= std::fabs(v[k]->x) > GuardBand || std::fabs(v[k]->y) > GuardBand;
+		if (outsideGuard)
+			continue;
+
+		// window coordinates snapped to 1/16 pixel, like the hardware does
+		int32_t X[3], Y[3];
+		for (int k = 0; k < 3; k++)
+		{
+			X[k] = (int32_t)std::floor((v[k]->x * halfWidth + halfWidth) * 16.0f + 0.5f);
+			Y[k] = (int32_t)std::floor((v[k]->y * halfHeight + halfHeight) * 16.0f + 0.5f);
+		}
+		int64_t area = (int64_t)(X[1] - X[0]) * (Y[2] - Y[0]) - (int64_t)(Y[1] - Y[0]) * (X[2] - X[0]);
+		if (area == 0)
+			continue;
+		// no culling here (GL doesn't cull by default either), clockwise ones are just turned around
+		int order[3] = { 0, 1, 2 };
+		if (area < 0)
+		{
+			order[1] = 2;
+			order[2] = 1;
+			area = -area;
+		}
+
+		// bounding box of the samples (at pixel centers) that can be inside, clipped to the screen
+		int32_t lowX = KernelMin(X[0], KernelMin(X[1], X[2])), highX = KernelMax(X[0], KernelMax(X[1], X[2]));
+		int32_t lowY = KernelMin(Y[0], KernelMin(Y[1], Y[2])), highY = KernelMax(Y[0], KernelMax(Y[1], Y[2]));
+		int minX = KernelMax(-FloorDiv16(8 - (int64_t)lowX), 0), maxX = KernelMin(FloorDiv16((int64_t)highX - 8), width - 1);
+		int minY = KernelMax(-FloorDiv16(8 - (int64_t)lowY), 0), maxY = KernelMin(FloorDiv16((int64_t)highY - 8), height - 1);
+		if (minX > maxX || minY > maxY)
+			continue;
+
+		SoftTriangle& s = setups[setupBase + count];
+		s.minX = minX;
+		s.minY = minY;
+		s.maxX = maxX;
+		s.maxY = maxY;
+
+		// edge e runs between the two corners that aren't e, so it's 0 on that edge and positive towards corner e.
+		// Fill rule: pixels exactly on an edge belong to it only if it's a top or left edge, the others lose
+		// their zero by taking 1 off (everything is integer, so that's exact)
+		for (int e = 0; e < 3; e++)
+		{
+			int p = order[(e + 1) % 3], q = order[(e + 2) % 3];
+			int32_t a = Y[p] - Y[q];
+			int32_t b = X[q] - X[p];
+			bool topLeft = a > 0 || (a == 0 && b < 0);
+			s.a[e] = a;
+			s.b[e] = b;
+			s.c[e] = -((int64_t)a * X[p] + (int64_t)b * Y[p]) - (topLeft ? 0 : 1);
+		}
+
+		// attribute planes over pixel indices: pixel x's center is at x + 0.5
+		float x0 = X[order[0]] / 16.0f - 0.5f, y0 = Y[order[0]] / 16.0f - 0.5f;
+		float dx1 = (X[order[1]] - X[order[0]]) / 16.0f, dy1 = (Y[order[1]] - Y[order[0]]) / 16.0f;
+		float dx2 = (X[order[2]] - X[order[0]]) / 16.0f, dy2 = (Y[order[2]] - Y[order[0]]) / 16.0f;
+		float invArea = 256.0f / (float)area;
+		auto plane = [&](float f0, float f1, float f2, float* out)
+		{
+			float d1 = f1 - f0, d2 = f2 - f0;
+			out[1] = (d1 * dy2 - d2 * dy1) * invArea;
+			out[2] = (d2 * dx1 - d1 * dx2) * invArea;
+			out[0] = f0 - out[1] * x0 - out[2] * y0;
+		};
+		const SoftVertex& c0 = *v[order[0]];
+		const SoftVertex& c1 = *v[order[1]];
+		const SoftVertex& c2 = *v[order[2]];
+		// depth range 0..1, like glDepthRange's default
+		plane(c0.z * 0.5f + 0.5f, c1.z * 0.5f + 0.5f, c2.z * 0.5f + 0.5f, s.depth);
+		plane(c0.r, c1.r, c2.r, s.red);
+		plane(c0.g, c1.g, c2.g, s.green);
+		plane(c0.b, c1.b, c2.b, s.blue);
+
+		for (int ty = minY / TileSize; ty <= maxY / TileSize; ty++)
+			for (int tx = minX / TileSize; tx <= maxX / TileSize; tx++)
+				binSet.tiles[(size_t)ty * tilesX + tx].push_back((uint32_t)(setupBase + count));
+		count++;
+	}
+	return count;
+}
+
+void SoftRasterizer::DrawTriangles(const SoftVertex* vertices, size_t vertexCount, const GLuint* indices, size_t indexCount)
+{
+	auto start = std::chrono::steady_clock::now();
+	size_t triangles = (indices != nullptr ? indexCount : vertexCount) / 3;
+	if (triangles == 0)
+		return;
+
+	// every triangle gets its slot up front, so chunks write their setups without talking to each other.
+	// Dropped triangles just leave a hole nobody's bins point at
+	size_t setupBase = setups.size();
+	setups.resize(setupBase + triangles);
+
+	// small draws aren't worth waking the workers for
+	const size_t minChunk = 4096;
+	size_t chunks = KernelMin((size_t)pool.Threads(), (triangles + minChunk - 1) / minChunk);
+	if (chunks < 1)
+		chunks = 1;
+	// all the bin sets first: NextBinSet can grow the vector, which moves the ones handed out before
+	size_t firstSet = usedBinSets;
+	for (size_t c = 0; c < chunks; c++)
+		NextBinSet();
+
+	std::vector<size_t> binned(chunks, 0);
+	size_t perChunk = (triangles + chunks - 1) / chunks;
+	auto setupChunk = [&](size_t c)
+	{
+		size_t first = c * perChunk, last = KernelMin(first + perChunk, triangles);
+		if (first < last)
+			binned[c] = SetupChunk(vertices, indices, first, last, setupBase + first, binSets[firstSet + c]);
+	};
+	if (chunks == 1)
+		setupChunk(0);
+	else
+	{
+		for (size_t c = 0; c < chunks; c++)
+			pool.Enqueue([&setupChunk, c]() { setupChunk(c); });
+		pool.Wait();
+	}
+
+	stats.triangles += triangles;
+	for (size_t count : binned)
+		stats.binned += count;
+	stats.setupMs += MillisecondsSince(start);
+}
+
+void SoftRasterizer::RasterTile(int tile, uint64_t& tileTriangles, uint64_t& pixels)
+{
+	SoftRect rect;
+	rect.x0 = (tile % tilesX) * TileSize;
+	rect.y0 = (tile / tilesX) * TileSize;
+	rect.x1 = KernelMin(rect.x0 + TileSize, width);
+	rect.y1 = KernelMin(rect.y0 + TileSize, height);
+
+	for (int y = rect.y0; y < rect.y1; y++)
+	{
+		size_t row = (size_t)y * stride;
+		std::fill(color.begin() + row + rect.x0, color.begin() + row + rect.x1, clearColor);
+		std::fill(depth.begin() + row + rect.x0, depth.begin() + row + rect.x1, 1.0f);
+	}
+
+	SoftTarget target = { color.data(), depth.data(), stride };
+	// bin sets are in draw order and so are the triangles in each of them, which keeps GL's ordering rules
+	for (size_t set = 0; set < usedBinSets; set++)
+	{
+		for (uint32_t index : binSets[set].tiles[tile])
+		{
+			pixels += kernel(setups[index], rect, target, depthTest);
+			tileTriangles++;
+		}
+	}
+}
+
+void SoftRasterizer::EndFrame()
+{
+	auto start = std::chrono::steady_clock::now();
+
+	// ! depthTest is read by every tile, so it's whatever the last draw set. Fine for the scenes here (one state per
+	// frame); per draw state would have to go into the bins
+	int tileCount = tilesX * tilesY;
+	std::atomic<uint64_t> tileTriangles(0), pixels(0);
+	nextTile = 0;
+	int jobs = KernelMin(pool.Threads(), tileCount);
+	for (int job = 0; job < jobs; job++)
+	{
+		pool.Enqueue([this, tileCount, &tileTriangles, &pixels]()
+		{
+			uint64_t jobTriangles = 0, jobPixels = 0;
+			for (int tile = nextTile++; tile < tileCount; tile = nextTile++)
+				RasterTile(tile, jobTriangles, jobPixels);
+			tileTriangles += jobTriangles;
+			pixels += jobPixels;
+		});
+	}
+	pool.Wait();
+
+	stats.frames++;
+	stats.tileTriangles += tileTriangles;
+	stats.pixels += pixels;
+	stats.rasterMs += MillisecondsSince(start);
+}
+
+const unsigned char* SoftRasterizer::Pixels() const
+{
+	if (stride == width)
+		return (const unsigned char*)color.data();
+	packed.resize((size_t)width * height);
+	for (int y = 0; y < height; y++)
+		std::copy(color.begin() + (size_t)y * stride, color.begin() + (size_t)y * stride + width, packed.begin() + (size_t)y * width);
+	return (const unsigned char*)packed.data();
+}
+
+void SoftRasterizer::ParallelFor(size_t count, const std::function<void(size_t begin, size_t end)>& body)
+{
+	size_t chunks = KernelMin((size_t)pool.Threads(), (count + 1023) / 1024);
+	if (chunks <= 1)
+	{
+		if (count > 0)
+			body(0, count);
+		return;
+	}
+	size_t perChunk = (count + chunks - 1) / chunks;
+	for (size_t c = 0; c < chunks; c++)
+	{
+		size_t begin = c * perChunk, end = KernelMin(begin + perChunk, count);
+		pool.Enqueue([&body, begin, end]() { body(begin, end); });
+	}
+	pool.Wait();
+}
+
+void SoftRasterizer::PrintReport() const
+{
+	std::printf("soft rasterizer: %s kernel, %d threads, %dx%d tiles of %d pixels\n", SoftSimdName(simd), pool.Threads(),
+		tilesX, tilesY, TileSize);
+	if (stats.frames == 0)
+		return;
+	double frames = (double)stats.frames;
+	std::printf("  per frame: %.0f triangles drawn, %.0f set up and binned, %.0f tile/triangle pairs, %.0f pixels written\n",
+		stats.triangles / frames, stats.binned / frames, stats.tileTriangles / frames, stats.pixels / frames);
+	std::printf("  setup + binning %.3f ms/frame, raster %.3f ms/frame (%.1f Mpixels written/sec while rasterizing)\n",
+		stats.setupMs / frames, stats.rasterMs / frames, stats.rasterMs > 0.0 ? stats.pixels / (stats.rasterMs * 1000.0) : 0.0);
+}
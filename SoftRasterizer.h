@@ -0,0 +1,128 @@
+#ifndef SOFT_RASTERIZER_CLASS_H
+#define SOFT_RASTERIZER_CLASS_H
+
+#include<atomic>
+#include<cstdint>
+#include<functional>
+#include<vector>
+#include<glad/glad.h>
+#include"SoftRasterKernel.h"
+#include"ThreadPool.h"
+
+// * NOTE: a CPU rasterizer for boxes without a GPU (--soft), the same job llvmpipe does for GL but only for what
+// the scenes here need: triangles with a depth test and per-vertex colors. A frame goes:
+//   DrawTriangles: triangle setup (snap to 1/16 pixel, edge functions, attribute planes) and binning: each triangle
+//                  goes into the list of every 64x64 screen tile its bounding box touches. Big draws are set up on
+//                  the worker threads in chunks, each chunk with its own lists so nothing is shared
+//   EndFrame:      every tile is a job. Workers take tiles one by one, clear them, and rasterize their triangles in
+//                  draw order with the SIMD kernel (SoftRasterKernel.h). A tile belongs to one thread, so there
+//                  are no locks on the framebuffer
+//
+// ! vertices come in clip space with w = 1 (every scene here draws without perspective), so there is no clipping:
+//   triangles entirely outside the view are dropped, and so are the rare ones that reach further than the guard
+//   band (8x the view) while crossing it. Depth outside the near/far planes is rejected per pixel
+
+// what the vertex stage hands over: clip space position and a color
+struct SoftVertex
+{
+	float x, y, z;
+	float r, g, b;
+};
+
+// which copy of the tile kernel runs
+enum class SoftSimd
+{
+	Auto,   // the widest this CPU and build have
+	Scalar,
+	Sse2,
+	Avx2
+};
+
+const char* SoftSimdName(SoftSimd simd);
+
+// counters since the rasterizer was created
+struct SoftStats
+{
+	uint64_t frames = 0;
+	uint64_t triangles = 0;     // handed to DrawTriangles
+	uint64_t binned = 0;        // left after dropping empty and off screen ones
+	uint64_t tileTriangles = 0; // (tile, triangle) pairs rasterized
+	uint64_t pixels = 0;        // pixels written (passed coverage, depth)
+	double setupMs = 0.0;       // DrawTriangles, on the calling thread
+	double rasterMs = 0.0;      // EndFrame
+};
+
+class SoftRasterizer
+{
+public:
+	// threads = 0: one per hardware thread
+	SoftRasterizer(int width, int height, int threads = 0, SoftSimd simd = SoftSimd::Auto);
+
+	SoftRasterizer(const SoftRasterizer&) = delete;
+	SoftRasterizer& operator=(const SoftRasterizer&) = delete;
+
+	// starts a frame: every pixel gets this color and the far depth
+	void BeginFrame(float r, float g, float b, float a);
+
+	void SetDepthTest(bool enabled) { depthTest = enabled; }
+
+	// a draw call. indices = nullptr draws vertices[0..vertexCount) as a triangle list (glDrawArrays),
+	// otherwise indexCount indices into vertices (glDrawElements). The arrays only have to live until the call returns
+	void DrawTriangles(const SoftVertex* vertices, size_t vertexCount, const GLuint* indices, size_t indexCount);
+
+	// rasterizes everything drawn since BeginFrame
+	void EndFrame();
+
+	// RGBA8, bottom row first, tightly packed: the same bytes glReadPixels gives for the GL backends
+	const unsigned char* Pixels() const;
+
+	// runs body(begin, end) over [0, count) in one chunk per worker and waits. For the scenes' vertex stage
+	void ParallelFor(size_t count, const std::function<void(size_t begin, size_t end)>& body);
+
+	int Width() const { return width; }
+	int Height() const { return height; }
+	int Threads() const { return pool.Threads(); }
+	SoftSimd Simd() const { return simd; }
+	const SoftStats& Stats() const { return stats; }
+
+	void PrintReport() const;
+
+	static const int TileSize = 64;
+
+private:
+	// triangles of one chunk of one draw, per tile. Reused from frame to frame so the lists keep their memory
+	struct BinSet
+	{
+		std::vector<std::vector<uint32_t>> tiles;
+	};
+
+	// sets up triangles [first, last) of the draw into setups and bins them into binSet
+	size_t SetupChunk(const SoftVertex* vertices, const GLuint* indices, size_t first, size_t last, size_t setupBase, BinSet& binSet);
+	void RasterTile(int tile, uint64_t& tileTriangles, uint64_t& pixels);
+	BinSet& NextBinSet();
+
+	int width;
+	int height;
+	int stride;
+	int tilesX;
+	int tilesY;
+	SoftSimd simd;
+	SoftTriangleKernel kernel;
+	bool depthTest = false;
+
+	// both padded to stride, the color one is also where Pixels() points when stride == width
+	std::vector<uint32_t> color;
+	std::vector<float> depth;
+	mutable std::vector<uint32_t> packed;
+	uint32_t clearColor = 0;
+
+	std::vector<SoftTriangle> setups;
+	std::vector<BinSet> binSets;
+	size_t usedBinSets = 0;
+
+	ThreadPool pool;
+	std::atomic<int> nextTile;
+	SoftStats stats;
+};
+
+#endif
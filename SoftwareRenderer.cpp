@@ -0,0 +1,91 @@
+#include"SoftwareRenderer.h"
+
+#include<chrono>
+#include<cstdio>
+#include<fstream>
+#include<iostream>
+#include<memory>
+#include<vector>
+
+#include"Benchmark.h"
+#include"FrameDumper.h"
+#include"Scene.h"
+#include"SoftRasterizer.h"
+
+int RunSoftware(const AppOptions& options)
+{
+	std::unique_ptr<Scene> scene = CreateScene(options);
+	if (!scene->InitSoftware())
+	{
+		std::cout << "scene " << scene->Name() << " has no software path, --soft draws the triangle and mesh scenes" << std::endl;
+		return -1;
+	}
+	SoftRasterizer raster(options.width, options.height, options.softThreads, options.softSimd);
+
+	std::unique_ptr<FrameDumper> dumper;
+	if (!options.dumpDir.empty())
+	{
+		dumper.reset(new FrameDumper(options.dumpDir, options.dumpFormat, options.width, options.height,
+			options.dumpThreads, options.dumpQueue, options.dumpDrop));
+		if (!dumper->Ready())
+			return -1;
+	}
+
+	// no GPU, so the benchmark is CPU time only: the whole frame, rasterizing included
+	int warmup = options.bench ? options.warmupFrames : 0;
+	int totalFrames = options.frames + warmup;
+	std::vector<double> frameTimes;
+	frameTimes.reserve(options.frames);
+
+	auto loopStart = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < totalFrames; frame++)
+	{
+		auto frameStart = std::chrono::steady_clock::now();
+		raster.BeginFrame(0.07f, 0.13f, 0.17f, 1.0f);
+		scene->DrawSoftware(raster, frame);
+		raster.EndFrame();
+		if (dumper)
+			dumper->Submit(raster.Pixels(), frame);
+		if (frame >= warmup)
+			frameTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+	}
+	if (dumper)
+		dumper->Finish();
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - loopStart).count();
+	if (totalFrames > 0 && seconds > 0.0)
+	{
+		double framesPerSecond = totalFrames / seconds;
+		std::cout << "software: " << totalFrames << " frames in " << seconds << " s (" << framesPerSecond << " frames/sec, "
+			<< 1000.0 / framesPerSecond << " ms/frame, " << framesPerSecond * options.width * options.height / 1e6
+			<< " Mpixels/sec)" << std::endl;
+		std::cout << "scene " << scene->Name() << ": " << scene->Objects() << " objects per frame ("
+			<< scene->Objects() * framesPerSecond << " objects/sec)" << std::endl;
+	}
+	scene->PrintReport();
+	raster.PrintReport();
+	if (dumper)
+		dumper->PrintReport();
+
+	if (options.bench)
+	{
+		FrameStats cpu = ComputeStats(frameTimes);
+		std::printf("benchmark: software, %dx%d, %s kernel, %d threads\n", options.width, options.height,
+			SoftSimdName(raster.Simd()), raster.Threads());
+		std::printf("  %d warmup + %d measured frames\n", warmup, (int)frameTimes.size());
+		std::printf("          %9s %9s %9s %9s %9s\n", "mean", "p50", "p95", "p99", "max");
+		std::printf("  cpu ms  %9.4f %9.4f %9.4f %9.4f %9.4f\n", cpu.mean, cpu.p50, cpu.p95, cpu.p99, cpu.max);
+
+		// same columns as Benchmark::WriteCSV, the gpu one stays empty
+		if (!options.csvPath.empty())
+		{
+			std::ofstream file(options.csvPath);
+			file << "frame,cpu_ms,gpu_ms\n";
+			for (size_t i = 0; i < frameTimes.size(); i++)
+				file << i << ',' << frameTimes[i] << ",\n";
+		}
+		if (!options.jsonPath.empty())
+			std::cout << "--soft: --json isn't written, use --csv or gl_bench --json" << std::endl;
+	}
+	return 0;
+}
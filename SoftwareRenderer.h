@@ -0,0 +1,11 @@
+#ifndef SOFTWARE_RENDERER_CLASS_H
+#define SOFTWARE_RENDERER_CLASS_H
+
+#include"Options.h"
+
+// * NOTE: main's render loop for --soft. Same scenes, frame counts, benchmark percentiles and frame dumps as the GL
+// path, but drawn by SoftRasterizer and without any GL context (so no readback and no capture, the pixels are
+// already in memory). Returns main's exit code
+int RunSoftware(const AppOptions& options);
+
+#endif
@@ -0,0 +1,271 @@
+#include"StateCache.h"
+
+#include<cstdio>
+
+uint64_t StateCounters::TotalIssued() const
+{
+	uint64_t sum = 0;
+	for (uint64_t n : issued)
+		sum += n;
+	return sum;
+}
+
+uint64_t StateCounters::TotalElided() const
+{
+	uint64_t sum = 0;
+	for (uint64_t n : elided)
+		sum += n;
+	return sum;
+}
+
+const char* StateCallName(StateCall call)
+{
+	switch (call)
+	{
+	case StateCall::UseProgram: return "glUseProgram";
+	case StateCall::BindVertexArray: return "glBindVertexArray";
+	case StateCall::BindBuffer: return "glBindBuffer";
+	case StateCall::BindTexture: return "glBindTexture";
+	case StateCall::ActiveTexture: return "glActiveTexture";
+	case StateCall::EnableDisable: return "glEnable/glDisable";
+	case StateCall::BlendFunc: return "glBlendFunc";
+	case StateCall::DepthFunc: return "glDepthFunc";
+	case StateCall::DepthMask: return "glDepthMask";
+	case StateCall::ClearColor: return "glClearColor";
+	default: return "?";
+	}
+}
+
+StateCache::StateCache()
+{
+	Invalidate();
+}
+
+void StateCache::Invalidate()
+{
+	program = Unknown;
+	vertexArray = Unknown;
+	for (int i = 0; i < BufferSlots; i++)
+		buffers[i] = Unknown;
+	for (int unit = 0; unit < MaxTextureUnits; unit++)
+		for (int i = 0; i < TextureSlots; i++)
+			textures[unit][i] = Unknown;
+	activeUnit = 0;
+
+	blend = depthTest = cullFace = scissorTest = stencilTest = -1;
+	blendFuncKnown = false;
+	blendSrc = blendDst = 0;
+	depthFunc = 0;
+	depthMask = -1;
+	clearColorKnown = false;
+}
+
+int StateCache::BufferSlot(GLenum target)
+{
+	switch (target)
+	{
+	case GL_ARRAY_BUFFER: return 0;
+	case GL_ELEMENT_ARRAY_BUFFER: return 1;
+	case GL_UNIFORM_BUFFER: return 2;
+	case GL_PIXEL_PACK_BUFFER: return 3;
+	case GL_PIXEL_UNPACK_BUFFER: return 4;
+	case GL_COPY_READ_BUFFER: return 5;
+	case GL_COPY_WRITE_BUFFER: return 6;
+	case GL_TEXTURE_BUFFER: return 7;
+	default: return -1;
+	}
+}
+
+int StateCache::TextureSlot(GLenum target)
+{
+	switch (target)
+	{
+	case GL_TEXTURE_2D: return 0;
+	case GL_TEXTURE_CUBE_MAP: return 1;
+	case GL_TEXTURE_2D_ARRAY: return 2;
+	case GL_TEXTURE_3D: return 3;
+	default: return -1;
+	}
+}
+
+void StateCache::UseProgram(GLuint id)
+{
+	if (Changed(StateCall::UseProgram, program != id))
+	{
+		glUseProgram(id);
+		program = id;
+	}
+}
+
+void StateCache::BindVertexArray(GLuint vao)
+{
+	if (Changed(StateCall::BindVertexArray, vertexArray != vao))
+	{
+		glBindVertexArray(vao);
+		vertexArray = vao;
+		// the element buffer binding is part of the VAO, switching VAOs switches it too
+		buffers[BufferSlot(GL_ELEMENT_ARRAY_BUFFER)] = Unknown;
+	}
+}
+
+void StateCache::BindBuffer(GLenum target, GLuint buffer)
+{
+	int slot = BufferSlot(target);
+	if (slot < 0)
+	{
+		frame.issued[(int)StateCall::BindBuffer]++;
+		glBindBuffer(target, buffer);
+		return;
+	}
+	if (Changed(StateCall::BindBuffer, buffers[slot] != buffer))
+	{
+		glBindBuffer(target, buffer);
+		buffers[slot] = buffer;
+	}
+}
+
+void StateCache::ActiveTexture(GLenum unit)
+{
+	if (Changed(StateCall::ActiveTexture, activeUnit != unit))
+	{
+		glActiveTexture(unit);
+		activeUnit = unit;
+	}
+}
+
+void StateCache::BindTexture(GLenum target, GLuint texture)
+{
+	int slot = TextureSlot(target);
+	// activeUnit is 0 while unknown, which is a valid "not GL_TEXTURE0 + n" value: don't shadow then
+	int unit = (int)activeUnit - GL_TEXTURE0;
+	if (slot < 0 || unit < 0 || unit >= MaxTextureUnits)
+	{
+		frame.issued[(int)StateCall::BindTexture]++;
+		glBindTexture(target, texture);
+		return;
+	}
+	if (Changed(StateCall::BindTexture, textures[unit][slot] != texture))
+	{
+		glBindTexture(target, texture);
+		textures[unit][slot] = texture;
+	}
+}
+
+// returns the shadow flag for a capability, NULL when we don't track it
+static int8_t* CapFlag(GLenum cap, int8_t& blend, int8_t& depthTest, int8_t& cullFace, int8_t& scissorTest, int8_t& stencilTest)
+{
+	switch (cap)
+	{
+	case GL_BLEND: return &blend;
+	case GL_DEPTH_TEST: return &depthTest;
+	case GL_CULL_FACE: return &cullFace;
+	case GL_SCISSOR_TEST: return &scissorTest;
+	case GL_STENCIL_TEST: return &stencilTest;
+	default: return NULL;
+	}
+}
+
+void StateCache::Enable(GLenum cap)
+{
+	int8_t* flag = CapFlag(cap, blend, depthTest, cullFace, scissorTest, stencilTest);
+	if (flag == NULL)
+	{
+		frame.issued[(int)StateCall::EnableDisable]++;
+		glEnable(cap);
+		return;
+	}
+	if (Changed(StateCall::EnableDisable, *flag != 1))
+	{
+		glEnable(cap);
+		*flag = 1;
+	}
+}
+
+void StateCache::Disable(GLenum cap)
+{
+	int8_t* flag = CapFlag(cap, blend, depthTest, cullFace, scissorTest, stencilTest);
+	if (flag == NULL)
+	{
+		frame.issued[(int)StateCall::EnableDisable]++;
+		glDisable(cap);
+		return;
+	}
+	if (Changed(StateCall::EnableDisable, *flag != 0))
+	{
+		glDisable(cap);
+		*flag = 0;
+	}
+}
+
+void StateCache::BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	if (Changed(StateCall::BlendFunc, !blendFuncKnown || blendSrc != sfactor || blendDst != dfactor))
+	{
+		glBlendFunc(sfactor, dfactor);
+		blendFuncKnown = true;
+		blendSrc = sfactor;
+		blendDst = dfactor;
+	}
+}
+
+void StateCache::DepthFunc(GLenum func)
+{
+	if (Changed(StateCall::DepthFunc, depthFunc != func))
+	{
+		glDepthFunc(func);
+		depthFunc = func;
+	}
+}
+
+void StateCache::DepthMask(GLboolean flag)
+{
+	int8_t value = flag ? 1 : 0;
+	if (Changed(StateCall::DepthMask, depthMask != value))
+	{
+		glDepthMask(flag);
+		depthMask = value;
+	}
+}
+
+void StateCache::ClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+	bool differs = !clearColorKnown || clearColor[0] != r || clearColor[1] != g || clearColor[2] != b || clearColor[3] != a;
+	if (Changed(StateCall::ClearColor, differs))
+	{
+		glClearColor(r, g, b, a);
+		clearColor[0] = r;
+		clearColor[1] = g;
+		clearColor[2] = b;
+		clearColor[3] = a;
+		clearColorKnown = true;
+	}
+}
+
+void StateCache::EndFrame()
+{
+	for (int i = 0; i < (int)StateCall::Count; i++)
+	{
+		total.issued[i] += frame.issued[i];
+		total.elided[i] += frame.elided[i];
+	}
+	frame = StateCounters();
+	frames++;
+}
+
+void StateCache::PrintReport() const
+{
+	if (frames == 0)
+		return;
+
+	std::printf("state cache: per frame over %d frames\n", frames);
+	std::printf("  %-20s %10s %10s\n", "call", "issued", "elided");
+	for (int i = 0; i < (int)StateCall::Count; i++)
+	{
+		if (total.issued[i] == 0 && total.elided[i] == 0)
+			continue;
+		std::printf("  %-20s %10.2f %10.2f\n", StateCallName((StateCall)i),
+			(double)total.issued[i] / frames, (double)total.elided[i] / frames);
+	}
+	std::printf("  %-20s %10.2f %10.2f\n", "total",
+		(double)total.TotalIssued() / frames, (double)total.TotalElided() / frames);
+}
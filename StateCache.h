@@ -0,0 +1,124 @@
+#ifndef STATE_CACHE_CLASS_H
+#define STATE_CACHE_CLASS_H
+
+#include<cstdint>
+#include<glad/glad.h>
+
+// * NOTE: OpenGL is a big state machine, and every glUseProgram / glBindVertexArray / glEnable goes through the driver
+// (which validates it) even when it sets the SAME value that's already there.
+// The state cache keeps a copy ("shadow") of what we last set, and only calls into GL when the value actually changes.
+// Everything starts out UNKNOWN, so the first call always goes through.
+//
+// ! the shadow is only right if ALL changes to that state go through the cache. If some code talks to GL directly,
+// call Invalidate() afterwards so the cache forgets what it knew.
+//
+// ! the same goes for deleting things: GL unbinds a deleted object by itself, and a new object can get the SAME name,
+// which the cache would then consider "already bound". So a cache is only used inside the scene's lifetime: it's made
+// after BuildGeometry (which creates the VAOs) and isn't used again once the scene starts deleting things (main,
+// gl_bench and gl_tests all do it that way). Whatever deletes objects between two uses has to Invalidate() it.
+
+// kinds of calls the cache filters, used to index the counters
+enum class StateCall
+{
+	UseProgram,
+	BindVertexArray,
+	BindBuffer,
+	BindTexture,
+	ActiveTexture,
+	EnableDisable,
+	BlendFunc,
+	DepthFunc,
+	DepthMask,
+	ClearColor,
+	Count
+};
+
+// how many calls of each kind went to GL vs. were dropped because nothing changed
+struct StateCounters
+{
+	uint64_t issued[(int)StateCall::Count] = {};
+	uint64_t elided[(int)StateCall::Count] = {};
+
+	uint64_t TotalIssued() const;
+	uint64_t TotalElided() const;
+};
+
+const char* StateCallName(StateCall call);
+
+class StateCache
+{
+public:
+	StateCache();
+
+	// forget everything, the next call of every kind goes to GL
+	void Invalidate();
+
+	void UseProgram(GLuint program);
+	void BindVertexArray(GLuint vao);
+	void BindBuffer(GLenum target, GLuint buffer);
+	// binds to the CURRENT texture unit (see ActiveTexture)
+	void BindTexture(GLenum target, GLuint texture);
+	// unit is GL_TEXTURE0 + n, same as glActiveTexture
+	void ActiveTexture(GLenum unit);
+	// caps we shadow: GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST. Others pass straight through
+	void Enable(GLenum cap);
+	void Disable(GLenum cap);
+	void BlendFunc(GLenum sfactor, GLenum dfactor);
+	void DepthFunc(GLenum func);
+	void DepthMask(GLboolean flag);
+	void ClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+
+	// counters for the frame in progress, and for everything since the cache was created
+	const StateCounters& FrameCounters() const { return frame; }
+	const StateCounters& TotalCounters() const { return total; }
+	int Frames() const { return frames; }
+	// adds this frame's counters to the totals and starts a new frame
+	void EndFrame();
+
+	// per-frame averages of issued/elided calls, one line per kind
+	void PrintReport() const;
+
+	static const int MaxTextureUnits = 16;
+
+private:
+	// buffer / texture targets we shadow map to a small index, -1 = not shadowed (always forwarded)
+	static int BufferSlot(GLenum target);
+	static int TextureSlot(GLenum target);
+	static const int BufferSlots = 8;
+	static const int TextureSlots = 4;
+
+	// returns true when the call should go through. Counts either way
+	bool Changed(StateCall call, bool differs)
+	{
+		if (differs)
+			frame.issued[(int)call]++;
+		else
+			frame.elided[(int)call]++;
+		return differs;
+	}
+
+	// value used for "don't know what's bound", no real object has this name
+	static const GLuint Unknown = 0xFFFFFFFFu;
+
+	GLuint program;
+	GLuint vertexArray;
+	GLuint buffers[BufferSlots];
+	GLuint textures[MaxTextureUnits][TextureSlots];
+	GLenum activeUnit;
+
+	// capability flags: -1 unknown, 0 disabled, 1 enabled
+	int8_t blend, depthTest, cullFace, scissorTest, stencilTest;
+	// 0 is GL_ZERO, a real blend factor, so "unknown" needs its own flag
+	bool blendFuncKnown;
+	GLenum blendSrc, blendDst;
+	GLenum depthFunc;
+	int8_t depthMask;
+	bool clearColorKnown;
+	GLfloat clearColor[4];
+
+	StateCounters frame;
+	StateCounters total;
+	int frames = 0;
+};
+
+#endif
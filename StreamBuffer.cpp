@@ -0,0 +1,145 @@
+#include"StreamBuffer.h"
+
+#include<algorithm>
+#include<cassert>
+
+StreamBuffer::StreamBuffer(GLsizeiptr capacity, bool allowPersistent)
+	: capacity(capacity)
+{
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+
+	if (allowPersistent && GLAD_GL_ARB_buffer_storage)
+	{
+		// immutable storage that stays mapped: one pointer for the buffer's whole life
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_COPY_WRITE_BUFFER, capacity, NULL, flags);
+		mapped = (char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, capacity, flags);
+	}
+	if (mapped == nullptr)
+	{
+		// no buffer storage (or mapping it failed): a plain buffer we map piece by piece.
+		// glBufferStorage makes the buffer immutable, so a failed persistent map needs a fresh buffer
+		if (allowPersistent && GLAD_GL_ARB_buffer_storage)
+		{
+			glDeleteBuffers(1, &buffer);
+			glGenBuffers(1, &buffer);
+			glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		}
+		glBufferData(GL_COPY_WRITE_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+	}
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+StreamBuffer::~StreamBuffer()
+{
+	for (FrameFence& frame : inFlight)
+		glDeleteSync(frame.fence);
+
+	if (mapped != nullptr)
+	{
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	}
+	glDeleteBuffers(1, &buffer);
+}
+
+void StreamBuffer::RetireOldest()
+{
+	FrameFence frame = inFlight.front();
+	inFlight.pop_front();
+
+	// first just ask, without waiting
+	GLenum result = glClientWaitSync(frame.fence, 0, 0);
+	if (result == GL_TIMEOUT_EXPIRED)
+	{
+		// the GPU is still reading that part of the ring: we have to wait. The flush bit makes sure the fence
+		// was actually sent to the GPU, otherwise we could wait forever
+		stalls++;
+		do
+		{
+			result = glClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+		} while (result == GL_TIMEOUT_EXPIRED);
+	}
+
+	glDeleteSync(frame.fence);
+	retired = frame.end;
+}
+
+StreamAllocation StreamBuffer::Allocate(GLsizeiptr size, GLsizeiptr alignment)
+{
+	assert(size > 0 && size <= capacity);
+
+	// round the ring offset up to the alignment, and jump to the start of the ring if it doesn't fit before the end
+	uint64_t offset = head % capacity;
+	uint64_t aligned = (offset + alignment - 1) / alignment * alignment;
+	uint64_t position = head + (aligned - offset);
+	if (aligned + size > (uint64_t)capacity)
+	{
+		position = head + (capacity - offset);
+		wraps++;
+	}
+
+	// the bytes we want were last written capacity bytes ago: wait until the GPU is done with them.
+	// (anything from head on was never written, that's the padding we just skipped over)
+	while (position + size > (uint64_t)capacity && std::min(position + size - capacity, head) > retired)
+	{
+		// this frame alone is using up the ring, fence it so there's something to wait for
+		// (EndFrame may find it already finished and retire it on the spot)
+		if (inFlight.empty())
+			EndFrame();
+		if (!inFlight.empty())
+			RetireOldest();
+	}
+
+	head = position + size;
+
+	StreamAllocation allocation;
+	allocation.offset = (GLintptr)(position % capacity);
+	allocation.size = size;
+	if (mapped != nullptr)
+	{
+		allocation.data = mapped + allocation.offset;
+	}
+	else
+	{
+		// unsynchronized: GL doesn't wait for anything, our fences already guarantee the range is free.
+		// invalidate range: we overwrite all of it, the old contents don't need to be kept
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		allocation.data = glMapBufferRange(GL_COPY_WRITE_BUFFER, allocation.offset, size,
+			GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+	}
+	return allocation;
+}
+
+void StreamBuffer::Commit(const StreamAllocation&)
+{
+	// coherent persistent mapping: the GPU already sees our writes
+	if (mapped != nullptr)
+		return;
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+void StreamBuffer::EndFrame()
+{
+	if (head == frameStart)
+		return;
+
+	// signalled once the GPU has executed every command issued so far, i.e. is done reading this frame's data
+	inFlight.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), head });
+	frameStart = head;
+
+	// forget frames that are already done, without waiting, so the list stays short
+	while (!inFlight.empty() && glClientWaitSync(inFlight.front().fence, 0, 0) != GL_TIMEOUT_EXPIRED)
+	{
+		glDeleteSync(inFlight.front().fence);
+		retired = inFlight.front().end;
+		inFlight.pop_front();
+	}
+}
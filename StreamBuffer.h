@@ -0,0 +1,83 @@
+#ifndef STREAM_BUFFER_CLASS_H
+#define STREAM_BUFFER_CLASS_H
+
+#include<cstdint>
+#include<deque>
+#include<glad/glad.h>
+
+// * NOTE: calling glBufferData every frame for geometry that changes makes the driver allocate (or rename) a buffer
+// each time, and it may stall if the GPU is still reading the old one.
+// A stream buffer is ONE big buffer used as a ring: every frame we write into the next free piece of it, and when we
+// wrap around we only reuse bytes the GPU has finished with. "Finished" is tracked with fences (glFenceSync): one per
+// frame, marking how far into the ring that frame wrote.
+//
+// Two ways of getting a CPU pointer into the buffer:
+//   persistent: ARB_buffer_storage lets us map the whole thing ONCE and keep writing through that pointer forever
+//               (coherent = no flush needed, the GPU sees our writes)
+//   fallback:   glMapBufferRange each allocation with GL_MAP_UNSYNCHRONIZED_BIT (we do the syncing with our fences),
+//               and glUnmapBuffer before drawing. Only one allocation can be mapped at a time this way.
+//
+// ! the buffer is bound to GL_COPY_WRITE_BUFFER while mapping, so it never disturbs the GL_ARRAY_BUFFER binding
+
+// a piece of the ring handed out by Allocate
+struct StreamAllocation
+{
+	void* data = nullptr;   // write the data here
+	GLintptr offset = 0;    // byte offset inside the buffer, use it for glVertexAttribPointer / glDrawArrays first
+	GLsizeiptr size = 0;
+};
+
+class StreamBuffer
+{
+public:
+	// capacity should hold several frames worth of data, otherwise we end up waiting on the GPU every frame.
+	// It MUST hold at least one frame: data allocated earlier in a frame is only safe until it has been drawn
+	StreamBuffer(GLsizeiptr capacity, bool allowPersistent = true);
+	~StreamBuffer();
+
+	StreamBuffer(const StreamBuffer&) = delete;
+	StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+	// reserves size bytes, with the offset rounded up to a multiple of alignment.
+	// Waits for the GPU only if the ring is full of data it's still using
+	StreamAllocation Allocate(GLsizeiptr size, GLsizeiptr alignment = 16);
+
+	// makes the written data visible to GL. Call before drawing with it (a no-op for persistent mapping)
+	void Commit(const StreamAllocation& allocation);
+
+	// puts a fence behind everything drawn this frame, call once per frame after the draws
+	void EndFrame();
+
+	GLuint ID() const { return buffer; }
+	GLsizeiptr Capacity() const { return capacity; }
+	bool Persistent() const { return mapped != nullptr; }
+
+	// how often Allocate had to wait for the GPU, and how often the ring wrapped around
+	int Stalls() const { return stalls; }
+	int Wraps() const { return wraps; }
+
+private:
+	struct FrameFence
+	{
+		GLsync fence;
+		uint64_t end; // absolute write position when the fence was placed
+	};
+
+	// waits for the oldest frame still in flight and forgets it
+	void RetireOldest();
+
+	GLuint buffer = 0;
+	GLsizeiptr capacity;
+	char* mapped = nullptr;
+
+	// positions count bytes written since creation (they never wrap), ring offset = position % capacity
+	uint64_t head = 0;       // next free byte
+	uint64_t frameStart = 0; // where this frame's first allocation went
+	uint64_t retired = 0;    // everything before this, the GPU is done with
+	std::deque<FrameFence> inFlight;
+
+	int stalls = 0;
+	int wraps = 0;
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include"StressScene.h"
+
+#include<cmath>
+
+// positions come per vertex, transform and color per instance (or as constant attributes in the naive path)
+static const char* instancedVertexSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"layout (location = 1) in vec4 aTransform; // offset.xy, scale, rotation\n"
+"layout (location = 2) in vec4 aColor;\n"
+"out vec4 color;\n"
+"void main()\n"
+"{\n"
+"	float c = cos(aTransform.w);\n"
+"	float s = sin(aTransform.w);\n"
+"	vec2 p = aPos.xy * aTransform.z;\n"
+"	p = vec2(p.x * c - p.y * s, p.x * s + p.y * c) + aTransform.xy;\n"
+"	gl_Position = vec4(p, aPos.z, 1.0);\n"
+"	color = aColor;\n"
+"}\n";
+
+static const char* instancedFragmentSource = "#version 330 core\n"
+"in vec4 color;\n"
+"out vec4 FragColor;\n"
+"void main()\n"
+"{\n"
+"	FragColor = color;\n"
+"}\n";
+
+StressScene::StressScene(bool instanced, int count)
+	: instanced(instanced), count(count)
+{
+}
+
+void StressScene::AddPrograms(ShaderManager& manager)
+{
+	shaders = &manager;
+	program = shaders->Add("instanced", instancedVertexSource, instancedFragmentSource);
+}
+
+bool StressScene::BuildGeometry(VertexArrayCache& cache)
+{
+	// the same triangle as the main scene, centered on its middle so rotating it spins it in place
+	const float h = std::sqrt(3.0f) / 2.0f;
+	std::vector<float> positions =
+	{
+		-0.5f, -h / 3.0f, 0.0f,
+		0.5f, -h / 3.0f, 0.0f,
+		0.0f, h * 2.0f / 3.0f, 0.0f
+	};
+	mesh.reset(new InstancedMesh(positions, std::vector<GLuint>(), cache));
+
+	// a square grid that covers the screen, one triangle per cell
+	int side = (int)std::ceil(std::sqrt((double)count));
+	float cell = 2.0f / side;
+	instances.resize(count);
+	for (int i = 0; i < count; i++)
+	{
+		int x = i % side, y = i / side;
+		InstanceData& instance = instances[i];
+		instance.offsetX = -1.0f + (x + 0.5f) * cell;
+		instance.offsetY = -1.0f + (y + 0.5f) * cell;
+		instance.scale = cell * 0.9f;
+		instance.rotation = (float)(i % 360) * 3.14159265f / 180.0f;
+		// cheap integer hash so neighbours get different colors
+		uint32_t h32 = (uint32_t)i * 2654435761u;
+		instance.color[0] = (uint8_t)(64 + (h32 >> 24) % 192);
+		instance.color[1] = (uint8_t)(64 + (h32 >> 16) % 192);
+		instance.color[2] = (uint8_t)(64 + (h32 >> 8) % 192);
+		instance.color[3] = 255;
+	}
+	mesh->SetInstances(instances);
+	return true;
+}
+
+void StressScene::Draw(StateCache& state, int)
+{
+	GLuint id = shaders->Get(program);
+	if (id == 0)
+		return;
+	state.UseProgram(id);
+
+	if (instanced)
+	{
+		state.BindVertexArray(mesh->VertexArray());
+		mesh->DrawInstanced();
+		return;
+	}
+
+	state.BindVertexArray(mesh->NaiveVertexArray());
+	for (const InstanceData& instance : instances)
+		mesh->DrawSingle(instance);
+}
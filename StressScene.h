@@ -0,0 +1,37 @@
+#ifndef STRESS_SCENE_CLASS_H
+#define STRESS_SCENE_CLASS_H
+
+#include<memory>
+#include<vector>
+#include"InstancedMesh.h"
+#include"Scene.h"
+
+// lots of small triangles in a grid, to compare the two ways of submitting them:
+//   naive:     one glDrawArrays per triangle, its transform/color set as constant attributes before each draw
+//   instanced: one glDrawArraysInstanced for all of them
+// both use the same shader and produce the same image, only the number of draw calls differs
+class StressScene : public Scene
+{
+public:
+	StressScene(bool instanced, int count);
+
+	const char* Name() const override { return instanced ? "instanced" : "naive"; }
+	void AddPrograms(ShaderManager& shaders) override;
+	bool BuildGeometry(VertexArrayCache& vertexArrays) override;
+	void Draw(StateCache& state, int frame) override;
+	int Objects() const override { return count; }
+	int DrawCalls() const override { return instanced ? 1 : count; }
+
+private:
+	bool instanced;
+	int count;
+
+	ShaderManager* shaders = nullptr;
+	ProgramHandle program = -1;
+
+	std::unique_ptr<InstancedMesh> mesh;
+	// kept on the CPU for the naive path
+	std::vector<InstanceData> instances;
+};
+
+#endif
@@ -0,0 +1,61 @@
+#include"ThreadPool.h"
+
+ThreadPool::ThreadPool(int threads)
+{
+	if (threads <= 0)
+		threads = (int)std::thread::hardware_concurrency();
+	if (threads <= 0)
+		threads = 1;
+	for (int i = 0; i < threads; i++)
+		workers.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	taskReady.notify_all();
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		tasks.push_back(std::move(task));
+	}
+	taskReady.notify_one();
+}
+
+void ThreadPool::Wait()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	idle.wait(lock, [this] { return tasks.empty() && running == 0; });
+}
+
+void ThreadPool::WorkerLoop()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true)
+	{
+		taskReady.wait(lock, [this] { return stopping || !tasks.empty(); });
+		// when stopping, the queue is still emptied first
+		if (tasks.empty())
+			return;
+
+		std::function<void()> task = std::move(tasks.front());
+		tasks.pop_front();
+		running++;
+
+		lock.unlock();
+		task();
+		lock.lock();
+
+		running--;
+		if (tasks.empty() && running == 0)
+			idle.notify_all();
+	}
+}
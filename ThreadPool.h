@@ -0,0 +1,43 @@
+#ifndef THREAD_POOL_CLASS_H
+#define THREAD_POOL_CLASS_H
+
+#include<condition_variable>
+#include<deque>
+#include<functional>
+#include<mutex>
+#include<thread>
+#include<vector>
+
+// * NOTE: a fixed set of worker threads that run whatever is queued, oldest first.
+// ! the workers have NO GL context: only plain CPU work (encoding, parsing...) goes in here
+class ThreadPool
+{
+public:
+	// 0 threads = one per hardware thread
+	explicit ThreadPool(int threads = 0);
+	// finishes everything that's queued, then joins the workers
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	void Enqueue(std::function<void()> task);
+
+	// blocks until the queue is empty and no worker is running a task
+	void Wait();
+
+	int Threads() const { return (int)workers.size(); }
+
+private:
+	void WorkerLoop();
+
+	std::vector<std::thread> workers;
+	std::deque<std::function<void()>> tasks;
+	std::mutex mutex;
+	std::condition_variable taskReady;
+	std::condition_variable idle;
+	int running = 0;
+	bool stopping = false;
+};
+
+#endif
@@ -0,0 +1,174 @@
+#include"TriangleScene.h"
+
+#include"SoftRasterizer.h"
+
+#include<cmath>
+#include<cstring>
+#include<iostream>
+
+// * NOTE: all OpenGL objects are accessed by References!!
+
+// Vertex shader source code
+static const char* vertexShaderSource = "#version 330 core\n"
+"layout (location = 0) in vec3 aPos;\n"
+"void main()\n"
+"{\n"
+"	gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+"}\0";
+
+// Fragment shader source code
+static const char* fragmentShaderSource = "#version 330 core\n"
+"out vec4 FragColor;\n"
+"void main()\n"
+"{\n"
+"	FragColor = vec4(0.8f, 0.3f, 0.02f, 1.0f);\n"
+"}\n\0";
+
+// coordinates of vertices
+static const GLfloat vertices[] =
+{
+	-0.5f, -0.5f * float(sqrt(3)) / 3, 0.0f, // LEFT : BOTTOM
+	0.5f, -0.5f * float(sqrt(3)) / 3, 0.0f, // RIGHT : BOTTOM
+	0.0f, 0.5f * float(sqrt(3)) * 2 / 3, 0.0f // ORIGIN (mid) : UPPER
+};
+
+// spins the triangle around the Z axis for the dynamic geometry path
+static void RotateTriangle(const GLfloat* in, GLfloat* out, float angle)
+{
+	float c = std::cos(angle), s = std::sin(angle);
+	for (int v = 0; v < 3; v++)
+	{
+		out[v * 3 + 0] = in[v * 3 + 0] * c - in[v * 3 + 1] * s;
+		out[v * 3 + 1] = in[v * 3 + 0] * s + in[v * 3 + 1] * c;
+		out[v * 3 + 2] = in[v * 3 + 2];
+	}
+}
+
+TriangleScene::TriangleScene(StreamMode stream, bool persistentMapping)
+	: stream(stream), persistentMapping(persistentMapping)
+{
+}
+
+TriangleScene::~TriangleScene()
+{
+	// the cache forgets the VAOs reading our buffers before the members delete them (--soft never made any)
+	if (vertexArrays == nullptr)
+		return;
+	vertexArrays->Release(VBO1.ID);
+	vertexArrays->Release(dynamicVBO.ID);
+	if (ring)
+		vertexArrays->Release(ring->ID());
+}
+
+void TriangleScene::AddPrograms(ShaderManager& manager)
+{
+	shaders = &manager;
+	program = shaders->Add("triangle", vertexShaderSource, fragmentShaderSource);
+}
+
+bool TriangleScene::BuildGeometry(VertexArrayCache& cache)
+{
+	vertexArrays = &cache;
+
+	// Creates the Vertex Buffer Object and Vertex Array Object (see VBO.cpp / VAO.cpp for what each GL call does)
+	//VBO: stores the ACTUAL vertex data
+	//VAO: a blueprint for rendering vertex data
+	// they delete their GL objects by themselves when they go out of scope (or on Delete())
+
+	// generates the VBO and PUTS the vertex data into it
+	VBO1 = VBO(vertices, sizeof(vertices));
+
+	// the VAO links the VBO's positions to attribute 0. PositionVertex (3 floats) says how, so no stride or offset
+	// gets typed in by hand (see VertexLayout.h). The cache generates the VAO, links it and leaves it unbound
+	VAO1 = vertexArrays->Get(VertexLayoutOf<PositionVertex>::layout, VertexBuffers(VBO1.ID));
+
+	// dynamic geometry: a second VAO whose positions are rewritten every frame, either through the ring buffer
+	// (the VAO reads from the stream buffer and each frame's vertices sit at a different offset in it)
+	// or by re-uploading a whole VBO with glBufferData
+	if (stream == StreamMode::Ring)
+	{
+		// 64 KiB: thousands of frames of one triangle before it wraps
+		ring.reset(new StreamBuffer(64 * 1024, persistentMapping));
+		dynamicVAO = vertexArrays->Get(VertexLayoutOf<PositionVertex>::layout, VertexBuffers(ring->ID()));
+		std::cout << "stream buffer: " << (ring->Persistent() ? "persistent coherent mapping" : "unsynchronized mapping + fences") << std::endl;
+	}
+	else if (stream == StreamMode::BufferData)
+	{
+		dynamicVBO = VBO(vertices, sizeof(vertices), GL_STREAM_DRAW);
+		dynamicVAO = vertexArrays->Get(VertexLayoutOf<PositionVertex>::layout, VertexBuffers(dynamicVBO.ID));
+	}
+	return true;
+}
+
+void TriangleScene::Draw(StateCache& state, int frame)
+{
+	// first frame: this is where we'd wait if the program is still compiling
+	GLuint shaderProgram = shaders->Get(program);
+	if (shaderProgram == 0)
+		return;
+
+	// specifies our shader program will be used
+	state.UseProgram(shaderProgram);
+
+	// Renders our vertices
+		// 1st param: specifies primitive to draw between vertices from the array
+		// 2nd param: specifies the starting index within the bound Vertex Array.
+		// 3rd param: specifies the number of vertices to render in total this way (in our case, the length of our vertices array)
+	if (stream == StreamMode::Off)
+	{
+		// loads our VAO which contains the organized version of our VBO
+		state.BindVertexArray(VAO1);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+		return;
+	}
+
+	GLfloat moved[9];
+	RotateTriangle(vertices, moved, frame * 0.01f);
+
+	GLint first = 0;
+	if (ring)
+	{
+		// a new piece of the ring every frame, aligned to whole vertices so "first" can point at it
+		StreamAllocation allocation = ring->Allocate(sizeof(moved), 3 * sizeof(float));
+		std::memcpy(allocation.data, moved, sizeof(moved));
+		ring->Commit(allocation);
+		first = (GLint)(allocation.offset / (3 * sizeof(float)));
+	}
+	else
+	{
+		// the old way: hand the driver a whole new buffer every frame
+		state.BindBuffer(GL_ARRAY_BUFFER, dynamicVBO.ID);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(moved), moved, GL_STREAM_DRAW);
+	}
+
+	state.BindVertexArray(dynamicVAO);
+	glDrawArrays(GL_TRIANGLES, first, 3);
+
+	// fences everything this frame read from the ring
+	if (ring)
+		ring->EndFrame();
+}
+
+// same triangle on the CPU. Nothing to upload there, so every stream mode just means "spinning"
+void TriangleScene::DrawSoftware(SoftRasterizer& raster, int frame)
+{
+	GLfloat moved[9];
+	const GLfloat* positions = vertices;
+	if (stream != StreamMode::Off)
+	{
+		RotateTriangle(vertices, moved, frame * 0.01f);
+		positions = moved;
+	}
+
+	// the fragment shader's color, at every corner
+	SoftVertex corners[3];
+	for (int v = 0; v < 3; v++)
+		corners[v] = { positions[v * 3 + 0], positions[v * 3 + 1], positions[v * 3 + 2], 0.8f, 0.3f, 0.02f };
+	raster.DrawTriangles(corners, 3, nullptr, 0);
+}
+
+void TriangleScene::PrintReport() const
+{
+	if (ring)
+		std::cout << "stream buffer: " << ring->Wraps() << " wraps, " << ring->Stalls() << " stalls waiting for the GPU" << std::endl;
+}
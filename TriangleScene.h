@@ -0,0 +1,45 @@
+#ifndef TRIANGLE_SCENE_CLASS_H
+#define TRIANGLE_SCENE_CLASS_H
+
+#include<memory>
+#include"Options.h"
+#include"Scene.h"
+#include"StreamBuffer.h"
+#include"VBO.h"
+#include"VertexArrayCache.h"
+
+// the original scene: one orange triangle in the middle of the screen.
+// With a stream mode it draws a spinning copy instead, whose vertices are uploaded every frame
+class TriangleScene : public Scene
+{
+public:
+	TriangleScene(StreamMode stream, bool persistentMapping);
+	~TriangleScene() override;
+
+	const char* Name() const override { return "triangle"; }
+	void AddPrograms(ShaderManager& shaders) override;
+	bool BuildGeometry(VertexArrayCache& vertexArrays) override;
+	void Draw(StateCache& state, int frame) override;
+	bool InitSoftware() override { return true; }
+	void DrawSoftware(SoftRasterizer& raster, int frame) override;
+	void PrintReport() const override;
+
+private:
+	StreamMode stream;
+	bool persistentMapping;
+
+	ShaderManager* shaders = nullptr;
+	ProgramHandle program = -1;
+
+	// the context's VAOs (see VertexArrayCache.h), nullptr until BuildGeometry
+	VertexArrayCache* vertexArrays = nullptr;
+	GLuint VAO1 = 0;
+	VBO VBO1;
+
+	// dynamic geometry, only used with a stream mode
+	std::unique_ptr<StreamBuffer> ring;
+	GLuint dynamicVAO = 0;
+	VBO dynamicVBO;
+};
+
+#endif
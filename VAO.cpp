@@ -0,0 +1,83 @@
+#include"VAO.h"
+
+VAO& VAO::operator=(VAO&& other) noexcept
+{
+	if (this != &other)
+	{
+		Delete();
+		ID = other.ID;
+		other.ID = 0;
+	}
+	return *this;
+}
+
+void VAO::LinkAttrib(const VBO& vbo, GLuint layout, GLint numComponents, GLenum type, GLsizei stride, const void* offset,
+	GLboolean normalized)
+{
+	vbo.Bind();
+
+	// Configure the Vertex Attribute so that OpenGL knows how to Read the VBO
+		// 1st param: Index of the vertex attribute
+		// 2nd param: specifies how many components per vertex attribute
+		// 3rd param: Specifies the type of each component (e.g. GL_FLOAT)
+		// 4th param: whether integer data gets mapped to 0..1 (or -1..1)
+		// 5th param: Specifies the "stride". e.g. if each vertex in our array has 3 components of type FLOAT, the stride is the total number of bytes that 3 float type variables would occupy
+			// Stride: in memory, how much memory in bytes does our attribute take up, and when should we explect to find the "next" one
+		// 6th param: pointer to the first component of the first attribute. The offset in bytes from the beginning of each vertex in the buffer
+			// (void*)0
+	// this also essentially links our VBO's data INTO our VAO, and HOW OpenGL should do that linking
+	glVertexAttribPointer(layout, numComponents, type, normalized, stride, offset);
+
+	// turns the attribute on. Index 0 is typically VERTEX POSITION
+	glEnableVertexAttribArray(layout);
+
+	// unbinds the GL_ARRAY_BUFFER so that in case we do any calls later to it, so that we don't mistakenly change our VBO data
+	// (the VAO already remembered which buffer this attribute reads from)
+	vbo.Unbind();
+}
+
+void VAO::LinkLayout(const VertexLayout& layout, const VertexBuffers& buffers)
+{
+	// the same calls as LinkAttrib, with everything the layout already knows: which buffer each attribute reads
+	// (plus where in that buffer the vertices start), the stride of its struct and its divisor
+	for (uint32_t i = 0; i < layout.attributeCount; i++)
+	{
+		const VertexAttribute& attribute = layout.attributes[i];
+		const VertexBinding& binding = layout.bindings[attribute.binding];
+		glBindBuffer(GL_ARRAY_BUFFER, buffers.buffers[attribute.binding]);
+		glVertexAttribPointer(attribute.location, attribute.components, attribute.type, attribute.normalized, binding.stride,
+			(void*)(buffers.offsets[attribute.binding] + (GLintptr)attribute.offset));
+		glEnableVertexAttribArray(attribute.location);
+		if (binding.divisor != 0)
+			glVertexAttribDivisor(attribute.location, binding.divisor);
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	// bound while the VAO is, so the VAO remembers it
+	if (buffers.elements != 0)
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers.elements);
+}
+
+void VAO::Bind()
+{
+	// creating a placeholder in GPU memory to store the configuration for the vertex data
+	if (ID == 0)
+		glGenVertexArrays(1, &ID);
+
+	//This means that any subsequent OpenGL calls that deal with vertex data will use the currently bound VAO as their context.
+	glBindVertexArray(ID);
+}
+
+void VAO::Unbind() const
+{
+	glBindVertexArray(0);
+}
+
+void VAO::Delete()
+{
+	if (ID != 0)
+	{
+		glDeleteVertexArrays(1, &ID);
+		ID = 0;
+	}
+}
@@ -0,0 +1,42 @@
+#ifndef VAO_CLASS_H
+#define VAO_CLASS_H
+
+#include<glad/glad.h>
+#include"VBO.h"
+#include"VertexLayout.h"
+
+// Vertex Array Object: a blueprint for rendering vertex data. It remembers which buffers the attributes
+// read from and how (layout, type, stride, offset). Move-only handle, see VBO.h
+class VAO
+{
+public:
+	// ID reference of the Vertex Array Object, 0 = none
+	GLuint ID = 0;
+
+	// empty handle: the vertex array is generated the first time it's bound, so a scene (and its VAOs) can be
+	// constructed without a GL context, e.g. for --soft
+	VAO() {}
+	~VAO() { Delete(); }
+
+	VAO(const VAO&) = delete;
+	VAO& operator=(const VAO&) = delete;
+	VAO(VAO&& other) noexcept : ID(other.ID) { other.ID = 0; }
+	VAO& operator=(VAO&& other) noexcept;
+
+	// links a VBO attribute (position, color, ...) to the VAO using a certain layout. The VAO must be bound
+	void LinkAttrib(const VBO& vbo, GLuint layout, GLint numComponents, GLenum type, GLsizei stride, const void* offset,
+		GLboolean normalized = GL_FALSE);
+	// links every attribute of a layout to its buffer, with the divisors, and the element buffer if there is one
+	// (see VertexLayout.h). The VAO must be bound
+	void LinkLayout(const VertexLayout& layout, const VertexBuffers& buffers);
+
+	// generates the vertex array first if it doesn't exist yet
+	void Bind();
+	void Unbind() const;
+	// deletes the vertex array now instead of waiting for the destructor (e.g. before the context goes away)
+	void Delete();
+};
+
+static_assert(sizeof(VAO) == sizeof(GLuint), "VAO must stay a bare handle");
+
+#endif
@@ -0,0 +1,45 @@
+#include"VBO.h"
+
+VBO::VBO(const void* vertices, GLsizeiptr size, GLenum usage)
+{
+	// creating a placeholder in GPU memory to store the actual vertex data
+	glGenBuffers(1, &ID);
+
+	// tells OpenGL that operations will apply to VBO, and it should be considered as the current GL_ARRAY_BUFFER
+	// preparation to send vertex data to the VBO
+	glBindBuffer(GL_ARRAY_BUFFER, ID);
+
+	// actually PUTS the vertex data into the current buffer (which we specified above is also the VBO
+	// 4th parameter specifies how to use the data from the buffer
+	glBufferData(GL_ARRAY_BUFFER, size, vertices, usage);
+}
+
+VBO& VBO::operator=(VBO&& other) noexcept
+{
+	if (this != &other)
+	{
+		Delete();
+		ID = other.ID;
+		other.ID = 0;
+	}
+	return *this;
+}
+
+void VBO::Bind() const
+{
+	glBindBuffer(GL_ARRAY_BUFFER, ID);
+}
+
+void VBO::Unbind() const
+{
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void VBO::Delete()
+{
+	if (ID != 0)
+	{
+		glDeleteBuffers(1, &ID);
+		ID = 0;
+	}
+}
@@ -0,0 +1,39 @@
+#ifndef VBO_CLASS_H
+#define VBO_CLASS_H
+
+#include<glad/glad.h>
+
+// * NOTE: the GL object classes (VBO, EBO, VAO, Shader) are just a GLuint with a destructor.
+// They can't be copied (two owners would delete the same object twice), only MOVED: the new one takes the ID
+// and the old one is left holding 0, which GL ignores. No heap, no virtual functions, so a std::vector<VBO>
+// is laid out exactly like a std::vector<GLuint> and growing it just moves the numbers around.
+
+// Vertex Buffer Object: stores the ACTUAL vertex data on the GPU
+class VBO
+{
+public:
+	// ID reference of the Vertex Buffer Object, 0 = none
+	GLuint ID = 0;
+
+	// empty handle, owns nothing
+	VBO() {}
+	// generates a buffer and uploads size bytes of vertices into it
+	VBO(const void* vertices, GLsizeiptr size, GLenum usage = GL_STATIC_DRAW);
+	~VBO() { Delete(); }
+
+	VBO(const VBO&) = delete;
+	VBO& operator=(const VBO&) = delete;
+	VBO(VBO&& other) noexcept : ID(other.ID) { other.ID = 0; }
+	VBO& operator=(VBO&& other) noexcept;
+
+	// binds it to GL_ARRAY_BUFFER
+	void Bind() const;
+	// binds 0 to GL_ARRAY_BUFFER
+	void Unbind() const;
+	// deletes the buffer now instead of waiting for the destructor (e.g. before the context goes away)
+	void Delete();
+};
+
+static_assert(sizeof(VBO) == sizeof(GLuint), "VBO must stay a bare handle");
+
+#endif
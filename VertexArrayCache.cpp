@@ -0,0 +1,58 @@
+#include"VertexArrayCache.h"
+
+#include<cstdio>
+#include<iterator>
+
+size_t VertexArrayCache::KeyHash::operator()(const Key& key) const
+{
+	// the layout key is a hash already, fold the buffer names and offsets into it
+	uint64_t hash = key.layout.key;
+	auto mix = [&hash](uint64_t value) { hash = (hash ^ value) * 0x9E3779B97F4A7C15ull; };
+	for (int i = 0; i < VertexBuffers::MaxBindings; i++)
+	{
+		mix(key.buffers.buffers[i]);
+		mix((uint64_t)key.buffers.offsets[i]);
+	}
+	mix(key.buffers.elements);
+	return (size_t)(hash ^ (hash >> 32));
+}
+
+GLuint VertexArrayCache::Get(const VertexLayout& layout, const VertexBuffers& buffers)
+{
+	Key key = { layout, buffers };
+	auto found = vertexArrays.find(key);
+	if (found != vertexArrays.end())
+	{
+		hits++;
+		return found->second.ID;
+	}
+
+	misses++;
+	VAO& vao = vertexArrays[key];
+	vao.Bind();
+	vao.LinkLayout(layout, buffers);
+	vao.Unbind();
+	return vao.ID;
+}
+
+void VertexArrayCache::Release(GLuint buffer)
+{
+	if (buffer == 0)
+		return;
+	for (auto entry = vertexArrays.begin(); entry != vertexArrays.end();)
+	{
+		const VertexBuffers& buffers = entry->first.buffers;
+		bool reads = buffers.elements == buffer;
+		for (int i = 0; i < VertexBuffers::MaxBindings; i++)
+			reads = reads || buffers.buffers[i] == buffer;
+		entry = reads ? vertexArrays.erase(entry) : std::next(entry);
+	}
+}
+
+void VertexArrayCache::PrintReport() const
+{
+	if (hits + misses == 0)
+		return;
+	std::printf("vertex array cache: %llu VAOs configured, %llu requests reused one (%.1f%%), %zu alive\n",
+		(unsigned long long)misses, (unsigned long long)hits, 100.0 * hits / (hits + misses), vertexArrays.size());
+}
@@ -0,0 +1,66 @@
+#ifndef VERTEX_ARRAY_CACHE_CLASS_H
+#define VERTEX_ARRAY_CACHE_CLASS_H
+
+#include<cstdint>
+#include<unordered_map>
+#include"VAO.h"
+#include"VertexLayout.h"
+
+// * NOTE: a VAO is nothing but a layout + the buffers it reads from. Two meshes with the same layout in the same
+// buffers (at the same offsets) would configure two identical VAOs, so the cache hands out one VAO per
+// (layout, buffers) and only runs the attribute setup the first time it sees a combination.
+//
+// There's one per context (main.cpp, gl_bench and gl_tests make it next to the ShaderManager), shared by every scene
+// and mesh, so it also finds the VAOs two of them would otherwise both make.
+//
+// ! once a buffer is deleted GL may give its name to a new buffer, and a VAO still cached under that name reads the
+// OLD storage. So whoever owns a buffer calls Release(buffer) BEFORE deleting it (the scenes do in their
+// destructors), and the cache itself goes (or Clear()s) before the context does
+
+class VertexArrayCache
+{
+public:
+	// the VAO reading buffers through layout, configured the first time. Leaves no VAO bound (0) when it had to
+	// make one; draws should bind the returned name through the StateCache as usual
+	GLuint Get(const VertexLayout& layout, const VertexBuffers& buffers);
+
+	// deletes the VAOs reading buffer (as a vertex or element buffer), before buffer itself is deleted. 0 does nothing
+	void Release(GLuint buffer);
+	// deletes every VAO (before the context goes away)
+	void Clear() { vertexArrays.clear(); }
+
+	size_t Size() const { return vertexArrays.size(); }
+	// Get calls that found their VAO / had to configure one
+	uint64_t Hits() const { return hits; }
+	uint64_t Misses() const { return misses; }
+	// one line with the above, printed after the loop
+	void PrintReport() const;
+
+private:
+	// the layout's tables are compared in full, its key only picks the bucket
+	struct Key
+	{
+		VertexLayout layout;
+		VertexBuffers buffers;
+
+		bool operator==(const Key& other) const
+		{
+			if (buffers.elements != other.buffers.elements || !SameLayout(layout, other.layout))
+				return false;
+			for (int i = 0; i < VertexBuffers::MaxBindings; i++)
+				if (buffers.buffers[i] != other.buffers.buffers[i] || buffers.offsets[i] != other.buffers.offsets[i])
+					return false;
+			return true;
+		}
+	};
+	struct KeyHash
+	{
+		size_t operator()(const Key& key) const;
+	};
+
+	std::unordered_map<Key, VAO, KeyHash> vertexArrays;
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+};
+
+#endif
@@ -0,0 +1,193 @@
+#include"VertexFormat.h"
+
+#include<cmath>
+#include<cstring>
+
+// Auto: the position error may be at most this fraction of the average edge length. A thirty-second of an edge
+// doesn't move any pixel on a mesh that fits the screen unless the edges are well over 30 pixels long
+static const float AutoErrorFraction = 1.0f / 32.0f;
+// edges measured for Auto, spread evenly over the mesh
+static const size_t AutoSampleTriangles = 4096;
+
+const char* VertexFormatName(VertexFormat format)
+{
+	switch (format)
+	{
+	case VertexFormat::Float: return "float";
+	case VertexFormat::Half: return "half";
+	case VertexFormat::Quantized16: return "quant16";
+	case VertexFormat::Quantized10: return "quant10";
+	case VertexFormat::Auto: return "auto";
+	}
+	return "?";
+}
+
+VertexEncoding MakeVertexEncoding(VertexFormat format, const float* boundsMin, const float* boundsMax)
+{
+	VertexEncoding encoding;
+	encoding.format = format;
+	switch (format)
+	{
+	case VertexFormat::Half:
+		encoding.layout = VertexLayoutOf<HalfVertex>::layout;
+		return encoding;
+	case VertexFormat::Quantized16:
+		encoding.layout = VertexLayoutOf<Quantized16Vertex>::layout;
+		break;
+	case VertexFormat::Quantized10:
+		encoding.layout = VertexLayoutOf<Quantized10Vertex>::layout;
+		break;
+	default:
+		encoding.format = VertexFormat::Float;
+		encoding.layout = VertexLayoutOf<FloatVertex>::layout;
+		return encoding;
+	}
+
+	// the quantized ones: 0..1 across the bounding box
+	for (int k = 0; k < 3; k++)
+	{
+		encoding.positionOffset[k] = boundsMin[k];
+		encoding.positionScale[k] = boundsMax[k] - boundsMin[k];
+	}
+	return encoding;
+}
+
+VertexFormat ChooseVertexFormat(const float* vertices, size_t vertexCount, const GLuint* indices, size_t indexCount,
+	const float* boundsMin, const float* boundsMax)
+{
+	size_t triangles = (indices != nullptr ? indexCount : vertexCount) / 3;
+	if (triangles == 0)
+		return VertexFormat::Float;
+
+	// the average edge length from a sample of the triangles: all of them would be a pass over the whole mesh
+	// for a number that barely changes
+	size_t step = triangles > AutoSampleTriangles ? triangles / AutoSampleTriangles : 1;
+	double edgeSum = 0.0;
+	size_t edges = 0;
+	for (size_t t = 0; t < triangles; t += step)
+	{
+		for (int k = 0; k < 3; k++)
+		{
+			size_t a = indices != nullptr ? indices[t * 3 + k] : t * 3 + k;
+			size_t b = indices != nullptr ? indices[t * 3 + (k + 1) % 3] : t * 3 + (k + 1) % 3;
+			const float* pa = &vertices[a * 6];
+			const float* pb = &vertices[b * 6];
+			edgeSum += std::sqrt((double)(pa[0] - pb[0]) * (pa[0] - pb[0]) + (double)(pa[1] - pb[1]) * (pa[1] - pb[1])
+				+ (double)(pa[2] - pb[2]) * (pa[2] - pb[2]));
+			edges++;
+		}
+	}
+	double budget = edgeSum / edges * AutoErrorFraction;
+
+	// rounding to the nearest step is off by at most half a step
+	double extent = 0.0;
+	for (int k = 0; k < 3; k++)
+		extent = std::fmax(extent, (double)boundsMax[k] - boundsMin[k]);
+	if (extent / 1023.0 / 2.0 <= budget)
+		return VertexFormat::Quantized10;
+	if (extent / 65535.0 / 2.0 <= budget)
+		return VertexFormat::Quantized16;
+	return VertexFormat::Float;
+}
+
+uint16_t FloatToHalf(float value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+	uint32_t magnitude = bits & 0x7fffffff;
+
+	// infinity and NaN stay what they are
+	if (magnitude >= 0x7f800000)
+		return sign | 0x7c00 | (magnitude > 0x7f800000 ? 0x200 : 0);
+	// 65520 and up round to infinity
+	if (magnitude >= 0x477ff000)
+		return sign | 0x7c00;
+	// under 2^-14 it's a subnormal half: a count of 2^-24 steps. Scaling by a power of two is exact, and rint
+	// rounds to nearest even. 1024 steps comes out as 0x0400, the smallest normal half, which is right too
+	if (magnitude < 0x38800000)
+	{
+		float absolute;
+		std::memcpy(&absolute, &magnitude, sizeof(absolute));
+		return sign | (uint16_t)std::rint(absolute * 16777216.0f);
+	}
+	// normal: rebias the exponent and drop 13 mantissa bits, rounding to nearest even. A carry out of the mantissa
+	// runs into the exponent, which is the right answer
+	uint32_t half = ((magnitude >> 23) - 127 + 15) << 10 | (magnitude & 0x7fffff) >> 13;
+	uint32_t rest = magnitude & 0x1fff;
+	if (rest > 0x1000 || (rest == 0x1000 && (half & 1) != 0))
+		half++;
+	return sign | (uint16_t)half;
+}
+
+// a unit vector as GL_INT_2_10_10_10_REV: x in bits 0..9, y 10..19, z 20..29, each -511..511 for -1..1
+static uint32_t PackNormal(const float* n)
+{
+	uint32_t packed = 0;
+	for (int k = 0; k < 3; k++)
+	{
+		float c = n[k] < -1.0f ? -1.0f : n[k] > 1.0f ? 1.0f : n[k];
+		int32_t q = (int32_t)std::lround(c * 511.0f);
+		packed |= ((uint32_t)q & 0x3ff) << (10 * k);
+	}
+	return packed;
+}
+
+// position -> 0..steps inside the layout's box
+static uint32_t Quantize(float value, float offset, float scale, uint32_t steps)
+{
+	if (scale <= 0.0f)
+		return 0;
+	float t = (value - offset) / scale;
+	t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+	return (uint32_t)std::lround(t * steps);
+}
+
+// fills one Vertex per float vertex with pack(in, out), right into the byte buffer
+template<typename Vertex, typename Pack>
+static std::vector<unsigned char> EncodeAs(const float* vertices, size_t vertexCount, Pack pack)
+{
+	std::vector<unsigned char> data(sizeof(Vertex) * vertexCount, 0);
+	for (size_t v = 0; v < vertexCount; v++)
+	{
+		Vertex out = {};
+		pack(&vertices[v * 6], out);
+		std::memcpy(&data[v * sizeof(Vertex)], &out, sizeof(Vertex));
+	}
+	return data;
+}
+
+std::vector<unsigned char> EncodeVertices(const VertexEncoding& encoding, const float* vertices, size_t vertexCount)
+{
+	const float* scale = encoding.positionScale;
+	const float* offset = encoding.positionOffset;
+	switch (encoding.format)
+	{
+	case VertexFormat::Half:
+		return EncodeAs<HalfVertex>(vertices, vertexCount, [](const float* in, HalfVertex& out)
+		{
+			for (int k = 0; k < 3; k++)
+				out.position[k].bits = FloatToHalf(in[k]);
+			out.normal.bits = PackNormal(in + 3);
+		});
+	case VertexFormat::Quantized16:
+		return EncodeAs<Quantized16Vertex>(vertices, vertexCount, [scale, offset](const float* in, Quantized16Vertex& out)
+		{
+			for (int k = 0; k < 3; k++)
+				out.position[k] = (uint16_t)Quantize(in[k], offset[k], scale[k], 65535);
+			out.normal.bits = PackNormal(in + 3);
+		});
+	case VertexFormat::Quantized10:
+		return EncodeAs<Quantized10Vertex>(vertices, vertexCount, [scale, offset](const float* in, Quantized10Vertex& out)
+		{
+			for (int k = 0; k < 3; k++)
+				out.position.bits |= Quantize(in[k], offset[k], scale[k], 1023) << (10 * k);
+			out.normal.bits = PackNormal(in + 3);
+		});
+	default:
+		return EncodeAs<FloatVertex>(vertices, vertexCount, [](const float* in, FloatVertex& out)
+		{
+			std::memcpy(&out, in, sizeof(out));
+		});
+	}
+}
@@ -0,0 +1,117 @@
+#ifndef VERTEX_FORMAT_CLASS_H
+#define VERTEX_FORMAT_CLASS_H
+
+#include<cstddef>
+#include<cstdint>
+#include<vector>
+#include<glad/glad.h>
+#include"VertexLayout.h"
+
+// * NOTE: the vertex shader doesn't care how an attribute is stored: glVertexAttribPointer tells GL the type, and
+// the vertex fetch turns it into floats on the way in for free. So a vertex buffer can be stored much smaller than
+// 32 bit floats, and a big mesh reads that much less memory every frame:
+//   GL_HALF_FLOAT                     16 bit floats, ~3 significant digits
+//   GL_UNSIGNED_SHORT, normalized     0..65535 -> 0..1. Positions become 0..1 inside the bounding box, and the
+//                                     shader scales them back (the "dequantization transform")
+//   GL_INT_2_10_10_10_REV, normalized three signed 10 bit values (+ 2 unused bits) in one 32 bit word -> -1..1,
+//                                     plenty for unit vectors: normals, tangents
+//   GL_UNSIGNED_INT_2_10_10_10_REV    the same unsigned, 0..1: positions in the bounding box at 1/1023 steps
+// Texture coordinates would go the unsigned short way (0..1 UVs at 1/65535 steps); the meshes here don't have any.
+//
+// Every format here holds position + normal. What's in the buffer: position * positionScale + positionOffset
+// (per axis) gives the position back, the normal is read as is
+
+// how MeshScene's vertices are stored in the vertex buffer
+enum class VertexFormat
+{
+	Float,       // 3 floats position + 3 floats normal: 24 bytes
+	Half,        // 3 half floats position (+ 2 bytes padding) + 2_10_10_10 normal: 12 bytes
+	Quantized16, // 3 unsigned shorts position in the bounding box (+ padding) + 2_10_10_10 normal: 12 bytes
+	Quantized10, // 2_10_10_10 position in the bounding box + 2_10_10_10 normal: 8 bytes
+	Auto         // per mesh: the smallest one whose position error is small next to the mesh's edges (never Half,
+	             // Quantized16 is as big and more precise for anything that isn't centered on the origin)
+};
+
+const char* VertexFormatName(VertexFormat format);
+
+// the vertex structs of the formats. The attribute calls come out of them (see VertexLayout.h), at locations
+// 0 (position) and 1 (normal)
+struct FloatVertex
+{
+	float position[3];
+	float normal[3];
+};
+struct HalfVertex
+{
+	HalfFloat position[3];
+	uint16_t padding; // so the normal's 32 bit word is aligned
+	PackedSigned1010102 normal;
+};
+struct Quantized16Vertex
+{
+	uint16_t position[3];
+	uint16_t padding;
+	PackedSigned1010102 normal;
+};
+struct Quantized10Vertex
+{
+	PackedUnsigned1010102 position; // the shader's vec3 just doesn't look at the 4th component
+	PackedSigned1010102 normal;
+};
+
+template<> struct VertexAttributes<FloatVertex>
+{
+	static constexpr VertexAttribute list[] = {
+		VERTEX_ATTRIBUTE(FloatVertex, position, 0, GL_FALSE),
+		VERTEX_ATTRIBUTE(FloatVertex, normal, 1, GL_FALSE) };
+};
+template<> struct VertexAttributes<HalfVertex>
+{
+	static constexpr VertexAttribute list[] = {
+		VERTEX_ATTRIBUTE(HalfVertex, position, 0, GL_FALSE),
+		VERTEX_ATTRIBUTE(HalfVertex, normal, 1, GL_TRUE) };
+};
+template<> struct VertexAttributes<Quantized16Vertex>
+{
+	static constexpr VertexAttribute list[] = {
+		VERTEX_ATTRIBUTE(Quantized16Vertex, position, 0, GL_TRUE),
+		VERTEX_ATTRIBUTE(Quantized16Vertex, normal, 1, GL_TRUE) };
+};
+template<> struct VertexAttributes<Quantized10Vertex>
+{
+	static constexpr VertexAttribute list[] = {
+		VERTEX_ATTRIBUTE(Quantized10Vertex, position, 0, GL_TRUE),
+		VERTEX_ATTRIBUTE(Quantized10Vertex, normal, 1, GL_TRUE) };
+};
+
+static_assert(sizeof(FloatVertex) == 24 && sizeof(HalfVertex) == 12 && sizeof(Quantized16Vertex) == 12 && sizeof(Quantized10Vertex) == 8,
+	"the vertex structs must stay packed");
+// what the float layout has always been (and the cache files and the soft rasterizer read): 6 floats, normal at 12
+static_assert(VertexLayoutOf<FloatVertex>::bindings[0].stride == 24 && VertexLayoutOf<FloatVertex>::attributes[0].offset == 0
+	&& VertexLayoutOf<FloatVertex>::attributes[1].offset == 12, "FloatVertex is position then normal, 3 floats each");
+
+// a format for one mesh: how to read its vertex buffer and how to get the positions back
+struct VertexEncoding
+{
+	VertexFormat format = VertexFormat::Float;
+	VertexLayout layout;
+	// attribute value -> position, per axis
+	float positionScale[3] = { 1.0f, 1.0f, 1.0f };
+	float positionOffset[3] = { 0.0f, 0.0f, 0.0f };
+};
+
+// the encoding of format for a mesh with these bounds (the quantized formats are relative to them). Not Auto
+VertexEncoding MakeVertexEncoding(VertexFormat format, const float* boundsMin, const float* boundsMax);
+
+// picks the format for VertexFormat::Auto from the mesh's bounds and edge lengths. vertices: position + normal
+// (6 floats each), indices = nullptr for a triangle list without an index buffer
+VertexFormat ChooseVertexFormat(const float* vertices, size_t vertexCount, const GLuint* indices, size_t indexCount,
+	const float* boundsMin, const float* boundsMax);
+
+// packs position + normal float vertices into the encoding's vertex struct, one after the other
+std::vector<unsigned char> EncodeVertices(const VertexEncoding& encoding, const float* vertices, size_t vertexCount);
+
+// the float -> half conversion the encoder uses, round to nearest even like the GPU's
+uint16_t FloatToHalf(float value);
+
+#endif
@@ -0,0 +1,241 @@
+#ifndef VERTEX_LAYOUT_CLASS_H
+#define VERTEX_LAYOUT_CLASS_H
+
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<iterator>
+#include<glad/glad.h>
+
+// * NOTE: instead of writing the glVertexAttribPointer calls by hand (and keeping the strides and offsets in sync
+// with the struct by hand), a vertex struct lists its members once and the compiler works out the rest:
+//
+//   struct MyVertex { float position[3]; uint8_t color[4]; };
+//   template<> struct VertexAttributes<MyVertex>
+//   {
+//       static constexpr VertexAttribute list[] = {
+//           VERTEX_ATTRIBUTE(MyVertex, position, 0, GL_FALSE),
+//           VERTEX_ATTRIBUTE(MyVertex, color, 1, GL_TRUE) };
+//   };
+//   VertexLayoutOf<MyVertex>::layout   // stride, offsets, types, components: all constants
+//
+// The member's C++ type picks the GL type and component count (float[3] -> 3 x GL_FLOAT), so changing the struct
+// changes the attributes with it. A layout can read from several buffers, one struct each:
+// VertexLayoutOf<PositionVertex, PerInstance<InstanceData>> is positions from buffer 0 and per-instance data from
+// buffer 1 (divisor 1). VAO::LinkLayout turns a layout into the GL calls, VertexArrayCache keeps the VAOs.
+//
+// ! only float attributes (glVertexAttribPointer): integer inputs (ivec, glVertexAttribIPointer) would need a flag
+
+// storage types GL reads that C++ doesn't have
+struct HalfFloat { uint16_t bits; };            // GL_HALF_FLOAT, see FloatToHalf in VertexFormat.h
+struct PackedSigned1010102 { uint32_t bits; };   // GL_INT_2_10_10_10_REV: x, y, z in 10 bits each + 2 bit w
+struct PackedUnsigned1010102 { uint32_t bits; }; // GL_UNSIGNED_INT_2_10_10_10_REV
+
+// what glVertexAttribPointer needs for a C++ type. A type without a specialization doesn't compile
+template<typename T> struct AttributeType;
+template<> struct AttributeType<float> { static constexpr GLint components = 1; static constexpr GLenum type = GL_FLOAT; };
+template<> struct AttributeType<HalfFloat> { static constexpr GLint components = 1; static constexpr GLenum type = GL_HALF_FLOAT; };
+template<> struct AttributeType<int8_t> { static constexpr GLint components = 1; static constexpr GLenum type = GL_BYTE; };
+template<> struct AttributeType<uint8_t> { static constexpr GLint components = 1; static constexpr GLenum type = GL_UNSIGNED_BYTE; };
+template<> struct AttributeType<int16_t> { static constexpr GLint components = 1; static constexpr GLenum type = GL_SHORT; };
+template<> struct AttributeType<uint16_t> { static constexpr GLint components = 1; static constexpr GLenum type = GL_UNSIGNED_SHORT; };
+// the packed types are always 4 components
+template<> struct AttributeType<PackedSigned1010102> { static constexpr GLint components = 4; static constexpr GLenum type = GL_INT_2_10_10_10_REV; };
+template<> struct AttributeType<PackedUnsigned1010102> { static constexpr GLint components = 4; static constexpr GLenum type = GL_UNSIGNED_INT_2_10_10_10_REV; };
+// arrays of a scalar: one component each
+template<typename T, size_t N> struct AttributeType<T[N]>
+{
+	static_assert(AttributeType<T>::components == 1, "arrays of packed types aren't an attribute");
+	static constexpr GLint components = (GLint)N;
+	static constexpr GLenum type = AttributeType<T>::type;
+};
+
+// one glVertexAttribPointer call
+struct VertexAttribute
+{
+	GLuint location = 0;
+	GLint components = 0;
+	GLenum type = 0;
+	GLboolean normalized = GL_FALSE;
+	// from the start of the vertex
+	GLuint offset = 0;
+	// which of the layout's buffers it reads from, filled in by VertexLayoutOf
+	GLuint binding = 0;
+};
+
+// one buffer of a layout
+struct VertexBinding
+{
+	GLsizei stride = 0;
+	// 0 = advance every vertex, 1 = every instance
+	GLuint divisor = 0;
+};
+
+// an attribute of type T at offset in the vertex, e.g. Attribute<float[4]>(1, 0) when a vec4 spans four float members
+template<typename T>
+constexpr VertexAttribute Attribute(GLuint location, size_t offset, GLboolean normalized = GL_FALSE)
+{
+	static_assert(AttributeType<T>::components >= 1 && AttributeType<T>::components <= 4, "an attribute has 1 to 4 components");
+	VertexAttribute attribute;
+	attribute.location = location;
+	attribute.components = AttributeType<T>::components;
+	attribute.type = AttributeType<T>::type;
+	attribute.normalized = normalized;
+	attribute.offset = (GLuint)offset;
+	return attribute;
+}
+
+// the attribute a struct member is, typed and placed by the member itself
+#define VERTEX_ATTRIBUTE(Vertex, member, location, normalized) \
+	Attribute<decltype(Vertex::member)>(location, offsetof(Vertex, member), normalized)
+
+// specialized for every vertex struct with a `static constexpr VertexAttribute list[]`, see the top
+template<typename Vertex> struct VertexAttributes;
+
+// marks a struct in VertexLayoutOf as per instance data (divisor 1)
+template<typename Vertex> struct PerInstance {};
+
+// a finished layout: plain pointers into the constant tables VertexLayoutOf makes, so it's cheap to pass around
+// and layouts of different sizes are the same type. Layouts with the same attributes and strides have the same key
+struct VertexLayout
+{
+	const VertexAttribute* attributes = nullptr;
+	uint32_t attributeCount = 0;
+	const VertexBinding* bindings = nullptr;
+	uint32_t bindingCount = 0;
+	uint64_t key = 0;
+
+	constexpr GLsizei Stride(uint32_t binding = 0) const { return binding < bindingCount ? bindings[binding].stride : 0; }
+};
+
+// the same attribute calls and strides, table by table. Two layouts with the same key almost always are, this
+// makes sure (VertexArrayCache handing out a VAO set up for another layout would draw garbage)
+inline bool SameLayout(const VertexLayout& a, const VertexLayout& b)
+{
+	if (a.key != b.key || a.attributeCount != b.attributeCount || a.bindingCount != b.bindingCount)
+		return false;
+	for (uint32_t i = 0; i < a.attributeCount; i++)
+	{
+		const VertexAttribute& x = a.attributes[i];
+		const VertexAttribute& y = b.attributes[i];
+		if (x.location != y.location || x.components != y.components || x.type != y.type || x.normalized != y.normalized
+			|| x.offset != y.offset || x.binding != y.binding)
+			return false;
+	}
+	for (uint32_t i = 0; i < a.bindingCount; i++)
+		if (a.bindings[i].stride != b.bindings[i].stride || a.bindings[i].divisor != b.bindings[i].divisor)
+			return false;
+	return true;
+}
+
+// FNV-1a over everything GL gets told, so two structs that end up with identical attribute calls share VAOs
+constexpr uint64_t VertexLayoutKey(const VertexAttribute* attributes, uint32_t attributeCount, const VertexBinding* bindings, uint32_t bindingCount)
+{
+	uint64_t hash = 14695981039346656037ull;
+	auto mix = [&hash](uint64_t value)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			hash ^= (value >> (8 * i)) & 0xff;
+			hash *= 1099511628211ull;
+		}
+	};
+	for (uint32_t i = 0; i < attributeCount; i++)
+	{
+		const VertexAttribute& a = attributes[i];
+		mix(a.location);
+		mix((uint64_t)a.components);
+		mix(a.type);
+		mix(a.normalized);
+		mix(a.offset);
+		mix(a.binding);
+	}
+	for (uint32_t i = 0; i < bindingCount; i++)
+	{
+		mix((uint64_t)bindings[i].stride);
+		mix(bindings[i].divisor);
+	}
+	return hash;
+}
+
+template<typename Vertex> struct LayoutBinding
+{
+	using Type = Vertex;
+	static constexpr GLuint divisor = 0;
+};
+template<typename Vertex> struct LayoutBinding<PerInstance<Vertex>>
+{
+	using Type = Vertex;
+	static constexpr GLuint divisor = 1;
+};
+
+template<typename... Bindings>
+constexpr size_t LayoutAttributeCount = (std::size(VertexAttributes<typename LayoutBinding<Bindings>::Type>::list) + ...);
+
+// every struct's attributes one after the other, each with its struct's buffer index
+template<typename... Bindings>
+constexpr std::array<VertexAttribute, LayoutAttributeCount<Bindings...>> ConcatenateAttributes()
+{
+	std::array<VertexAttribute, LayoutAttributeCount<Bindings...>> out = {};
+	size_t next = 0;
+	GLuint binding = 0;
+	auto append = [&](const auto& list)
+	{
+		for (VertexAttribute attribute : list)
+		{
+			attribute.binding = binding;
+			out[next++] = attribute;
+		}
+		binding++;
+	};
+	(append(VertexAttributes<typename LayoutBinding<Bindings>::Type>::list), ...);
+	return out;
+}
+
+// the buffers a layout reads from (one per binding, at a byte offset) and the element buffer, if any.
+// A VAO remembers all of them, so together with the layout they say which VAO it is
+struct VertexBuffers
+{
+	static const int MaxBindings = 4;
+
+	GLuint buffers[MaxBindings] = {};
+	GLintptr offsets[MaxBindings] = {};
+	GLuint elements = 0;
+
+	VertexBuffers() {}
+	// the common case: one vertex buffer, maybe indexed
+	VertexBuffers(GLuint buffer, GLuint elements = 0, GLintptr offset = 0) : elements(elements)
+	{
+		buffers[0] = buffer;
+		offsets[0] = offset;
+	}
+};
+
+// the layout of one vertex struct per buffer (PerInstance<T> for instance data). Everything is a constant:
+// nothing about it is worked out while the program runs
+template<typename... Bindings>
+struct VertexLayoutOf
+{
+	static_assert(sizeof...(Bindings) >= 1, "a layout reads from at least one buffer");
+	static_assert(sizeof...(Bindings) <= VertexBuffers::MaxBindings, "more buffers than VertexBuffers can hold");
+
+	static constexpr std::array<VertexAttribute, LayoutAttributeCount<Bindings...>> attributes = ConcatenateAttributes<Bindings...>();
+	static constexpr std::array<VertexBinding, sizeof...(Bindings)> bindings =
+		{ { { (GLsizei)sizeof(typename LayoutBinding<Bindings>::Type), LayoutBinding<Bindings>::divisor }... } };
+	static constexpr VertexLayout layout = { attributes.data(), (uint32_t)attributes.size(), bindings.data(), (uint32_t)bindings.size(),
+		VertexLayoutKey(attributes.data(), (uint32_t)attributes.size(), bindings.data(), (uint32_t)bindings.size()) };
+};
+
+// just a position at location 0, what the simple scenes draw
+struct PositionVertex
+{
+	float position[3];
+};
+template<> struct VertexAttributes<PositionVertex>
+{
+	static constexpr VertexAttribute list[] = { VERTEX_ATTRIBUTE(PositionVertex, position, 0, GL_FALSE) };
+};
+static_assert(VertexLayoutOf<PositionVertex>::bindings[0].stride == 12 && VertexLayoutOf<PositionVertex>::attributes[0].offset == 0
+	&& VertexLayoutOf<PositionVertex>::attributes[0].components == 3, "PositionVertex is 3 floats, tightly packed");
+
+#endif
@@ -7,21 +7,38 @@
     APIs: gl=3.3
     Profile: core
     Extensions:
-        
+        GL_ARB_buffer_storage
+        GL_ARB_get_program_binary
+        GL_KHR_parallel_shader_compile
     Loader: True
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_buffer_storage,GL_ARB_get_program_binary,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_get_program_binary&extensions=GL_KHR_parallel_shader_compile
 */
 
+#if defined(GLAD_INSTRUMENT) && defined(GLAD_MX)
+/* the trace shims replace the global pointers only, a GladGLContext's table is never wrapped and an MX
+ * build would print an empty trace */
+#error "GLAD_INSTRUMENT can't be combined with GLAD_MX: only the global function pointers are traced"
+#endif
+#if defined(GLAD_INSTRUMENT) && !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+/* clock_gettime for the call timers */
+#define _POSIX_C_SOURCE 199309L
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(GLAD_INSTRUMENT) && !defined(_WIN32)
+#include <time.h>
+#endif
+/* the loader itself always works on the global pointers, GLAD_MX only changes what the gl*
+ * macros mean for code using glad */
+#undef GLAD_MX
 #include <glad/glad.h>
 
 static void* get_proc(const char *namez);
@@ -156,6 +173,75 @@ int gladLoadGL(void) {
     return status;
 }
 
+/* Resident mode: libGL stays open after loading, and every address get_proc finds is
+ * remembered by name, so loading again (e.g. after recreating the context) is a table
+ * lookup per function instead of dlopen + a driver lookup per function + dlclose.
+ * glXGetProcAddress addresses don't depend on the context. wglGetProcAddress ones can
+ * (different driver/pixel format), so on Windows only reload for contexts of the same kind. */
+#define GLAD_PROC_CACHE_SIZE 1024 /* power of two, comfortably more than 2x the entry points */
+
+struct gladProcCacheEntry {
+    const char *name;
+    void *proc;
+};
+
+static struct gladProcCacheEntry proc_cache[GLAD_PROC_CACHE_SIZE];
+static int proc_cache_count = 0;
+static int proc_cache_hits = 0;
+static int proc_cache_misses = 0;
+
+static void* get_proc_cached(const char *namez) {
+    /* 32-bit FNV-1a of the name */
+    unsigned int hash = 2166136261u;
+    const char *c;
+    unsigned int slot;
+    void *proc;
+    for(c = namez; *c != '\0'; c++) {
+        hash ^= (unsigned char)*c;
+        hash *= 16777619u;
+    }
+
+    slot = hash & (GLAD_PROC_CACHE_SIZE - 1);
+    while(proc_cache[slot].name != NULL) {
+        if(strcmp(proc_cache[slot].name, namez) == 0) {
+            proc_cache_hits++;
+            return proc_cache[slot].proc;
+        }
+        slot = (slot + 1) & (GLAD_PROC_CACHE_SIZE - 1);
+    }
+
+    proc_cache_misses++;
+    proc = get_proc(namez);
+    /* the names glad asks for are string literals, the pointer can be kept as is.
+     * A full table just stops caching, lookups still work */
+    if(proc_cache_count < GLAD_PROC_CACHE_SIZE / 2) {
+        proc_cache[slot].name = namez;
+        proc_cache[slot].proc = proc;
+        proc_cache_count++;
+    }
+    return proc;
+}
+
+int gladLoadGLResident(void) {
+    if(libGL == NULL && !open_gl()) {
+        return 0;
+    }
+    return gladLoadGLLoader(&get_proc_cached);
+}
+
+void gladUnloadGL(void) {
+    memset(proc_cache, 0, sizeof(proc_cache));
+    proc_cache_count = 0;
+    proc_cache_hits = 0;
+    proc_cache_misses = 0;
+    close_gl();
+}
+
+void gladGetProcCacheStats(int *hits, int *misses) {
+    if(hits != NULL) *hits = proc_cache_hits;
+    if(misses != NULL) *misses = proc_cache_misses;
+}
+
 struct gladGLversionStruct GLVersion = { 0, 0 };
 
 #if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
@@ -165,96 +251,169 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+/* Extension names are parsed once into a single block: the names themselves (an arena,
+ * each name '\0' terminated) followed by an open addressing hash table of pointers into it.
+ * has_ext is then one hash + usually one strcmp, no matter how many extensions the
+ * driver advertises, and there's one block to free instead of one malloc per extension.
+ * The set is a struct so per-context loading (gladLoadGLContext) can parse its own. */
+struct gladExtensionSet {
+    char *block;
+    size_t used;
+    size_t capacity;
+    const char **table;
+    unsigned int mask;
+};
 
-static int get_exts(void) {
+static struct gladExtensionSet exts_global = { NULL, 0, 0, NULL, 0 };
+
+static unsigned int hash_ext(const char *ext, size_t len) {
+    /* 32-bit FNV-1a */
+    unsigned int hash = 2166136261u;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= (unsigned char)ext[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/* makes room for size more bytes at the end of the arena */
+static char *grow_exts(struct gladExtensionSet *set, size_t size) {
+    if(set->used + size > set->capacity) {
+        size_t capacity = set->capacity != 0 ? set->capacity : 8192;
+        char *block;
+        while(capacity < set->used + size) capacity *= 2;
+        block = (char *)realloc(set->block, capacity);
+        if(block == NULL) return NULL;
+        set->block = block;
+        set->capacity = capacity;
+    }
+    return set->block + set->used;
+}
+
+/* puts the table behind the count names in the arena. It's at least twice the count so
+ * probe chains stay short. Pointers are only taken now, the arena doesn't move anymore */
+static int build_exts_table(struct gladExtensionSet *set, unsigned int count) {
+    unsigned int size = 16;
+    size_t table_offset = (set->used + sizeof(char *) - 1) / sizeof(char *) * sizeof(char *);
+    const char *ext;
+    const char *arena_end;
+    while(size < count * 2) size *= 2;
+
+    if(grow_exts(set, table_offset - set->used + size * sizeof *set->table) == NULL) return 0;
+    arena_end = set->block + set->used;
+    set->table = (const char **)(set->block + table_offset);
+    set->mask = size - 1;
+    memset((void *)set->table, 0, size * sizeof *set->table);
+
+    for(ext = set->block; ext < arena_end; ext += strlen(ext) + 1) {
+        size_t len = strlen(ext);
+        unsigned int slot;
+        if(len == 0) continue;
+        slot = hash_ext(ext, len) & set->mask;
+        while(set->table[slot] != NULL && strcmp(set->table[slot], ext) != 0) {
+            slot = (slot + 1) & set->mask;
+        }
+        set->table[slot] = ext;
+    }
+    return 1;
+}
+
+/* the functions are passed by address: a lazy trampoline replaces itself on the first call,
+ * and the next calls should go straight to the real function */
+static int parse_exts(struct gladExtensionSet *set, int major, PFNGLGETSTRINGPROC *get_string,
+                      PFNGLGETINTEGERVPROC *get_integerv, PFNGLGETSTRINGIPROC *get_stringi) {
+    unsigned int count = 0;
+    set->used = 0;
 #ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
+    if(major < 3) {
+#else
+    (void)major; (void)get_integerv; (void)get_stringi;
 #endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
+        const char *exts = (const char *)(*get_string)(GL_EXTENSIONS);
+        char *arena;
+        char *p;
+        size_t len;
+        if(exts == NULL) return 0;
+
+        /* the names are space separated: copy the whole string and cut it at the spaces */
+        len = strlen(exts);
+        arena = grow_exts(set, len + 1);
+        if(arena == NULL) return 0;
+        memcpy(arena, exts, len + 1);
+        set->used = len + 1;
+        for(p = arena; *p != '\0'; p++) {
+            if(*p == ' ') *p = '\0';
+            else if(p == arena || p[-1] == '\0') count++;
+        }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         unsigned int index;
+        int num_exts_i = 0;
 
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
+        (*get_integerv)(GL_NUM_EXTENSIONS, &num_exts_i);
+        if(num_exts_i <= 0 || *get_stringi == NULL) {
             return 0;
         }
 
         for(index = 0; index < (unsigned)num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+            const char *gl_str_tmp = (const char*)(*get_stringi)(GL_EXTENSIONS, index);
+            size_t len;
+            char *local_str;
+            if(gl_str_tmp == NULL) continue;
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
+            len = strlen(gl_str_tmp);
+            local_str = grow_exts(set, len + 1);
+            if(local_str == NULL) {
+                return 0;
             }
-            exts_i[index] = local_str;
+            memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
+            set->used += len + 1;
+            count++;
         }
     }
 #endif
-    return 1;
+    return build_exts_table(set, count);
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
+static void free_ext_set(struct gladExtensionSet *set) {
+    if (set->block != NULL) {
+        free((void *)set->block);
+        set->block = NULL;
+        set->used = set->capacity = 0;
+        set->table = NULL;
+        set->mask = 0;
     }
 }
 
-static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+static int find_ext(const struct gladExtensionSet *set, const char *ext) {
+    unsigned int slot;
+    if(set->table == NULL || ext == NULL) {
+        return 0;
+    }
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
+    slot = hash_ext(ext, strlen(ext)) & set->mask;
+    while(set->table[slot] != NULL) {
+        if(strcmp(set->table[slot], ext) == 0) {
+            return 1;
         }
+        slot = (slot + 1) & set->mask;
     }
-#endif
 
     return 0;
 }
+
+static int get_exts(void) {
+    return parse_exts(&exts_global, max_loaded_major, &glad_glGetString, &glad_glGetIntegerv, &glad_glGetStringi);
+}
+
+static void free_exts(void) {
+    free_ext_set(&exts_global);
+}
+
+static int has_ext(const char *ext) {
+    return find_ext(&exts_global, ext);
+}
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -641,6 +800,14 @@ PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
 PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
 PFNGLVIEWPORTPROC glad_glViewport = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+int GLAD_GL_ARB_get_program_binary = 0;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
+int GLAD_GL_ARB_buffer_storage = 0;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1054,22 +1221,2071 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+#ifdef GLAD_INSTRUMENT
+/* Instrumented build: after loading, every global pointer is swapped for a shim that counts
+ * the call and the CPU time spent in the real function (glad_real_*). Counters are plain
+ * globals: only meant for one thread calling GL. */
+#if defined(_WIN32) || defined(__CYGWIN__)
+static unsigned long long glad_trace_now(void) {
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER now;
+    if(frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&now);
+    return (unsigned long long)((double)now.QuadPart * 1e9 / (double)frequency.QuadPart);
+}
+#else
+static unsigned long long glad_trace_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ull + (unsigned long long)now.tv_nsec;
+}
+#endif
+
+static struct GladTraceEntry glad_trace[] = {
+	{ "glCullFace", 0, 0 },
+	{ "glFrontFace", 0, 0 },
+	{ "glHint", 0, 0 },
+	{ "glLineWidth", 0, 0 },
+	{ "glPointSize", 0, 0 },
+	{ "glPolygonMode", 0, 0 },
+	{ "glScissor", 0, 0 },
+	{ "glTexParameterf", 0, 0 },
+	{ "glTexParameterfv", 0, 0 },
+	{ "glTexParameteri", 0, 0 },
+	{ "glTexParameteriv", 0, 0 },
+	{ "glTexImage1D", 0, 0 },
+	{ "glTexImage2D", 0, 0 },
+	{ "glDrawBuffer", 0, 0 },
+	{ "glClear", 0, 0 },
+	{ "glClearColor", 0, 0 },
+	{ "glClearStencil", 0, 0 },
+	{ "glClearDepth", 0, 0 },
+	{ "glStencilMask", 0, 0 },
+	{ "glColorMask", 0, 0 },
+	{ "glDepthMask", 0, 0 },
+	{ "glDisable", 0, 0 },
+	{ "glEnable", 0, 0 },
+	{ "glFinish", 0, 0 },
+	{ "glFlush", 0, 0 },
+	{ "glBlendFunc", 0, 0 },
+	{ "glLogicOp", 0, 0 },
+	{ "glStencilFunc", 0, 0 },
+	{ "glStencilOp", 0, 0 },
+	{ "glDepthFunc", 0, 0 },
+	{ "glPixelStoref", 0, 0 },
+	{ "glPixelStorei", 0, 0 },
+	{ "glReadBuffer", 0, 0 },
+	{ "glReadPixels", 0, 0 },
+	{ "glGetBooleanv", 0, 0 },
+	{ "glGetDoublev", 0, 0 },
+	{ "glGetError", 0, 0 },
+	{ "glGetFloatv", 0, 0 },
+	{ "glGetIntegerv", 0, 0 },
+	{ "glGetString", 0, 0 },
+	{ "glGetTexImage", 0, 0 },
+	{ "glGetTexParameterfv", 0, 0 },
+	{ "glGetTexParameteriv", 0, 0 },
+	{ "glGetTexLevelParameterfv", 0, 0 },
+	{ "glGetTexLevelParameteriv", 0, 0 },
+	{ "glIsEnabled", 0, 0 },
+	{ "glDepthRange", 0, 0 },
+	{ "glViewport", 0, 0 },
+	{ "glDrawArrays", 0, 0 },
+	{ "glDrawElements", 0, 0 },
+	{ "glPolygonOffset", 0, 0 },
+	{ "glCopyTexImage1D", 0, 0 },
+	{ "glCopyTexImage2D", 0, 0 },
+	{ "glCopyTexSubImage1D", 0, 0 },
+	{ "glCopyTexSubImage2D", 0, 0 },
+	{ "glTexSubImage1D", 0, 0 },
+	{ "glTexSubImage2D", 0, 0 },
+	{ "glBindTexture", 0, 0 },
+	{ "glDeleteTextures", 0, 0 },
+	{ "glGenTextures", 0, 0 },
+	{ "glIsTexture", 0, 0 },
+	{ "glDrawRangeElements", 0, 0 },
+	{ "glTexImage3D", 0, 0 },
+	{ "glTexSubImage3D", 0, 0 },
+	{ "glCopyTexSubImage3D", 0, 0 },
+	{ "glActiveTexture", 0, 0 },
+	{ "glSampleCoverage", 0, 0 },
+	{ "glCompressedTexImage3D", 0, 0 },
+	{ "glCompressedTexImage2D", 0, 0 },
+	{ "glCompressedTexImage1D", 0, 0 },
+	{ "glCompressedTexSubImage3D", 0, 0 },
+	{ "glCompressedTexSubImage2D", 0, 0 },
+	{ "glCompressedTexSubImage1D", 0, 0 },
+	{ "glGetCompressedTexImage", 0, 0 },
+	{ "glBlendFuncSeparate", 0, 0 },
+	{ "glMultiDrawArrays", 0, 0 },
+	{ "glMultiDrawElements", 0, 0 },
+	{ "glPointParameterf", 0, 0 },
+	{ "glPointParameterfv", 0, 0 },
+	{ "glPointParameteri", 0, 0 },
+	{ "glPointParameteriv", 0, 0 },
+	{ "glBlendColor", 0, 0 },
+	{ "glBlendEquation", 0, 0 },
+	{ "glGenQueries", 0, 0 },
+	{ "glDeleteQueries", 0, 0 },
+	{ "glIsQuery", 0, 0 },
+	{ "glBeginQuery", 0, 0 },
+	{ "glEndQuery", 0, 0 },
+	{ "glGetQueryiv", 0, 0 },
+	{ "glGetQueryObjectiv", 0, 0 },
+	{ "glGetQueryObjectuiv", 0, 0 },
+	{ "glBindBuffer", 0, 0 },
+	{ "glDeleteBuffers", 0, 0 },
+	{ "glGenBuffers", 0, 0 },
+	{ "glIsBuffer", 0, 0 },
+	{ "glBufferData", 0, 0 },
+	{ "glBufferSubData", 0, 0 },
+	{ "glGetBufferSubData", 0, 0 },
+	{ "glMapBuffer", 0, 0 },
+	{ "glUnmapBuffer", 0, 0 },
+	{ "glGetBufferParameteriv", 0, 0 },
+	{ "glGetBufferPointerv", 0, 0 },
+	{ "glBlendEquationSeparate", 0, 0 },
+	{ "glDrawBuffers", 0, 0 },
+	{ "glStencilOpSeparate", 0, 0 },
+	{ "glStencilFuncSeparate", 0, 0 },
+	{ "glStencilMaskSeparate", 0, 0 },
+	{ "glAttachShader", 0, 0 },
+	{ "glBindAttribLocation", 0, 0 },
+	{ "glCompileShader", 0, 0 },
+	{ "glCreateProgram", 0, 0 },
+	{ "glCreateShader", 0, 0 },
+	{ "glDeleteProgram", 0, 0 },
+	{ "glDeleteShader", 0, 0 },
+	{ "glDetachShader", 0, 0 },
+	{ "glDisableVertexAttribArray", 0, 0 },
+	{ "glEnableVertexAttribArray", 0, 0 },
+	{ "glGetActiveAttrib", 0, 0 },
+	{ "glGetActiveUniform", 0, 0 },
+	{ "glGetAttachedShaders", 0, 0 },
+	{ "glGetAttribLocation", 0, 0 },
+	{ "glGetProgramiv", 0, 0 },
+	{ "glGetProgramInfoLog", 0, 0 },
+	{ "glGetShaderiv", 0, 0 },
+	{ "glGetShaderInfoLog", 0, 0 },
+	{ "glGetShaderSource", 0, 0 },
+	{ "glGetUniformLocation", 0, 0 },
+	{ "glGetUniformfv", 0, 0 },
+	{ "glGetUniformiv", 0, 0 },
+	{ "glGetVertexAttribdv", 0, 0 },
+	{ "glGetVertexAttribfv", 0, 0 },
+	{ "glGetVertexAttribiv", 0, 0 },
+	{ "glGetVertexAttribPointerv", 0, 0 },
+	{ "glIsProgram", 0, 0 },
+	{ "glIsShader", 0, 0 },
+	{ "glLinkProgram", 0, 0 },
+	{ "glShaderSource", 0, 0 },
+	{ "glUseProgram", 0, 0 },
+	{ "glUniform1f", 0, 0 },
+	{ "glUniform2f", 0, 0 },
+	{ "glUniform3f", 0, 0 },
+	{ "glUniform4f", 0, 0 },
+	{ "glUniform1i", 0, 0 },
+	{ "glUniform2i", 0, 0 },
+	{ "glUniform3i", 0, 0 },
+	{ "glUniform4i", 0, 0 },
+	{ "glUniform1fv", 0, 0 },
+	{ "glUniform2fv", 0, 0 },
+	{ "glUniform3fv", 0, 0 },
+	{ "glUniform4fv", 0, 0 },
+	{ "glUniform1iv", 0, 0 },
+	{ "glUniform2iv", 0, 0 },
+	{ "glUniform3iv", 0, 0 },
+	{ "glUniform4iv", 0, 0 },
+	{ "glUniformMatrix2fv", 0, 0 },
+	{ "glUniformMatrix3fv", 0, 0 },
+	{ "glUniformMatrix4fv", 0, 0 },
+	{ "glValidateProgram", 0, 0 },
+	{ "glVertexAttrib1d", 0, 0 },
+	{ "glVertexAttrib1dv", 0, 0 },
+	{ "glVertexAttrib1f", 0, 0 },
+	{ "glVertexAttrib1fv", 0, 0 },
+	{ "glVertexAttrib1s", 0, 0 },
+	{ "glVertexAttrib1sv", 0, 0 },
+	{ "glVertexAttrib2d", 0, 0 },
+	{ "glVertexAttrib2dv", 0, 0 },
+	{ "glVertexAttrib2f", 0, 0 },
+	{ "glVertexAttrib2fv", 0, 0 },
+	{ "glVertexAttrib2s", 0, 0 },
+	{ "glVertexAttrib2sv", 0, 0 },
+	{ "glVertexAttrib3d", 0, 0 },
+	{ "glVertexAttrib3dv", 0, 0 },
+	{ "glVertexAttrib3f", 0, 0 },
+	{ "glVertexAttrib3fv", 0, 0 },
+	{ "glVertexAttrib3s", 0, 0 },
+	{ "glVertexAttrib3sv", 0, 0 },
+	{ "glVertexAttrib4Nbv", 0, 0 },
+	{ "glVertexAttrib4Niv", 0, 0 },
+	{ "glVertexAttrib4Nsv", 0, 0 },
+	{ "glVertexAttrib4Nub", 0, 0 },
+	{ "glVertexAttrib4Nubv", 0, 0 },
+	{ "glVertexAttrib4Nuiv", 0, 0 },
+	{ "glVertexAttrib4Nusv", 0, 0 },
+	{ "glVertexAttrib4bv", 0, 0 },
+	{ "glVertexAttrib4d", 0, 0 },
+	{ "glVertexAttrib4dv", 0, 0 },
+	{ "glVertexAttrib4f", 0, 0 },
+	{ "glVertexAttrib4fv", 0, 0 },
+	{ "glVertexAttrib4iv", 0, 0 },
+	{ "glVertexAttrib4s", 0, 0 },
+	{ "glVertexAttrib4sv", 0, 0 },
+	{ "glVertexAttrib4ubv", 0, 0 },
+	{ "glVertexAttrib4uiv", 0, 0 },
+	{ "glVertexAttrib4usv", 0, 0 },
+	{ "glVertexAttribPointer", 0, 0 },
+	{ "glUniformMatrix2x3fv", 0, 0 },
+	{ "glUniformMatrix3x2fv", 0, 0 },
+	{ "glUniformMatrix2x4fv", 0, 0 },
+	{ "glUniformMatrix4x2fv", 0, 0 },
+	{ "glUniformMatrix3x4fv", 0, 0 },
+	{ "glUniformMatrix4x3fv", 0, 0 },
+	{ "glColorMaski", 0, 0 },
+	{ "glGetBooleani_v", 0, 0 },
+	{ "glGetIntegeri_v", 0, 0 },
+	{ "glEnablei", 0, 0 },
+	{ "glDisablei", 0, 0 },
+	{ "glIsEnabledi", 0, 0 },
+	{ "glBeginTransformFeedback", 0, 0 },
+	{ "glEndTransformFeedback", 0, 0 },
+	{ "glBindBufferRange", 0, 0 },
+	{ "glBindBufferBase", 0, 0 },
+	{ "glTransformFeedbackVaryings", 0, 0 },
+	{ "glGetTransformFeedbackVarying", 0, 0 },
+	{ "glClampColor", 0, 0 },
+	{ "glBeginConditionalRender", 0, 0 },
+	{ "glEndConditionalRender", 0, 0 },
+	{ "glVertexAttribIPointer", 0, 0 },
+	{ "glGetVertexAttribIiv", 0, 0 },
+	{ "glGetVertexAttribIuiv", 0, 0 },
+	{ "glVertexAttribI1i", 0, 0 },
+	{ "glVertexAttribI2i", 0, 0 },
+	{ "glVertexAttribI3i", 0, 0 },
+	{ "glVertexAttribI4i", 0, 0 },
+	{ "glVertexAttribI1ui", 0, 0 },
+	{ "glVertexAttribI2ui", 0, 0 },
+	{ "glVertexAttribI3ui", 0, 0 },
+	{ "glVertexAttribI4ui", 0, 0 },
+	{ "glVertexAttribI1iv", 0, 0 },
+	{ "glVertexAttribI2iv", 0, 0 },
+	{ "glVertexAttribI3iv", 0, 0 },
+	{ "glVertexAttribI4iv", 0, 0 },
+	{ "glVertexAttribI1uiv", 0, 0 },
+	{ "glVertexAttribI2uiv", 0, 0 },
+	{ "glVertexAttribI3uiv", 0, 0 },
+	{ "glVertexAttribI4uiv", 0, 0 },
+	{ "glVertexAttribI4bv", 0, 0 },
+	{ "glVertexAttribI4sv", 0, 0 },
+	{ "glVertexAttribI4ubv", 0, 0 },
+	{ "glVertexAttribI4usv", 0, 0 },
+	{ "glGetUniformuiv", 0, 0 },
+	{ "glBindFragDataLocation", 0, 0 },
+	{ "glGetFragDataLocation", 0, 0 },
+	{ "glUniform1ui", 0, 0 },
+	{ "glUniform2ui", 0, 0 },
+	{ "glUniform3ui", 0, 0 },
+	{ "glUniform4ui", 0, 0 },
+	{ "glUniform1uiv", 0, 0 },
+	{ "glUniform2uiv", 0, 0 },
+	{ "glUniform3uiv", 0, 0 },
+	{ "glUniform4uiv", 0, 0 },
+	{ "glTexParameterIiv", 0, 0 },
+	{ "glTexParameterIuiv", 0, 0 },
+	{ "glGetTexParameterIiv", 0, 0 },
+	{ "glGetTexParameterIuiv", 0, 0 },
+	{ "glClearBufferiv", 0, 0 },
+	{ "glClearBufferuiv", 0, 0 },
+	{ "glClearBufferfv", 0, 0 },
+	{ "glClearBufferfi", 0, 0 },
+	{ "glGetStringi", 0, 0 },
+	{ "glIsRenderbuffer", 0, 0 },
+	{ "glBindRenderbuffer", 0, 0 },
+	{ "glDeleteRenderbuffers", 0, 0 },
+	{ "glGenRenderbuffers", 0, 0 },
+	{ "glRenderbufferStorage", 0, 0 },
+	{ "glGetRenderbufferParameteriv", 0, 0 },
+	{ "glIsFramebuffer", 0, 0 },
+	{ "glBindFramebuffer", 0, 0 },
+	{ "glDeleteFramebuffers", 0, 0 },
+	{ "glGenFramebuffers", 0, 0 },
+	{ "glCheckFramebufferStatus", 0, 0 },
+	{ "glFramebufferTexture1D", 0, 0 },
+	{ "glFramebufferTexture2D", 0, 0 },
+	{ "glFramebufferTexture3D", 0, 0 },
+	{ "glFramebufferRenderbuffer", 0, 0 },
+	{ "glGetFramebufferAttachmentParameteriv", 0, 0 },
+	{ "glGenerateMipmap", 0, 0 },
+	{ "glBlitFramebuffer", 0, 0 },
+	{ "glRenderbufferStorageMultisample", 0, 0 },
+	{ "glFramebufferTextureLayer", 0, 0 },
+	{ "glMapBufferRange", 0, 0 },
+	{ "glFlushMappedBufferRange", 0, 0 },
+	{ "glBindVertexArray", 0, 0 },
+	{ "glDeleteVertexArrays", 0, 0 },
+	{ "glGenVertexArrays", 0, 0 },
+	{ "glIsVertexArray", 0, 0 },
+	{ "glDrawArraysInstanced", 0, 0 },
+	{ "glDrawElementsInstanced", 0, 0 },
+	{ "glTexBuffer", 0, 0 },
+	{ "glPrimitiveRestartIndex", 0, 0 },
+	{ "glCopyBufferSubData", 0, 0 },
+	{ "glGetUniformIndices", 0, 0 },
+	{ "glGetActiveUniformsiv", 0, 0 },
+	{ "glGetActiveUniformName", 0, 0 },
+	{ "glGetUniformBlockIndex", 0, 0 },
+	{ "glGetActiveUniformBlockiv", 0, 0 },
+	{ "glGetActiveUniformBlockName", 0, 0 },
+	{ "glUniformBlockBinding", 0, 0 },
+	{ "glDrawElementsBaseVertex", 0, 0 },
+	{ "glDrawRangeElementsBaseVertex", 0, 0 },
+	{ "glDrawElementsInstancedBaseVertex", 0, 0 },
+	{ "glMultiDrawElementsBaseVertex", 0, 0 },
+	{ "glProvokingVertex", 0, 0 },
+	{ "glFenceSync", 0, 0 },
+	{ "glIsSync", 0, 0 },
+	{ "glDeleteSync", 0, 0 },
+	{ "glClientWaitSync", 0, 0 },
+	{ "glWaitSync", 0, 0 },
+	{ "glGetInteger64v", 0, 0 },
+	{ "glGetSynciv", 0, 0 },
+	{ "glGetInteger64i_v", 0, 0 },
+	{ "glGetBufferParameteri64v", 0, 0 },
+	{ "glFramebufferTexture", 0, 0 },
+	{ "glTexImage2DMultisample", 0, 0 },
+	{ "glTexImage3DMultisample", 0, 0 },
+	{ "glGetMultisamplefv", 0, 0 },
+	{ "glSampleMaski", 0, 0 },
+	{ "glBindFragDataLocationIndexed", 0, 0 },
+	{ "glGetFragDataIndex", 0, 0 },
+	{ "glGenSamplers", 0, 0 },
+	{ "glDeleteSamplers", 0, 0 },
+	{ "glIsSampler", 0, 0 },
+	{ "glBindSampler", 0, 0 },
+	{ "glSamplerParameteri", 0, 0 },
+	{ "glSamplerParameteriv", 0, 0 },
+	{ "glSamplerParameterf", 0, 0 },
+	{ "glSamplerParameterfv", 0, 0 },
+	{ "glSamplerParameterIiv", 0, 0 },
+	{ "glSamplerParameterIuiv", 0, 0 },
+	{ "glGetSamplerParameteriv", 0, 0 },
+	{ "glGetSamplerParameterIiv", 0, 0 },
+	{ "glGetSamplerParameterfv", 0, 0 },
+	{ "glGetSamplerParameterIuiv", 0, 0 },
+	{ "glQueryCounter", 0, 0 },
+	{ "glGetQueryObjecti64v", 0, 0 },
+	{ "glGetQueryObjectui64v", 0, 0 },
+	{ "glVertexAttribDivisor", 0, 0 },
+	{ "glVertexAttribP1ui", 0, 0 },
+	{ "glVertexAttribP1uiv", 0, 0 },
+	{ "glVertexAttribP2ui", 0, 0 },
+	{ "glVertexAttribP2uiv", 0, 0 },
+	{ "glVertexAttribP3ui", 0, 0 },
+	{ "glVertexAttribP3uiv", 0, 0 },
+	{ "glVertexAttribP4ui", 0, 0 },
+	{ "glVertexAttribP4uiv", 0, 0 },
+	{ "glVertexP2ui", 0, 0 },
+	{ "glVertexP2uiv", 0, 0 },
+	{ "glVertexP3ui", 0, 0 },
+	{ "glVertexP3uiv", 0, 0 },
+	{ "glVertexP4ui", 0, 0 },
+	{ "glVertexP4uiv", 0, 0 },
+	{ "glTexCoordP1ui", 0, 0 },
+	{ "glTexCoordP1uiv", 0, 0 },
+	{ "glTexCoordP2ui", 0, 0 },
+	{ "glTexCoordP2uiv", 0, 0 },
+	{ "glTexCoordP3ui", 0, 0 },
+	{ "glTexCoordP3uiv", 0, 0 },
+	{ "glTexCoordP4ui", 0, 0 },
+	{ "glTexCoordP4uiv", 0, 0 },
+	{ "glMultiTexCoordP1ui", 0, 0 },
+	{ "glMultiTexCoordP1uiv", 0, 0 },
+	{ "glMultiTexCoordP2ui", 0, 0 },
+	{ "glMultiTexCoordP2uiv", 0, 0 },
+	{ "glMultiTexCoordP3ui", 0, 0 },
+	{ "glMultiTexCoordP3uiv", 0, 0 },
+	{ "glMultiTexCoordP4ui", 0, 0 },
+	{ "glMultiTexCoordP4uiv", 0, 0 },
+	{ "glNormalP3ui", 0, 0 },
+	{ "glNormalP3uiv", 0, 0 },
+	{ "glColorP3ui", 0, 0 },
+	{ "glColorP3uiv", 0, 0 },
+	{ "glColorP4ui", 0, 0 },
+	{ "glColorP4uiv", 0, 0 },
+	{ "glSecondaryColorP3ui", 0, 0 },
+	{ "glSecondaryColorP3uiv", 0, 0 },
+	{ "glGetProgramBinary", 0, 0 },
+	{ "glProgramBinary", 0, 0 },
+	{ "glProgramParameteri", 0, 0 },
+	{ "glMaxShaderCompilerThreadsKHR", 0, 0 },
+	{ "glBufferStorage", 0, 0 },
+};
+
+#define GLAD_TRACE_VOID(index, name, pfn, params, args) \
+	static pfn glad_real_##name; \
+	static void APIENTRY glad_trace_##name params { \
+		unsigned long long glad_start = glad_trace_now(); \
+		glad_real_##name args; \
+		glad_trace[index].calls++; \
+		glad_trace[index].nanoseconds += glad_trace_now() - glad_start; \
+	}
+#define GLAD_TRACE_RETURN(index, ret, name, pfn, params, args) \
+	static pfn glad_real_##name; \
+	static ret APIENTRY glad_trace_##name params { \
+		unsigned long long glad_start = glad_trace_now(); \
+		ret glad_result = glad_real_##name args; \
+		glad_trace[index].calls++; \
+		glad_trace[index].nanoseconds += glad_trace_now() - glad_start; \
+		return glad_result; \
+	}
+GLAD_TRACE_VOID(0, glCullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode))
+GLAD_TRACE_VOID(1, glFrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode))
+GLAD_TRACE_VOID(2, glHint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode))
+GLAD_TRACE_VOID(3, glLineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width))
+GLAD_TRACE_VOID(4, glPointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size))
+GLAD_TRACE_VOID(5, glPolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_TRACE_VOID(6, glScissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_TRACE_VOID(7, glTexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_TRACE_VOID(8, glTexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_TRACE_VOID(9, glTexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_TRACE_VOID(10, glTexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_TRACE_VOID(11, glTexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GLAD_TRACE_VOID(12, glTexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_TRACE_VOID(13, glDrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf))
+GLAD_TRACE_VOID(14, glClear, PFNGLCLEARPROC, (GLbitfield mask), (mask))
+GLAD_TRACE_VOID(15, glClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_TRACE_VOID(16, glClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s))
+GLAD_TRACE_VOID(17, glClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth))
+GLAD_TRACE_VOID(18, glStencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask))
+GLAD_TRACE_VOID(19, glColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_TRACE_VOID(20, glDepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag))
+GLAD_TRACE_VOID(21, glDisable, PFNGLDISABLEPROC, (GLenum cap), (cap))
+GLAD_TRACE_VOID(22, glEnable, PFNGLENABLEPROC, (GLenum cap), (cap))
+GLAD_TRACE_VOID(23, glFinish, PFNGLFINISHPROC, (void), ())
+GLAD_TRACE_VOID(24, glFlush, PFNGLFLUSHPROC, (void), ())
+GLAD_TRACE_VOID(25, glBlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GLAD_TRACE_VOID(26, glLogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode))
+GLAD_TRACE_VOID(27, glStencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_TRACE_VOID(28, glStencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GLAD_TRACE_VOID(29, glDepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func))
+GLAD_TRACE_VOID(30, glPixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_TRACE_VOID(31, glPixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_TRACE_VOID(32, glReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src))
+GLAD_TRACE_VOID(33, glReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GLAD_TRACE_VOID(34, glGetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data))
+GLAD_TRACE_VOID(35, glGetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data))
+GLAD_TRACE_RETURN(36, GLenum, glGetError, PFNGLGETERRORPROC, (void), ())
+GLAD_TRACE_VOID(37, glGetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data))
+GLAD_TRACE_VOID(38, glGetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data))
+GLAD_TRACE_RETURN(39, const GLubyte *, glGetString, PFNGLGETSTRINGPROC, (GLenum name), (name))
+GLAD_TRACE_VOID(40, glGetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GLAD_TRACE_VOID(41, glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_TRACE_VOID(42, glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_TRACE_VOID(43, glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GLAD_TRACE_VOID(44, glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GLAD_TRACE_RETURN(45, GLboolean, glIsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap))
+GLAD_TRACE_VOID(46, glDepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f))
+GLAD_TRACE_VOID(47, glViewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_TRACE_VOID(48, glDrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_TRACE_VOID(49, glDrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GLAD_TRACE_VOID(50, glPolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_TRACE_VOID(51, glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_TRACE_VOID(52, glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_TRACE_VOID(53, glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_TRACE_VOID(54, glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_TRACE_VOID(55, glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_TRACE_VOID(56, glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_TRACE_VOID(57, glBindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture))
+GLAD_TRACE_VOID(58, glDeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_TRACE_VOID(59, glGenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_TRACE_RETURN(60, GLboolean, glIsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture))
+GLAD_TRACE_VOID(61, glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_TRACE_VOID(62, glTexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_TRACE_VOID(63, glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_TRACE_VOID(64, glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_TRACE_VOID(65, glActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture))
+GLAD_TRACE_VOID(66, glSampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_TRACE_VOID(67, glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_TRACE_VOID(68, glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_TRACE_VOID(69, glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_TRACE_VOID(70, glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_TRACE_VOID(71, glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_TRACE_VOID(72, glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_TRACE_VOID(73, glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_TRACE_VOID(74, glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_TRACE_VOID(75, glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GLAD_TRACE_VOID(76, glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GLAD_TRACE_VOID(77, glPointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_TRACE_VOID(78, glPointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_TRACE_VOID(79, glPointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_TRACE_VOID(80, glPointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_TRACE_VOID(81, glBlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_TRACE_VOID(82, glBlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode))
+GLAD_TRACE_VOID(83, glGenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_TRACE_VOID(84, glDeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_TRACE_RETURN(85, GLboolean, glIsQuery, PFNGLISQUERYPROC, (GLuint id), (id))
+GLAD_TRACE_VOID(86, glBeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id))
+GLAD_TRACE_VOID(87, glEndQuery, PFNGLENDQUERYPROC, (GLenum target), (target))
+GLAD_TRACE_VOID(88, glGetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_TRACE_VOID(89, glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_TRACE_VOID(90, glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_TRACE_VOID(91, glBindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_TRACE_VOID(92, glDeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_TRACE_VOID(93, glGenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_TRACE_RETURN(94, GLboolean, glIsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_TRACE_VOID(95, glBufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_TRACE_VOID(96, glBufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GLAD_TRACE_VOID(97, glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GLAD_TRACE_RETURN(98, void *, glMapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access))
+GLAD_TRACE_RETURN(99, GLboolean, glUnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target))
+GLAD_TRACE_VOID(100, glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_TRACE_VOID(101, glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_TRACE_VOID(102, glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_TRACE_VOID(103, glDrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_TRACE_VOID(104, glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_TRACE_VOID(105, glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GLAD_TRACE_VOID(106, glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask))
+GLAD_TRACE_VOID(107, glAttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_TRACE_VOID(108, glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GLAD_TRACE_VOID(109, glCompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader))
+GLAD_TRACE_RETURN(110, GLuint, glCreateProgram, PFNGLCREATEPROGRAMPROC, (void), ())
+GLAD_TRACE_RETURN(111, GLuint, glCreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type))
+GLAD_TRACE_VOID(112, glDeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program))
+GLAD_TRACE_VOID(113, glDeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader))
+GLAD_TRACE_VOID(114, glDetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_TRACE_VOID(115, glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_TRACE_VOID(116, glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_TRACE_VOID(117, glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_TRACE_VOID(118, glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_TRACE_VOID(119, glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GLAD_TRACE_RETURN(120, GLint, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_TRACE_VOID(121, glGetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GLAD_TRACE_VOID(122, glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GLAD_TRACE_VOID(123, glGetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GLAD_TRACE_VOID(124, glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GLAD_TRACE_VOID(125, glGetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GLAD_TRACE_RETURN(126, GLint, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_TRACE_VOID(127, glGetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GLAD_TRACE_VOID(128, glGetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params))
+GLAD_TRACE_VOID(129, glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_TRACE_VOID(130, glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_TRACE_VOID(131, glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_TRACE_VOID(132, glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_TRACE_RETURN(133, GLboolean, glIsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program))
+GLAD_TRACE_RETURN(134, GLboolean, glIsShader, PFNGLISSHADERPROC, (GLuint shader), (shader))
+GLAD_TRACE_VOID(135, glLinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program))
+GLAD_TRACE_VOID(136, glShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GLAD_TRACE_VOID(137, glUseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program))
+GLAD_TRACE_VOID(138, glUniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0))
+GLAD_TRACE_VOID(139, glUniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_TRACE_VOID(140, glUniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_TRACE_VOID(141, glUniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_TRACE_VOID(142, glUniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0))
+GLAD_TRACE_VOID(143, glUniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_TRACE_VOID(144, glUniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_TRACE_VOID(145, glUniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_TRACE_VOID(146, glUniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_TRACE_VOID(147, glUniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_TRACE_VOID(148, glUniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_TRACE_VOID(149, glUniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_TRACE_VOID(150, glUniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_TRACE_VOID(151, glUniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_TRACE_VOID(152, glUniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_TRACE_VOID(153, glUniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_TRACE_VOID(154, glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(155, glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(156, glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(157, glValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program))
+GLAD_TRACE_VOID(158, glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_TRACE_VOID(159, glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_TRACE_VOID(160, glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_TRACE_VOID(161, glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_TRACE_VOID(162, glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x))
+GLAD_TRACE_VOID(163, glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_TRACE_VOID(164, glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_TRACE_VOID(165, glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_TRACE_VOID(166, glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_TRACE_VOID(167, glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_TRACE_VOID(168, glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_TRACE_VOID(169, glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_TRACE_VOID(170, glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_TRACE_VOID(171, glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_TRACE_VOID(172, glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_TRACE_VOID(173, glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_TRACE_VOID(174, glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_TRACE_VOID(175, glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_TRACE_VOID(176, glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_TRACE_VOID(177, glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_TRACE_VOID(178, glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_TRACE_VOID(179, glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_TRACE_VOID(180, glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_TRACE_VOID(181, glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_TRACE_VOID(182, glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_TRACE_VOID(183, glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_TRACE_VOID(184, glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_TRACE_VOID(185, glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_TRACE_VOID(186, glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_TRACE_VOID(187, glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_TRACE_VOID(188, glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_TRACE_VOID(189, glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_TRACE_VOID(190, glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_TRACE_VOID(191, glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_TRACE_VOID(192, glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_TRACE_VOID(193, glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_TRACE_VOID(194, glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_TRACE_VOID(195, glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(196, glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(197, glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(198, glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(199, glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(200, glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_TRACE_VOID(201, glColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_TRACE_VOID(202, glGetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_TRACE_VOID(203, glGetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_TRACE_VOID(204, glEnablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_TRACE_VOID(205, glDisablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_TRACE_RETURN(206, GLboolean, glIsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_TRACE_VOID(207, glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode))
+GLAD_TRACE_VOID(208, glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), ())
+GLAD_TRACE_VOID(209, glBindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_TRACE_VOID(210, glBindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_TRACE_VOID(211, glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_TRACE_VOID(212, glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_TRACE_VOID(213, glClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_TRACE_VOID(214, glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode))
+GLAD_TRACE_VOID(215, glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), ())
+GLAD_TRACE_VOID(216, glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_TRACE_VOID(217, glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_TRACE_VOID(218, glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_TRACE_VOID(219, glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x))
+GLAD_TRACE_VOID(220, glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_TRACE_VOID(221, glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_TRACE_VOID(222, glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_TRACE_VOID(223, glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x))
+GLAD_TRACE_VOID(224, glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_TRACE_VOID(225, glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_TRACE_VOID(226, glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_TRACE_VOID(227, glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_TRACE_VOID(228, glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_TRACE_VOID(229, glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_TRACE_VOID(230, glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_TRACE_VOID(231, glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_TRACE_VOID(232, glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_TRACE_VOID(233, glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_TRACE_VOID(234, glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_TRACE_VOID(235, glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_TRACE_VOID(236, glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_TRACE_VOID(237, glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_TRACE_VOID(238, glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_TRACE_VOID(239, glGetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_TRACE_VOID(240, glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_TRACE_RETURN(241, GLint, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_TRACE_VOID(242, glUniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0))
+GLAD_TRACE_VOID(243, glUniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_TRACE_VOID(244, glUniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_TRACE_VOID(245, glUniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_TRACE_VOID(246, glUniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_TRACE_VOID(247, glUniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_TRACE_VOID(248, glUniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_TRACE_VOID(249, glUniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_TRACE_VOID(250, glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_TRACE_VOID(251, glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_TRACE_VOID(252, glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_TRACE_VOID(253, glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_TRACE_VOID(254, glClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GLAD_TRACE_VOID(255, glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GLAD_TRACE_VOID(256, glClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GLAD_TRACE_VOID(257, glClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GLAD_TRACE_RETURN(258, const GLubyte *, glGetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index))
+GLAD_TRACE_RETURN(259, GLboolean, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer))
+GLAD_TRACE_VOID(260, glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_TRACE_VOID(261, glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_TRACE_VOID(262, glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_TRACE_VOID(263, glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_TRACE_VOID(264, glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_TRACE_RETURN(265, GLboolean, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer))
+GLAD_TRACE_VOID(266, glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_TRACE_VOID(267, glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_TRACE_VOID(268, glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_TRACE_RETURN(269, GLenum, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target))
+GLAD_TRACE_VOID(270, glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_TRACE_VOID(271, glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_TRACE_VOID(272, glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_TRACE_VOID(273, glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_TRACE_VOID(274, glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_TRACE_VOID(275, glGenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target))
+GLAD_TRACE_VOID(276, glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_TRACE_VOID(277, glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_TRACE_VOID(278, glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_TRACE_RETURN(279, void *, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GLAD_TRACE_VOID(280, glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GLAD_TRACE_VOID(281, glBindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_TRACE_VOID(282, glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_TRACE_VOID(283, glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_TRACE_RETURN(284, GLboolean, glIsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_TRACE_VOID(285, glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GLAD_TRACE_VOID(286, glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GLAD_TRACE_VOID(287, glTexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_TRACE_VOID(288, glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index))
+GLAD_TRACE_VOID(289, glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GLAD_TRACE_VOID(290, glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GLAD_TRACE_VOID(291, glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GLAD_TRACE_VOID(292, glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GLAD_TRACE_RETURN(293, GLuint, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GLAD_TRACE_VOID(294, glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GLAD_TRACE_VOID(295, glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GLAD_TRACE_VOID(296, glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_TRACE_VOID(297, glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GLAD_TRACE_VOID(298, glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GLAD_TRACE_VOID(299, glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GLAD_TRACE_VOID(300, glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GLAD_TRACE_VOID(301, glProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode))
+GLAD_TRACE_RETURN(302, GLsync, glFenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags))
+GLAD_TRACE_RETURN(303, GLboolean, glIsSync, PFNGLISSYNCPROC, (GLsync sync), (sync))
+GLAD_TRACE_VOID(304, glDeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync))
+GLAD_TRACE_RETURN(305, GLenum, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_TRACE_VOID(306, glWaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_TRACE_VOID(307, glGetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data))
+GLAD_TRACE_VOID(308, glGetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GLAD_TRACE_VOID(309, glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GLAD_TRACE_VOID(310, glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GLAD_TRACE_VOID(311, glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_TRACE_VOID(312, glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_TRACE_VOID(313, glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_TRACE_VOID(314, glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_TRACE_VOID(315, glSampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GLAD_TRACE_VOID(316, glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GLAD_TRACE_RETURN(317, GLint, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_TRACE_VOID(318, glGenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers))
+GLAD_TRACE_VOID(319, glDeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers))
+GLAD_TRACE_RETURN(320, GLboolean, glIsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler))
+GLAD_TRACE_VOID(321, glBindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler))
+GLAD_TRACE_VOID(322, glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GLAD_TRACE_VOID(323, glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_TRACE_VOID(324, glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GLAD_TRACE_VOID(325, glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GLAD_TRACE_VOID(326, glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_TRACE_VOID(327, glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GLAD_TRACE_VOID(328, glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_TRACE_VOID(329, glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_TRACE_VOID(330, glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GLAD_TRACE_VOID(331, glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GLAD_TRACE_VOID(332, glQueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target))
+GLAD_TRACE_VOID(333, glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_TRACE_VOID(334, glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_TRACE_VOID(335, glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_TRACE_VOID(336, glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_TRACE_VOID(337, glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_TRACE_VOID(338, glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_TRACE_VOID(339, glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_TRACE_VOID(340, glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_TRACE_VOID(341, glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_TRACE_VOID(342, glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_TRACE_VOID(343, glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_TRACE_VOID(344, glVertexP2ui, PFNGLVERTEXP2UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_TRACE_VOID(345, glVertexP2uiv, PFNGLVERTEXP2UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_TRACE_VOID(346, glVertexP3ui, PFNGLVERTEXP3UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_TRACE_VOID(347, glVertexP3uiv, PFNGLVERTEXP3UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_TRACE_VOID(348, glVertexP4ui, PFNGLVERTEXP4UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_TRACE_VOID(349, glVertexP4uiv, PFNGLVERTEXP4UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_TRACE_VOID(350, glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_TRACE_VOID(351, glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_TRACE_VOID(352, glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_TRACE_VOID(353, glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_TRACE_VOID(354, glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_TRACE_VOID(355, glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_TRACE_VOID(356, glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_TRACE_VOID(357, glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_TRACE_VOID(358, glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_TRACE_VOID(359, glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_TRACE_VOID(360, glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_TRACE_VOID(361, glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_TRACE_VOID(362, glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_TRACE_VOID(363, glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_TRACE_VOID(364, glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_TRACE_VOID(365, glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_TRACE_VOID(366, glNormalP3ui, PFNGLNORMALP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_TRACE_VOID(367, glNormalP3uiv, PFNGLNORMALP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_TRACE_VOID(368, glColorP3ui, PFNGLCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_TRACE_VOID(369, glColorP3uiv, PFNGLCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_TRACE_VOID(370, glColorP4ui, PFNGLCOLORP4UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_TRACE_VOID(371, glColorP4uiv, PFNGLCOLORP4UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_TRACE_VOID(372, glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_TRACE_VOID(373, glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_TRACE_VOID(374, glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GLAD_TRACE_VOID(375, glProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GLAD_TRACE_VOID(376, glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_TRACE_VOID(377, glMaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, (GLuint count), (count))
+GLAD_TRACE_VOID(378, glBufferStorage, PFNGLBUFFERSTORAGEPROC, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))
+
+/* wraps every pointer that got loaded, leaves NULL ones and already wrapped ones alone */
+#define GLAD_TRACE_WRAP(name) \
+	if(glad_##name != NULL && glad_##name != glad_trace_##name) { \
+		glad_real_##name = glad_##name; \
+		glad_##name = glad_trace_##name; \
+	}
+static void trace_wrap(void) {
+	GLAD_TRACE_WRAP(glCullFace)
+	GLAD_TRACE_WRAP(glFrontFace)
+	GLAD_TRACE_WRAP(glHint)
+	GLAD_TRACE_WRAP(glLineWidth)
+	GLAD_TRACE_WRAP(glPointSize)
+	GLAD_TRACE_WRAP(glPolygonMode)
+	GLAD_TRACE_WRAP(glScissor)
+	GLAD_TRACE_WRAP(glTexParameterf)
+	GLAD_TRACE_WRAP(glTexParameterfv)
+	GLAD_TRACE_WRAP(glTexParameteri)
+	GLAD_TRACE_WRAP(glTexParameteriv)
+	GLAD_TRACE_WRAP(glTexImage1D)
+	GLAD_TRACE_WRAP(glTexImage2D)
+	GLAD_TRACE_WRAP(glDrawBuffer)
+	GLAD_TRACE_WRAP(glClear)
+	GLAD_TRACE_WRAP(glClearColor)
+	GLAD_TRACE_WRAP(glClearStencil)
+	GLAD_TRACE_WRAP(glClearDepth)
+	GLAD_TRACE_WRAP(glStencilMask)
+	GLAD_TRACE_WRAP(glColorMask)
+	GLAD_TRACE_WRAP(glDepthMask)
+	GLAD_TRACE_WRAP(glDisable)
+	GLAD_TRACE_WRAP(glEnable)
+	GLAD_TRACE_WRAP(glFinish)
+	GLAD_TRACE_WRAP(glFlush)
+	GLAD_TRACE_WRAP(glBlendFunc)
+	GLAD_TRACE_WRAP(glLogicOp)
+	GLAD_TRACE_WRAP(glStencilFunc)
+	GLAD_TRACE_WRAP(glStencilOp)
+	GLAD_TRACE_WRAP(glDepthFunc)
+	GLAD_TRACE_WRAP(glPixelStoref)
+	GLAD_TRACE_WRAP(glPixelStorei)
+	GLAD_TRACE_WRAP(glReadBuffer)
+	GLAD_TRACE_WRAP(glReadPixels)
+	GLAD_TRACE_WRAP(glGetBooleanv)
+	GLAD_TRACE_WRAP(glGetDoublev)
+	GLAD_TRACE_WRAP(glGetError)
+	GLAD_TRACE_WRAP(glGetFloatv)
+	GLAD_TRACE_WRAP(glGetIntegerv)
+	GLAD_TRACE_WRAP(glGetString)
+	GLAD_TRACE_WRAP(glGetTexImage)
+	GLAD_TRACE_WRAP(glGetTexParameterfv)
+	GLAD_TRACE_WRAP(glGetTexParameteriv)
+	GLAD_TRACE_WRAP(glGetTexLevelParameterfv)
+	GLAD_TRACE_WRAP(glGetTexLevelParameteriv)
+	GLAD_TRACE_WRAP(glIsEnabled)
+	GLAD_TRACE_WRAP(glDepthRange)
+	GLAD_TRACE_WRAP(glViewport)
+	GLAD_TRACE_WRAP(glDrawArrays)
+	GLAD_TRACE_WRAP(glDrawElements)
+	GLAD_TRACE_WRAP(glPolygonOffset)
+	GLAD_TRACE_WRAP(glCopyTexImage1D)
+	GLAD_TRACE_WRAP(glCopyTexImage2D)
+	GLAD_TRACE_WRAP(glCopyTexSubImage1D)
+	GLAD_TRACE_WRAP(glCopyTexSubImage2D)
+	GLAD_TRACE_WRAP(glTexSubImage1D)
+	GLAD_TRACE_WRAP(glTexSubImage2D)
+	GLAD_TRACE_WRAP(glBindTexture)
+	GLAD_TRACE_WRAP(glDeleteTextures)
+	GLAD_TRACE_WRAP(glGenTextures)
+	GLAD_TRACE_WRAP(glIsTexture)
+	GLAD_TRACE_WRAP(glDrawRangeElements)
+	GLAD_TRACE_WRAP(glTexImage3D)
+	GLAD_TRACE_WRAP(glTexSubImage3D)
+	GLAD_TRACE_WRAP(glCopyTexSubImage3D)
+	GLAD_TRACE_WRAP(glActiveTexture)
+	GLAD_TRACE_WRAP(glSampleCoverage)
+	GLAD_TRACE_WRAP(glCompressedTexImage3D)
+	GLAD_TRACE_WRAP(glCompressedTexImage2D)
+	GLAD_TRACE_WRAP(glCompressedTexImage1D)
+	GLAD_TRACE_WRAP(glCompressedTexSubImage3D)
+	GLAD_TRACE_WRAP(glCompressedTexSubImage2D)
+	GLAD_TRACE_WRAP(glCompressedTexSubImage1D)
+	GLAD_TRACE_WRAP(glGetCompressedTexImage)
+	GLAD_TRACE_WRAP(glBlendFuncSeparate)
+	GLAD_TRACE_WRAP(glMultiDrawArrays)
+	GLAD_TRACE_WRAP(glMultiDrawElements)
+	GLAD_TRACE_WRAP(glPointParameterf)
+	GLAD_TRACE_WRAP(glPointParameterfv)
+	GLAD_TRACE_WRAP(glPointParameteri)
+	GLAD_TRACE_WRAP(glPointParameteriv)
+	GLAD_TRACE_WRAP(glBlendColor)
+	GLAD_TRACE_WRAP(glBlendEquation)
+	GLAD_TRACE_WRAP(glGenQueries)
+	GLAD_TRACE_WRAP(glDeleteQueries)
+	GLAD_TRACE_WRAP(glIsQuery)
+	GLAD_TRACE_WRAP(glBeginQuery)
+	GLAD_TRACE_WRAP(glEndQuery)
+	GLAD_TRACE_WRAP(glGetQueryiv)
+	GLAD_TRACE_WRAP(glGetQueryObjectiv)
+	GLAD_TRACE_WRAP(glGetQueryObjectuiv)
+	GLAD_TRACE_WRAP(glBindBuffer)
+	GLAD_TRACE_WRAP(glDeleteBuffers)
+	GLAD_TRACE_WRAP(glGenBuffers)
+	GLAD_TRACE_WRAP(glIsBuffer)
+	GLAD_TRACE_WRAP(glBufferData)
+	GLAD_TRACE_WRAP(glBufferSubData)
+	GLAD_TRACE_WRAP(glGetBufferSubData)
+	GLAD_TRACE_WRAP(glMapBuffer)
+	GLAD_TRACE_WRAP(glUnmapBuffer)
+	GLAD_TRACE_WRAP(glGetBufferParameteriv)
+	GLAD_TRACE_WRAP(glGetBufferPointerv)
+	GLAD_TRACE_WRAP(glBlendEquationSeparate)
+	GLAD_TRACE_WRAP(glDrawBuffers)
+	GLAD_TRACE_WRAP(glStencilOpSeparate)
+	GLAD_TRACE_WRAP(glStencilFuncSeparate)
+	GLAD_TRACE_WRAP(glStencilMaskSeparate)
+	GLAD_TRACE_WRAP(glAttachShader)
+	GLAD_TRACE_WRAP(glBindAttribLocation)
+	GLAD_TRACE_WRAP(glCompileShader)
+	GLAD_TRACE_WRAP(glCreateProgram)
+	GLAD_TRACE_WRAP(glCreateShader)
+	GLAD_TRACE_WRAP(glDeleteProgram)
+	GLAD_TRACE_WRAP(glDeleteShader)
+	GLAD_TRACE_WRAP(glDetachShader)
+	GLAD_TRACE_WRAP(glDisableVertexAttribArray)
+	GLAD_TRACE_WRAP(glEnableVertexAttribArray)
+	GLAD_TRACE_WRAP(glGetActiveAttrib)
+	GLAD_TRACE_WRAP(glGetActiveUniform)
+	GLAD_TRACE_WRAP(glGetAttachedShaders)
+	GLAD_TRACE_WRAP(glGetAttribLocation)
+	GLAD_TRACE_WRAP(glGetProgramiv)
+	GLAD_TRACE_WRAP(glGetProgramInfoLog)
+	GLAD_TRACE_WRAP(glGetShaderiv)
+	GLAD_TRACE_WRAP(glGetShaderInfoLog)
+	GLAD_TRACE_WRAP(glGetShaderSource)
+	GLAD_TRACE_WRAP(glGetUniformLocation)
+	GLAD_TRACE_WRAP(glGetUniformfv)
+	GLAD_TRACE_WRAP(glGetUniformiv)
+	GLAD_TRACE_WRAP(glGetVertexAttribdv)
+	GLAD_TRACE_WRAP(glGetVertexAttribfv)
+	GLAD_TRACE_WRAP(glGetVertexAttribiv)
+	GLAD_TRACE_WRAP(glGetVertexAttribPointerv)
+	GLAD_TRACE_WRAP(glIsProgram)
+	GLAD_TRACE_WRAP(glIsShader)
+	GLAD_TRACE_WRAP(glLinkProgram)
+	GLAD_TRACE_WRAP(glShaderSource)
+	GLAD_TRACE_WRAP(glUseProgram)
+	GLAD_TRACE_WRAP(glUniform1f)
+	GLAD_TRACE_WRAP(glUniform2f)
+	GLAD_TRACE_WRAP(glUniform3f)
+	GLAD_TRACE_WRAP(glUniform4f)
+	GLAD_TRACE_WRAP(glUniform1i)
+	GLAD_TRACE_WRAP(glUniform2i)
+	GLAD_TRACE_WRAP(glUniform3i)
+	GLAD_TRACE_WRAP(glUniform4i)
+	GLAD_TRACE_WRAP(glUniform1fv)
+	GLAD_TRACE_WRAP(glUniform2fv)
+	GLAD_TRACE_WRAP(glUniform3fv)
+	GLAD_TRACE_WRAP(glUniform4fv)
+	GLAD_TRACE_WRAP(glUniform1iv)
+	GLAD_TRACE_WRAP(glUniform2iv)
+	GLAD_TRACE_WRAP(glUniform3iv)
+	GLAD_TRACE_WRAP(glUniform4iv)
+	GLAD_TRACE_WRAP(glUniformMatrix2fv)
+	GLAD_TRACE_WRAP(glUniformMatrix3fv)
+	GLAD_TRACE_WRAP(glUniformMatrix4fv)
+	GLAD_TRACE_WRAP(glValidateProgram)
+	GLAD_TRACE_WRAP(glVertexAttrib1d)
+	GLAD_TRACE_WRAP(glVertexAttrib1dv)
+	GLAD_TRACE_WRAP(glVertexAttrib1f)
+	GLAD_TRACE_WRAP(glVertexAttrib1fv)
+	GLAD_TRACE_WRAP(glVertexAttrib1s)
+	GLAD_TRACE_WRAP(glVertexAttrib1sv)
+	GLAD_TRACE_WRAP(glVertexAttrib2d)
+	GLAD_TRACE_WRAP(glVertexAttrib2dv)
+	GLAD_TRACE_WRAP(glVertexAttrib2f)
+	GLAD_TRACE_WRAP(glVertexAttrib2fv)
+	GLAD_TRACE_WRAP(glVertexAttrib2s)
+	GLAD_TRACE_WRAP(glVertexAttrib2sv)
+	GLAD_TRACE_WRAP(glVertexAttrib3d)
+	GLAD_TRACE_WRAP(glVertexAttrib3dv)
+	GLAD_TRACE_WRAP(glVertexAttrib3f)
+	GLAD_TRACE_WRAP(glVertexAttrib3fv)
+	GLAD_TRACE_WRAP(glVertexAttrib3s)
+	GLAD_TRACE_WRAP(glVertexAttrib3sv)
+	GLAD_TRACE_WRAP(glVertexAttrib4Nbv)
+	GLAD_TRACE_WRAP(glVertexAttrib4Niv)
+	GLAD_TRACE_WRAP(glVertexAttrib4Nsv)
+	GLAD_TRACE_WRAP(glVertexAttrib4Nub)
+	GLAD_TRACE_WRAP(glVertexAttrib4Nubv)
+	GLAD_TRACE_WRAP(glVertexAttrib4Nuiv)
+	GLAD_TRACE_WRAP(glVertexAttrib4Nusv)
+	GLAD_TRACE_WRAP(glVertexAttrib4bv)
+	GLAD_TRACE_WRAP(glVertexAttrib4d)
+	GLAD_TRACE_WRAP(glVertexAttrib4dv)
+	GLAD_TRACE_WRAP(glVertexAttrib4f)
+	GLAD_TRACE_WRAP(glVertexAttrib4fv)
+	GLAD_TRACE_WRAP(glVertexAttrib4iv)
+	GLAD_TRACE_WRAP(glVertexAttrib4s)
+	GLAD_TRACE_WRAP(glVertexAttrib4sv)
+	GLAD_TRACE_WRAP(glVertexAttrib4ubv)
+	GLAD_TRACE_WRAP(glVertexAttrib4uiv)
+	GLAD_TRACE_WRAP(glVertexAttrib4usv)
+	GLAD_TRACE_WRAP(glVertexAttribPointer)
+	GLAD_TRACE_WRAP(glUniformMatrix2x3fv)
+	GLAD_TRACE_WRAP(glUniformMatrix3x2fv)
+	GLAD_TRACE_WRAP(glUniformMatrix2x4fv)
+	GLAD_TRACE_WRAP(glUniformMatrix4x2fv)
+	GLAD_TRACE_WRAP(glUniformMatrix3x4fv)
+	GLAD_TRACE_WRAP(glUniformMatrix4x3fv)
+	GLAD_TRACE_WRAP(glColorMaski)
+	GLAD_TRACE_WRAP(glGetBooleani_v)
+	GLAD_TRACE_WRAP(glGetIntegeri_v)
+	GLAD_TRACE_WRAP(glEnablei)
+	GLAD_TRACE_WRAP(glDisablei)
+	GLAD_TRACE_WRAP(glIsEnabledi)
+	GLAD_TRACE_WRAP(glBeginTransformFeedback)
+	GLAD_TRACE_WRAP(glEndTransformFeedback)
+	GLAD_TRACE_WRAP(glBindBufferRange)
+	GLAD_TRACE_WRAP(glBindBufferBase)
+	GLAD_TRACE_WRAP(glTransformFeedbackVaryings)
+	GLAD_TRACE_WRAP(glGetTransformFeedbackVarying)
+	GLAD_TRACE_WRAP(glClampColor)
+	GLAD_TRACE_WRAP(glBeginConditionalRender)
+	GLAD_TRACE_WRAP(glEndConditionalRender)
+	GLAD_TRACE_WRAP(glVertexAttribIPointer)
+	GLAD_TRACE_WRAP(glGetVertexAttribIiv)
+	GLAD_TRACE_WRAP(glGetVertexAttribIuiv)
+	GLAD_TRACE_WRAP(glVertexAttribI1i)
+	GLAD_TRACE_WRAP(glVertexAttribI2i)
+	GLAD_TRACE_WRAP(glVertexAttribI3i)
+	GLAD_TRACE_WRAP(glVertexAttribI4i)
+	GLAD_TRACE_WRAP(glVertexAttribI1ui)
+	GLAD_TRACE_WRAP(glVertexAttribI2ui)
+	GLAD_TRACE_WRAP(glVertexAttribI3ui)
+	GLAD_TRACE_WRAP(glVertexAttribI4ui)
+	GLAD_TRACE_WRAP(glVertexAttribI1iv)
+	GLAD_TRACE_WRAP(glVertexAttribI2iv)
+	GLAD_TRACE_WRAP(glVertexAttribI3iv)
+	GLAD_TRACE_WRAP(glVertexAttribI4iv)
+	GLAD_TRACE_WRAP(glVertexAttribI1uiv)
+	GLAD_TRACE_WRAP(glVertexAttribI2uiv)
+	GLAD_TRACE_WRAP(glVertexAttribI3uiv)
+	GLAD_TRACE_WRAP(glVertexAttribI4uiv)
+	GLAD_TRACE_WRAP(glVertexAttribI4bv)
+	GLAD_TRACE_WRAP(glVertexAttribI4sv)
+	GLAD_TRACE_WRAP(glVertexAttribI4ubv)
+	GLAD_TRACE_WRAP(glVertexAttribI4usv)
+	GLAD_TRACE_WRAP(glGetUniformuiv)
+	GLAD_TRACE_WRAP(glBindFragDataLocation)
+	GLAD_TRACE_WRAP(glGetFragDataLocation)
+	GLAD_TRACE_WRAP(glUniform1ui)
+	GLAD_TRACE_WRAP(glUniform2ui)
+	GLAD_TRACE_WRAP(glUniform3ui)
+	GLAD_TRACE_WRAP(glUniform4ui)
+	GLAD_TRACE_WRAP(glUniform1uiv)
+	GLAD_TRACE_WRAP(glUniform2uiv)
+	GLAD_TRACE_WRAP(glUniform3uiv)
+	GLAD_TRACE_WRAP(glUniform4uiv)
+	GLAD_TRACE_WRAP(glTexParameterIiv)
+	GLAD_TRACE_WRAP(glTexParameterIuiv)
+	GLAD_TRACE_WRAP(glGetTexParameterIiv)
+	GLAD_TRACE_WRAP(glGetTexParameterIuiv)
+	GLAD_TRACE_WRAP(glClearBufferiv)
+	GLAD_TRACE_WRAP(glClearBufferuiv)
+	GLAD_TRACE_WRAP(glClearBufferfv)
+	GLAD_TRACE_WRAP(glClearBufferfi)
+	GLAD_TRACE_WRAP(glGetStringi)
+	GLAD_TRACE_WRAP(glIsRenderbuffer)
+	GLAD_TRACE_WRAP(glBindRenderbuffer)
+	GLAD_TRACE_WRAP(glDeleteRenderbuffers)
+	GLAD_TRACE_WRAP(glGenRenderbuffers)
+	GLAD_TRACE_WRAP(glRenderbufferStorage)
+	GLAD_TRACE_WRAP(glGetRenderbufferParameteriv)
+	GLAD_TRACE_WRAP(glIsFramebuffer)
+	GLAD_TRACE_WRAP(glBindFramebuffer)
+	GLAD_TRACE_WRAP(glDeleteFramebuffers)
+	GLAD_TRACE_WRAP(glGenFramebuffers)
+	GLAD_TRACE_WRAP(glCheckFramebufferStatus)
+	GLAD_TRACE_WRAP(glFramebufferTexture1D)
+	GLAD_TRACE_WRAP(glFramebufferTexture2D)
+	GLAD_TRACE_WRAP(glFramebufferTexture3D)
+	GLAD_TRACE_WRAP(glFramebufferRenderbuffer)
+	GLAD_TRACE_WRAP(glGetFramebufferAttachmentParameteriv)
+	GLAD_TRACE_WRAP(glGenerateMipmap)
+	GLAD_TRACE_WRAP(glBlitFramebuffer)
+	GLAD_TRACE_WRAP(glRenderbufferStorageMultisample)
+	GLAD_TRACE_WRAP(glFramebufferTextureLayer)
+	GLAD_TRACE_WRAP(glMapBufferRange)
+	GLAD_TRACE_WRAP(glFlushMappedBufferRange)
+	GLAD_TRACE_WRAP(glBindVertexArray)
+	GLAD_TRACE_WRAP(glDeleteVertexArrays)
+	GLAD_TRACE_WRAP(glGenVertexArrays)
+	GLAD_TRACE_WRAP(glIsVertexArray)
+	GLAD_TRACE_WRAP(glDrawArraysInstanced)
+	GLAD_TRACE_WRAP(glDrawElementsInstanced)
+	GLAD_TRACE_WRAP(glTexBuffer)
+	GLAD_TRACE_WRAP(glPrimitiveRestartIndex)
+	GLAD_TRACE_WRAP(glCopyBufferSubData)
+	GLAD_TRACE_WRAP(glGetUniformIndices)
+	GLAD_TRACE_WRAP(glGetActiveUniformsiv)
+	GLAD_TRACE_WRAP(glGetActiveUniformName)
+	GLAD_TRACE_WRAP(glGetUniformBlockIndex)
+	GLAD_TRACE_WRAP(glGetActiveUniformBlockiv)
+	GLAD_TRACE_WRAP(glGetActiveUniformBlockName)
+	GLAD_TRACE_WRAP(glUniformBlockBinding)
+	GLAD_TRACE_WRAP(glDrawElementsBaseVertex)
+	GLAD_TRACE_WRAP(glDrawRangeElementsBaseVertex)
+	GLAD_TRACE_WRAP(glDrawElementsInstancedBaseVertex)
+	GLAD_TRACE_WRAP(glMultiDrawElementsBaseVertex)
+	GLAD_TRACE_WRAP(glProvokingVertex)
+	GLAD_TRACE_WRAP(glFenceSync)
+	GLAD_TRACE_WRAP(glIsSync)
+	GLAD_TRACE_WRAP(glDeleteSync)
+	GLAD_TRACE_WRAP(glClientWaitSync)
+	GLAD_TRACE_WRAP(glWaitSync)
+	GLAD_TRACE_WRAP(glGetInteger64v)
+	GLAD_TRACE_WRAP(glGetSynciv)
+	GLAD_TRACE_WRAP(glGetInteger64i_v)
+	GLAD_TRACE_WRAP(glGetBufferParameteri64v)
+	GLAD_TRACE_WRAP(glFramebufferTexture)
+	GLAD_TRACE_WRAP(glTexImage2DMultisample)
+	GLAD_TRACE_WRAP(glTexImage3DMultisample)
+	GLAD_TRACE_WRAP(glGetMultisamplefv)
+	GLAD_TRACE_WRAP(glSampleMaski)
+	GLAD_TRACE_WRAP(glBindFragDataLocationIndexed)
+	GLAD_TRACE_WRAP(glGetFragDataIndex)
+	GLAD_TRACE_WRAP(glGenSamplers)
+	GLAD_TRACE_WRAP(glDeleteSamplers)
+	GLAD_TRACE_WRAP(glIsSampler)
+	GLAD_TRACE_WRAP(glBindSampler)
+	GLAD_TRACE_WRAP(glSamplerParameteri)
+	GLAD_TRACE_WRAP(glSamplerParameteriv)
+	GLAD_TRACE_WRAP(glSamplerParameterf)
+	GLAD_TRACE_WRAP(glSamplerParameterfv)
+	GLAD_TRACE_WRAP(glSamplerParameterIiv)
+	GLAD_TRACE_WRAP(glSamplerParameterIuiv)
+	GLAD_TRACE_WRAP(glGetSamplerParameteriv)
+	GLAD_TRACE_WRAP(glGetSamplerParameterIiv)
+	GLAD_TRACE_WRAP(glGetSamplerParameterfv)
+	GLAD_TRACE_WRAP(glGetSamplerParameterIuiv)
+	GLAD_TRACE_WRAP(glQueryCounter)
+	GLAD_TRACE_WRAP(glGetQueryObjecti64v)
+	GLAD_TRACE_WRAP(glGetQueryObjectui64v)
+	GLAD_TRACE_WRAP(glVertexAttribDivisor)
+	GLAD_TRACE_WRAP(glVertexAttribP1ui)
+	GLAD_TRACE_WRAP(glVertexAttribP1uiv)
+	GLAD_TRACE_WRAP(glVertexAttribP2ui)
+	GLAD_TRACE_WRAP(glVertexAttribP2uiv)
+	GLAD_TRACE_WRAP(glVertexAttribP3ui)
+	GLAD_TRACE_WRAP(glVertexAttribP3uiv)
+	GLAD_TRACE_WRAP(glVertexAttribP4ui)
+	GLAD_TRACE_WRAP(glVertexAttribP4uiv)
+	GLAD_TRACE_WRAP(glVertexP2ui)
+	GLAD_TRACE_WRAP(glVertexP2uiv)
+	GLAD_TRACE_WRAP(glVertexP3ui)
+	GLAD_TRACE_WRAP(glVertexP3uiv)
+	GLAD_TRACE_WRAP(glVertexP4ui)
+	GLAD_TRACE_WRAP(glVertexP4uiv)
+	GLAD_TRACE_WRAP(glTexCoordP1ui)
+	GLAD_TRACE_WRAP(glTexCoordP1uiv)
+	GLAD_TRACE_WRAP(glTexCoordP2ui)
+	GLAD_TRACE_WRAP(glTexCoordP2uiv)
+	GLAD_TRACE_WRAP(glTexCoordP3ui)
+	GLAD_TRACE_WRAP(glTexCoordP3uiv)
+	GLAD_TRACE_WRAP(glTexCoordP4ui)
+	GLAD_TRACE_WRAP(glTexCoordP4uiv)
+	GLAD_TRACE_WRAP(glMultiTexCoordP1ui)
+	GLAD_TRACE_WRAP(glMultiTexCoordP1uiv)
+	GLAD_TRACE_WRAP(glMultiTexCoordP2ui)
+	GLAD_TRACE_WRAP(glMultiTexCoordP2uiv)
+	GLAD_TRACE_WRAP(glMultiTexCoordP3ui)
+	GLAD_TRACE_WRAP(glMultiTexCoordP3uiv)
+	GLAD_TRACE_WRAP(glMultiTexCoordP4ui)
+	GLAD_TRACE_WRAP(glMultiTexCoordP4uiv)
+	GLAD_TRACE_WRAP(glNormalP3ui)
+	GLAD_TRACE_WRAP(glNormalP3uiv)
+	GLAD_TRACE_WRAP(glColorP3ui)
+	GLAD_TRACE_WRAP(glColorP3uiv)
+	GLAD_TRACE_WRAP(glColorP4ui)
+	GLAD_TRACE_WRAP(glColorP4uiv)
+	GLAD_TRACE_WRAP(glSecondaryColorP3ui)
+	GLAD_TRACE_WRAP(glSecondaryColorP3uiv)
+	GLAD_TRACE_WRAP(glGetProgramBinary)
+	GLAD_TRACE_WRAP(glProgramBinary)
+	GLAD_TRACE_WRAP(glProgramParameteri)
+	GLAD_TRACE_WRAP(glMaxShaderCompilerThreadsKHR)
+	GLAD_TRACE_WRAP(glBufferStorage)
+}
+
+int gladTraceEntries(const struct GladTraceEntry **entries) {
+    *entries = glad_trace;
+    return (int)(sizeof(glad_trace) / sizeof(glad_trace[0]));
+}
+
+void gladTraceReset(void) {
+    size_t i;
+    for(i = 0; i < sizeof(glad_trace) / sizeof(glad_trace[0]); i++) {
+        glad_trace[i].calls = 0;
+        glad_trace[i].nanoseconds = 0;
+    }
+}
+
+/* a lazy trampoline replaces itself with the real function: if the shim is in front of it,
+ * only the shim's target gets replaced */
+#define GLAD_LAZY_PATCH(pointer, real, lazy, pfn, proc) \
+	if(real == (pfn)lazy) real = proc; \
+	else pointer = proc
+#else
+#define GLAD_LAZY_PATCH(pointer, real, lazy, pfn, proc) pointer = proc
+#endif
+
+static GLADloadproc glad_lazy_load = NULL;
+static int glad_lazy_resolved = 0;
+
+static void* glad_lazy_resolve(const char *name) {
+	glad_lazy_resolved++;
+	return glad_lazy_load(name);
+}
+
+#define GLAD_LAZY_VOID(name, pfn, params, args) \
+	static void APIENTRY glad_lazy_##name params { \
+		pfn glad_proc = (pfn)glad_lazy_resolve(#name); \
+		GLAD_LAZY_PATCH(glad_##name, glad_real_##name, glad_lazy_##name, pfn, glad_proc); \
+		glad_proc args; \
+	}
+#define GLAD_LAZY_RETURN(ret, name, pfn, params, args) \
+	static ret APIENTRY glad_lazy_##name params { \
+		pfn glad_proc = (pfn)glad_lazy_resolve(#name); \
+		GLAD_LAZY_PATCH(glad_##name, glad_real_##name, glad_lazy_##name, pfn, glad_proc); \
+		return glad_proc args; \
+	}
+GLAD_LAZY_VOID(glCullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glFrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glHint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode))
+GLAD_LAZY_VOID(glLineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width))
+GLAD_LAZY_VOID(glPointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size))
+GLAD_LAZY_VOID(glPolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode))
+GLAD_LAZY_VOID(glScissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(glTexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GLAD_LAZY_VOID(glTexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GLAD_LAZY_VOID(glTexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GLAD_LAZY_VOID(glDrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf))
+GLAD_LAZY_VOID(glClear, PFNGLCLEARPROC, (GLbitfield mask), (mask))
+GLAD_LAZY_VOID(glClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s))
+GLAD_LAZY_VOID(glClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth))
+GLAD_LAZY_VOID(glStencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask))
+GLAD_LAZY_VOID(glColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glDepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag))
+GLAD_LAZY_VOID(glDisable, PFNGLDISABLEPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glEnable, PFNGLENABLEPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glFinish, PFNGLFINISHPROC, (void), ())
+GLAD_LAZY_VOID(glFlush, PFNGLFLUSHPROC, (void), ())
+GLAD_LAZY_VOID(glBlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GLAD_LAZY_VOID(glLogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode))
+GLAD_LAZY_VOID(glStencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GLAD_LAZY_VOID(glStencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GLAD_LAZY_VOID(glDepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func))
+GLAD_LAZY_VOID(glPixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src))
+GLAD_LAZY_VOID(glReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glGetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data))
+GLAD_LAZY_VOID(glGetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data))
+GLAD_LAZY_RETURN(GLenum, glGetError, PFNGLGETERRORPROC, (void), ())
+GLAD_LAZY_VOID(glGetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data))
+GLAD_LAZY_VOID(glGetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data))
+GLAD_LAZY_VOID(glGetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GLAD_LAZY_VOID(glGetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GLAD_LAZY_VOID(glGetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GLAD_LAZY_RETURN(GLboolean, glIsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap))
+GLAD_LAZY_VOID(glDepthRange, PFNGLDEPTHRANGEPROC, (GLdouble n, GLdouble f), (n, f))
+GLAD_LAZY_VOID(glViewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GLAD_LAZY_VOID(glDrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GLAD_LAZY_VOID(glDrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GLAD_LAZY_VOID(glPolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units))
+GLAD_LAZY_VOID(glCopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GLAD_LAZY_VOID(glCopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GLAD_LAZY_VOID(glCopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GLAD_LAZY_VOID(glCopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GLAD_LAZY_VOID(glTexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GLAD_LAZY_VOID(glTexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GLAD_LAZY_VOID(glBindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture))
+GLAD_LAZY_VOID(glDeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures))
+GLAD_LAZY_VOID(glGenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures))
+GLAD_LAZY_RETURN(GLboolean, glIsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture))
+GLAD_LAZY_VOID(glDrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GLAD_LAZY_VOID(glTexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GLAD_LAZY_VOID(glTexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GLAD_LAZY_VOID(glCopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GLAD_LAZY_VOID(glActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture))
+GLAD_LAZY_VOID(glSampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert))
+GLAD_LAZY_VOID(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GLAD_LAZY_VOID(glCompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GLAD_LAZY_VOID(glGetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void *img), (target, level, img))
+GLAD_LAZY_VOID(glBlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GLAD_LAZY_VOID(glMultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GLAD_LAZY_VOID(glMultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GLAD_LAZY_VOID(glPointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param))
+GLAD_LAZY_VOID(glPointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params))
+GLAD_LAZY_VOID(glPointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param))
+GLAD_LAZY_VOID(glPointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params))
+GLAD_LAZY_VOID(glBlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GLAD_LAZY_VOID(glBlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode))
+GLAD_LAZY_VOID(glGenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids))
+GLAD_LAZY_VOID(glDeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids))
+GLAD_LAZY_RETURN(GLboolean, glIsQuery, PFNGLISQUERYPROC, (GLuint id), (id))
+GLAD_LAZY_VOID(glBeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id))
+GLAD_LAZY_VOID(glEndQuery, PFNGLENDQUERYPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GLAD_LAZY_VOID(glBindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer))
+GLAD_LAZY_VOID(glDeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers))
+GLAD_LAZY_VOID(glGenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers))
+GLAD_LAZY_RETURN(GLboolean, glIsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer))
+GLAD_LAZY_VOID(glBufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GLAD_LAZY_VOID(glBufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GLAD_LAZY_VOID(glGetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GLAD_LAZY_RETURN(void *, glMapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access))
+GLAD_LAZY_RETURN(GLboolean, glUnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glGetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GLAD_LAZY_VOID(glBlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GLAD_LAZY_VOID(glDrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs))
+GLAD_LAZY_VOID(glStencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GLAD_LAZY_VOID(glStencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GLAD_LAZY_VOID(glStencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask))
+GLAD_LAZY_VOID(glAttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(glBindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GLAD_LAZY_VOID(glCompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_RETURN(GLuint, glCreateProgram, PFNGLCREATEPROGRAMPROC, (void), ())
+GLAD_LAZY_RETURN(GLuint, glCreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type))
+GLAD_LAZY_VOID(glDeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glDeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_VOID(glDetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader))
+GLAD_LAZY_VOID(glDisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glEnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glGetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glGetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GLAD_LAZY_RETURN(GLint, glGetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GLAD_LAZY_VOID(glGetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GLAD_LAZY_VOID(glGetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GLAD_LAZY_VOID(glGetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GLAD_LAZY_RETURN(GLint, glGetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GLAD_LAZY_VOID(glGetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params))
+GLAD_LAZY_VOID(glGetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GLAD_LAZY_RETURN(GLboolean, glIsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_RETURN(GLboolean, glIsShader, PFNGLISSHADERPROC, (GLuint shader), (shader))
+GLAD_LAZY_VOID(glLinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GLAD_LAZY_VOID(glUseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glUniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program))
+GLAD_LAZY_VOID(glVertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x))
+GLAD_LAZY_VOID(glVertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GLAD_LAZY_VOID(glUniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glUniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GLAD_LAZY_VOID(glColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GLAD_LAZY_VOID(glGetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GLAD_LAZY_VOID(glGetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GLAD_LAZY_VOID(glEnablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glDisablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_RETURN(GLboolean, glIsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index))
+GLAD_LAZY_VOID(glBeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode))
+GLAD_LAZY_VOID(glEndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), ())
+GLAD_LAZY_VOID(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GLAD_LAZY_VOID(glBindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GLAD_LAZY_VOID(glTransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GLAD_LAZY_VOID(glGetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GLAD_LAZY_VOID(glClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp))
+GLAD_LAZY_VOID(glBeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode))
+GLAD_LAZY_VOID(glEndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), ())
+GLAD_LAZY_VOID(glVertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GLAD_LAZY_VOID(glGetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GLAD_LAZY_VOID(glGetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GLAD_LAZY_VOID(glVertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x))
+GLAD_LAZY_VOID(glVertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GLAD_LAZY_VOID(glVertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GLAD_LAZY_VOID(glVertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GLAD_LAZY_VOID(glVertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v))
+GLAD_LAZY_VOID(glVertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v))
+GLAD_LAZY_VOID(glGetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GLAD_LAZY_VOID(glBindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GLAD_LAZY_RETURN(GLint, glGetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glUniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0))
+GLAD_LAZY_VOID(glUniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GLAD_LAZY_VOID(glUniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GLAD_LAZY_VOID(glUniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GLAD_LAZY_VOID(glUniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glUniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GLAD_LAZY_VOID(glTexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glTexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_VOID(glGetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GLAD_LAZY_VOID(glClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GLAD_LAZY_VOID(glClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GLAD_LAZY_RETURN(const GLubyte *, glGetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index))
+GLAD_LAZY_RETURN(GLboolean, glIsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer))
+GLAD_LAZY_VOID(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GLAD_LAZY_VOID(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GLAD_LAZY_VOID(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GLAD_LAZY_VOID(glGetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GLAD_LAZY_RETURN(GLboolean, glIsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer))
+GLAD_LAZY_VOID(glBindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GLAD_LAZY_VOID(glDeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_VOID(glGenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GLAD_LAZY_RETURN(GLenum, glCheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glFramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GLAD_LAZY_VOID(glFramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GLAD_LAZY_VOID(glFramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GLAD_LAZY_VOID(glGetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GLAD_LAZY_VOID(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target))
+GLAD_LAZY_VOID(glBlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GLAD_LAZY_VOID(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GLAD_LAZY_VOID(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GLAD_LAZY_RETURN(void *, glMapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GLAD_LAZY_VOID(glFlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GLAD_LAZY_VOID(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_LAZY_VOID(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays))
+GLAD_LAZY_VOID(glGenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays))
+GLAD_LAZY_RETURN(GLboolean, glIsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array))
+GLAD_LAZY_VOID(glDrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GLAD_LAZY_VOID(glDrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GLAD_LAZY_VOID(glTexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GLAD_LAZY_VOID(glPrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index))
+GLAD_LAZY_VOID(glCopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GLAD_LAZY_VOID(glGetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GLAD_LAZY_VOID(glGetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GLAD_LAZY_VOID(glGetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GLAD_LAZY_RETURN(GLuint, glGetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GLAD_LAZY_VOID(glGetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GLAD_LAZY_VOID(glGetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GLAD_LAZY_VOID(glUniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GLAD_LAZY_VOID(glDrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GLAD_LAZY_VOID(glDrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GLAD_LAZY_VOID(glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GLAD_LAZY_VOID(glMultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GLAD_LAZY_VOID(glProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode))
+GLAD_LAZY_RETURN(GLsync, glFenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags))
+GLAD_LAZY_RETURN(GLboolean, glIsSync, PFNGLISSYNCPROC, (GLsync sync), (sync))
+GLAD_LAZY_VOID(glDeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync))
+GLAD_LAZY_RETURN(GLenum, glClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(glWaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GLAD_LAZY_VOID(glGetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data))
+GLAD_LAZY_VOID(glGetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values), (sync, pname, count, length, values))
+GLAD_LAZY_VOID(glGetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GLAD_LAZY_VOID(glGetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GLAD_LAZY_VOID(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GLAD_LAZY_VOID(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GLAD_LAZY_VOID(glTexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GLAD_LAZY_VOID(glGetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GLAD_LAZY_VOID(glSampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GLAD_LAZY_VOID(glBindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GLAD_LAZY_RETURN(GLint, glGetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name))
+GLAD_LAZY_VOID(glGenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers))
+GLAD_LAZY_VOID(glDeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers))
+GLAD_LAZY_RETURN(GLboolean, glIsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler))
+GLAD_LAZY_VOID(glBindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler))
+GLAD_LAZY_VOID(glSamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glSamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GLAD_LAZY_VOID(glGetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glGetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GLAD_LAZY_VOID(glQueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target))
+GLAD_LAZY_VOID(glGetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(glGetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GLAD_LAZY_VOID(glVertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor))
+GLAD_LAZY_VOID(glVertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GLAD_LAZY_VOID(glVertexP2ui, PFNGLVERTEXP2UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP2uiv, PFNGLVERTEXP2UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexP3ui, PFNGLVERTEXP3UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP3uiv, PFNGLVERTEXP3UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glVertexP4ui, PFNGLVERTEXP4UIPROC, (GLenum type, GLuint value), (type, value))
+GLAD_LAZY_VOID(glVertexP4uiv, PFNGLVERTEXP4UIVPROC, (GLenum type, const GLuint *value), (type, value))
+GLAD_LAZY_VOID(glTexCoordP1ui, PFNGLTEXCOORDP1UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP2ui, PFNGLTEXCOORDP2UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP3ui, PFNGLTEXCOORDP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP4ui, PFNGLTEXCOORDP4UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glTexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords))
+GLAD_LAZY_VOID(glMultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords))
+GLAD_LAZY_VOID(glNormalP3ui, PFNGLNORMALP3UIPROC, (GLenum type, GLuint coords), (type, coords))
+GLAD_LAZY_VOID(glNormalP3uiv, PFNGLNORMALP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords))
+GLAD_LAZY_VOID(glColorP3ui, PFNGLCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glColorP3uiv, PFNGLCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glColorP4ui, PFNGLCOLORP4UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glColorP4uiv, PFNGLCOLORP4UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glSecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC, (GLenum type, GLuint color), (type, color))
+GLAD_LAZY_VOID(glSecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color))
+GLAD_LAZY_VOID(glGetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary))
+GLAD_LAZY_VOID(glProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length))
+GLAD_LAZY_VOID(glProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+GLAD_LAZY_VOID(glMaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, (GLuint count), (count))
+GLAD_LAZY_VOID(glBufferStorage, PFNGLBUFFERSTORAGEPROC, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags))
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_ARB_get_program_binary(void) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+}
+static void lazy_GL_KHR_parallel_shader_compile(void) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = glad_lazy_glMaxShaderCompilerThreadsKHR;
+}
+static void lazy_GL_ARB_buffer_storage(void) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+}
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
 	free_exts();
 	return 1;
 }
 
-static void find_coreGL(void) {
+/* major.minor out of a GL_VERSION string, returns 0 if there isn't one */
+static int parse_version(const char *version, int *major, int *minor) {
 
     /* Thank you @elmindreda
      * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
      * https://github.com/glfw/glfw/blob/master/src/context.c#L36
      */
-    int i, major, minor;
+    int i;
 
-    const char* version;
     const char* prefixes[] = {
         "OpenGL ES-CM ",
         "OpenGL ES-CL ",
@@ -1077,8 +3293,7 @@ static void find_coreGL(void) {
         NULL
     };
 
-    version = (const char*) glGetString(GL_VERSION);
-    if (!version) return;
+    if (!version) return 0;
 
     for (i = 0;  prefixes[i];  i++) {
         const size_t length = strlen(prefixes[i]);
@@ -1090,10 +3305,16 @@ static void find_coreGL(void) {
 
 /* PR #18 */
 #ifdef _MSC_VER
-    sscanf_s(version, "%d.%d", &major, &minor);
+    sscanf_s(version, "%d.%d", major, minor);
 #else
-    sscanf(version, "%d.%d", &major, &minor);
+    sscanf(version, "%d.%d", major, minor);
 #endif
+    return 1;
+}
+
+static void find_coreGL(void) {
+    int major = 0, minor = 0;
+    if (!parse_version((const char*) glGetString(GL_VERSION), &major, &minor)) return;
 
     GLVersion.major = major; GLVersion.minor = minor;
     max_loaded_major = major; max_loaded_minor = minor;
@@ -1135,6 +3356,548 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_get_program_binary(load);
+	load_GL_KHR_parallel_shader_compile(load);
+	load_GL_ARB_buffer_storage(load);
+#ifdef GLAD_INSTRUMENT
+	trace_wrap();
+#endif
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+/* Lazy mode: every entry point starts out pointing at a trampoline that looks the real
+ * function up the first time it's called and then replaces itself with it, so startup
+ * only pays for the functions the program actually uses.
+ * The loader has to stay usable for as long as GL is used (no gladLoadGL equivalent,
+ * that one closes libGL right after loading). */
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glad_lazy_load = load;
+	glad_lazy_resolved = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+
+	if (!find_extensionsGL()) return 0;
+	lazy_GL_ARB_get_program_binary();
+	lazy_GL_KHR_parallel_shader_compile();
+	lazy_GL_ARB_buffer_storage();
+#ifdef GLAD_INSTRUMENT
+	trace_wrap();
+#endif
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+int gladLazyResolvedCount(void) {
+	return glad_lazy_resolved;
+}
+
+GLAD_THREAD_LOCAL struct GladGLContext *glad_current_context = NULL;
+
+static void load_GL_VERSION_1_0_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_0) return;
+	context->CullFace = (PFNGLCULLFACEPROC)load("glCullFace");
+	context->FrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
+	context->Hint = (PFNGLHINTPROC)load("glHint");
+	context->LineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
+	context->PointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
+	context->PolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
+	context->Scissor = (PFNGLSCISSORPROC)load("glScissor");
+	context->TexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
+	context->TexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
+	context->TexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
+	context->TexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
+	context->TexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
+	context->TexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
+	context->DrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
+	context->Clear = (PFNGLCLEARPROC)load("glClear");
+	context->ClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
+	context->ClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
+	context->ClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
+	context->StencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
+	context->ColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
+	context->DepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
+	context->Disable = (PFNGLDISABLEPROC)load("glDisable");
+	context->Enable = (PFNGLENABLEPROC)load("glEnable");
+	context->Finish = (PFNGLFINISHPROC)load("glFinish");
+	context->Flush = (PFNGLFLUSHPROC)load("glFlush");
+	context->BlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
+	context->LogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
+	context->StencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
+	context->StencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
+	context->DepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
+	context->PixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
+	context->PixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
+	context->ReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
+	context->ReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
+	context->GetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
+	context->GetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
+	context->GetError = (PFNGLGETERRORPROC)load("glGetError");
+	context->GetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
+	context->GetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	context->GetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
+	context->GetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
+	context->GetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
+	context->GetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
+	context->GetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
+	context->IsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
+	context->DepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
+	context->Viewport = (PFNGLVIEWPORTPROC)load("glViewport");
+}
+static void load_GL_VERSION_1_1_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_1) return;
+	context->DrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
+	context->DrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
+	context->PolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
+	context->CopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
+	context->CopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
+	context->CopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
+	context->CopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
+	context->TexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
+	context->TexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
+	context->BindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
+	context->DeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
+	context->GenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
+	context->IsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+}
+static void load_GL_VERSION_1_2_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_2) return;
+	context->DrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
+	context->TexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
+	context->TexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
+	context->CopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
+}
+static void load_GL_VERSION_1_3_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_3) return;
+	context->ActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
+	context->SampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
+	context->CompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
+	context->CompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
+	context->CompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
+	context->CompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
+	context->CompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
+	context->CompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
+	context->GetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+}
+static void load_GL_VERSION_1_4_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_4) return;
+	context->BlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
+	context->MultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
+	context->MultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
+	context->PointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
+	context->PointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
+	context->PointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
+	context->PointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
+	context->BlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
+	context->BlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
+}
+static void load_GL_VERSION_1_5_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_1_5) return;
+	context->GenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
+	context->DeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
+	context->IsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
+	context->BeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
+	context->EndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
+	context->GetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
+	context->GetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
+	context->GetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
+	context->BindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
+	context->DeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
+	context->GenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
+	context->IsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
+	context->BufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
+	context->BufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+	context->GetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
+	context->MapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
+	context->UnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
+	context->GetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
+	context->GetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
+}
+static void load_GL_VERSION_2_0_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_2_0) return;
+	context->BlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
+	context->DrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
+	context->StencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
+	context->StencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
+	context->StencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
+	context->AttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
+	context->BindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
+	context->CompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
+	context->CreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
+	context->CreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
+	context->DeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
+	context->DeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
+	context->DetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
+	context->DisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
+	context->EnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
+	context->GetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
+	context->GetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
+	context->GetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
+	context->GetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
+	context->GetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
+	context->GetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
+	context->GetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
+	context->GetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
+	context->GetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
+	context->GetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
+	context->GetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
+	context->GetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
+	context->GetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
+	context->GetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
+	context->GetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
+	context->GetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
+	context->IsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
+	context->IsShader = (PFNGLISSHADERPROC)load("glIsShader");
+	context->LinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
+	context->ShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
+	context->UseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
+	context->Uniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
+	context->Uniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
+	context->Uniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
+	context->Uniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
+	context->Uniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
+	context->Uniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
+	context->Uniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
+	context->Uniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
+	context->Uniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
+	context->Uniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
+	context->Uniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
+	context->Uniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
+	context->Uniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
+	context->Uniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
+	context->Uniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
+	context->Uniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
+	context->UniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
+	context->UniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
+	context->UniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
+	context->ValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
+	context->VertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
+	context->VertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
+	context->VertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
+	context->VertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
+	context->VertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
+	context->VertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
+	context->VertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
+	context->VertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
+	context->VertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
+	context->VertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
+	context->VertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
+	context->VertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
+	context->VertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
+	context->VertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
+	context->VertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
+	context->VertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
+	context->VertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
+	context->VertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
+	context->VertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
+	context->VertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
+	context->VertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
+	context->VertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
+	context->VertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
+	context->VertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
+	context->VertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
+	context->VertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
+	context->VertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
+	context->VertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
+	context->VertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
+	context->VertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
+	context->VertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
+	context->VertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
+	context->VertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
+	context->VertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
+	context->VertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
+	context->VertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
+	context->VertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
+}
+static void load_GL_VERSION_2_1_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_2_1) return;
+	context->UniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
+	context->UniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
+	context->UniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
+	context->UniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
+	context->UniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
+	context->UniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
+}
+static void load_GL_VERSION_3_0_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_3_0) return;
+	context->ColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
+	context->GetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
+	context->GetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+	context->Enablei = (PFNGLENABLEIPROC)load("glEnablei");
+	context->Disablei = (PFNGLDISABLEIPROC)load("glDisablei");
+	context->IsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
+	context->BeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
+	context->EndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
+	context->BindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	context->BindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	context->TransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
+	context->GetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
+	context->ClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
+	context->BeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
+	context->EndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
+	context->VertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
+	context->GetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
+	context->GetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
+	context->VertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
+	context->VertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
+	context->VertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
+	context->VertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
+	context->VertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
+	context->VertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
+	context->VertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
+	context->VertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
+	context->VertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
+	context->VertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
+	context->VertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
+	context->VertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
+	context->VertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
+	context->VertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
+	context->VertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
+	context->VertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
+	context->VertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
+	context->VertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
+	context->VertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
+	context->VertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
+	context->GetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
+	context->BindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
+	context->GetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
+	context->Uniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
+	context->Uniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
+	context->Uniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
+	context->Uniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
+	context->Uniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
+	context->Uniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
+	context->Uniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
+	context->Uniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
+	context->TexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
+	context->TexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
+	context->GetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
+	context->GetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
+	context->ClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
+	context->ClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
+	context->ClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
+	context->ClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
+	context->GetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+	context->IsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
+	context->BindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
+	context->DeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
+	context->GenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
+	context->RenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
+	context->GetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
+	context->IsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
+	context->BindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
+	context->DeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
+	context->GenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
+	context->CheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
+	context->FramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
+	context->FramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
+	context->FramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
+	context->FramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
+	context->GetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
+	context->GenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
+	context->BlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
+	context->RenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
+	context->FramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
+	context->MapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+	context->FlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
+	context->BindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
+	context->DeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
+	context->GenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
+	context->IsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
+}
+static void load_GL_VERSION_3_1_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_3_1) return;
+	context->DrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
+	context->DrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
+	context->TexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
+	context->PrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
+	context->CopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
+	context->GetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
+	context->GetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
+	context->GetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
+	context->GetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
+	context->GetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
+	context->GetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
+	context->UniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
+	context->BindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	context->BindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	context->GetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+}
+static void load_GL_VERSION_3_2_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_3_2) return;
+	context->DrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
+	context->DrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
+	context->DrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
+	context->MultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
+	context->ProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
+	context->FenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
+	context->IsSync = (PFNGLISSYNCPROC)load("glIsSync");
+	context->DeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
+	context->ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
+	context->WaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
+	context->GetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
+	context->GetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
+	context->GetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
+	context->GetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
+	context->FramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
+	context->TexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
+	context->TexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
+	context->GetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
+	context->SampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
+}
+static void load_GL_VERSION_3_3_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->VERSION_3_3) return;
+	context->BindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
+	context->GetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
+	context->GenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
+	context->DeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
+	context->IsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
+	context->BindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
+	context->SamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
+	context->SamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
+	context->SamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
+	context->SamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
+	context->SamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
+	context->SamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
+	context->GetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
+	context->GetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
+	context->GetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
+	context->GetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
+	context->QueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+	context->GetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+	context->GetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+	context->VertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
+	context->VertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
+	context->VertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
+	context->VertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
+	context->VertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
+	context->VertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
+	context->VertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
+	context->VertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
+	context->VertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
+	context->VertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
+	context->VertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
+	context->VertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
+	context->VertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
+	context->VertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
+	context->VertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
+	context->TexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
+	context->TexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
+	context->TexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
+	context->TexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
+	context->TexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
+	context->TexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
+	context->TexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
+	context->TexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
+	context->MultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
+	context->MultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
+	context->MultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
+	context->MultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
+	context->MultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
+	context->MultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
+	context->MultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
+	context->MultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
+	context->NormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
+	context->NormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
+	context->ColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
+	context->ColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
+	context->ColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
+	context->ColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
+	context->SecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
+	context->SecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+}
+static void load_GL_ARB_get_program_binary_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->ARB_get_program_binary) return;
+	context->GetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	context->ProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	context->ProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_KHR_parallel_shader_compile_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->KHR_parallel_shader_compile) return;
+	context->MaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+static void load_GL_ARB_buffer_storage_context(struct GladGLContext *context, GLADloadproc load) {
+	if(!context->ARB_buffer_storage) return;
+	context->BufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static int find_extensionsGL_context(struct GladGLContext *context, int major) {
+	struct gladExtensionSet set = { NULL, 0, 0, NULL, 0 };
+	if (!parse_exts(&set, major, &context->GetString, &context->GetIntegerv, &context->GetStringi)) {
+		free_ext_set(&set);
+		return 0;
+	}
+	context->ARB_get_program_binary = find_ext(&set, "GL_ARB_get_program_binary");
+	context->KHR_parallel_shader_compile = find_ext(&set, "GL_KHR_parallel_shader_compile");
+	context->ARB_buffer_storage = find_ext(&set, "GL_ARB_buffer_storage");
+	free_ext_set(&set);
+	return 1;
+}
+
+static int find_coreGL_context(struct GladGLContext *context) {
+	int major = 0, minor = 0;
+	if (!parse_version((const char*) context->GetString(GL_VERSION), &major, &minor)) return 0;
+	context->version.major = major; context->version.minor = minor;
+	context->VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	context->VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	context->VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	context->VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	context->VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	context->VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	context->VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	context->VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	context->VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	context->VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	context->VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	context->VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+	/* the highest version this loader knows, decides which way extensions are listed */
+	return major > 3 || (major == 3 && minor >= 3) ? 3 : major;
+}
+
+int gladLoadGLContext(struct GladGLContext *context, GLADloadproc load) {
+	int major;
+	memset(context, 0, sizeof(*context));
+	context->GetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(context->GetString == NULL) return 0;
+	if(context->GetString(GL_VERSION) == NULL) return 0;
+	major = find_coreGL_context(context);
+	load_GL_VERSION_1_0_context(context, load);
+	load_GL_VERSION_1_1_context(context, load);
+	load_GL_VERSION_1_2_context(context, load);
+	load_GL_VERSION_1_3_context(context, load);
+	load_GL_VERSION_1_4_context(context, load);
+	load_GL_VERSION_1_5_context(context, load);
+	load_GL_VERSION_2_0_context(context, load);
+	load_GL_VERSION_2_1_context(context, load);
+	load_GL_VERSION_3_0_context(context, load);
+	load_GL_VERSION_3_1_context(context, load);
+	load_GL_VERSION_3_2_context(context, load);
+	load_GL_VERSION_3_3_context(context, load);
+
+	if (!find_extensionsGL_context(context, major)) return 0;
+	load_GL_ARB_get_program_binary_context(context, load);
+	load_GL_KHR_parallel_shader_compile_context(context, load);
+	load_GL_ARB_buffer_storage_context(context, load);
+	return context->version.major != 0 || context->version.minor != 0;
+}
+
+void gladSetGLContext(struct GladGLContext *context) {
+	glad_current_context = context;
+}
+
+struct GladGLContext *gladGetGLContext(void) {
+	return glad_current_context;
+}
@@ -1,68 +1,48 @@
+#include<chrono>
 #include<iostream>
 #include<glad/glad.h>
-#include<glfw/glfw3.h>
-
-// * NOTE: all OpenGL objects are accessed by References!!
-
-// Vertex shader source code
-const char* vertexShaderSource = "#version 330 core\n"
-"layout (location = 0) in vec3 aPos;\n"
-"void main()\n"
-"{\n"
-"	gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-"}\0";
-
-// Fragment shader source code
-const char* fragmentShaderSource = "#version 330 core\n"
-"out vec4 FragColor;\n"
-"void main()\n"
-"{\n"
-"	FragColor = vec4(0.8f, 0.3f, 0.02f, 1.0f);\n"
-"}\n\0";
-
-int main()
-{
-	// start
-	glfwInit();
-
-	// Specify OpenGL version to GLFW package
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 
-	// Specify usage of CORE profile
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#include"Backend.h"
+#include"Benchmark.h"
+#include"FrameDumper.h"
+#include"GLCapture.h"
+#include"GLTrace.h"
+#include"LoaderBench.h"
+#include"MeshScene.h"
+#include"Options.h"
+#include"ProgramCache.h"
+#include"Readback.h"
+#include"ShaderManager.h"
+#include"Scene.h"
+#include"SoftwareRenderer.h"
+#include"StateCache.h"
+#include"VertexArrayCache.h"
+
+int main(int argc, char** argv)
+{
+	AppOptions options;
+	if (!ParseOptions(argc, argv, options))
+		return -1;
 
-	// coordinates of vertices
-	GLfloat vertices[] =
-	{
-		-0.5f, -0.5f * float(sqrt(3)) / 3, 0.0f, // LEFT : BOTTOM
-		0.5f, -0.5f * float(sqrt(3)) / 3, 0.0f, // RIGHT : BOTTOM
-		0.0f, 0.5f * float(sqrt(3)) * 2 / 3, 0.0f // ORIGIN (mid) : UPPER
-	};
+	// --save-mesh only builds the torus and writes it out, for making test assets
+	if (!options.saveMeshPath.empty())
+		return MeshScene(options.instances, options.meshOpt).SaveGenerated(options.saveMeshPath) ? 0 : -1;
 
-	// DETAILS FOR BELOW FUNCTION
+	// --soft never touches GL, it has its own (much shorter) loop
+	if (options.backend == BackendType::Software)
+		return RunSoftware(options);
 
-		// create new GLFWwindow object sized at 800 x 800 pixels with name: as 3rd param
-		// 4th param: specifies which screen will host the window in full screen mode
-			// NULL for none, but can be specified with a "glfwGetMonitors" query (which returns an array of monitors)
-		// 5th param: specifies another window object that will share resources to THIS one
-	GLFWwindow* window = glfwCreateWindow(800, 800, "openGL", NULL, NULL);
-	if (window == NULL)
+	// window or headless: same render loop either way, only the backend knows the difference
+	std::unique_ptr<Backend> backend = CreateBackend(options.backend);
+	if (backend == nullptr)
 	{
-		std::cout << "Failed to create GLFW window" << std::endl;
-		glfwTerminate();
+		std::cout << "Requested backend isn't available in this build" << std::endl;
 		return -1;
 	}
-	// DETAILS FOR BELOW FUNCTION
-
-		// a rendering context is a state where all the OpenGL commands are applied
-		// To draw graphics, you need to have a current rendering context
-		// glfwMakeContextCurrent is called to specify which window's rendering context you want to make current
-		// telling GLFW that you want to work with OpenGL in the context of a specific window.
-		// All subsequent OpenGL operations will affect this window until you set a different context with glfwMakeContextCurrent.
-		//  if you have multiple windows, you'll call glfwMakeContextCurrent for each window before rendering to it
-	glfwMakeContextCurrent(window);
 
+	// creates the window (or the surfaceless context) and makes its OpenGL context current
+	if (!backend->Init(options.width, options.height, "openGL"))
+		return -1;
 
 	// Load GLAD so it configures OpenGL
 	// DETAILS FOR BELOW FUNCTION
@@ -71,8 +51,54 @@ int main()
 		// In modern OpenGL, you don't directly call OpenGL functions like glDrawArrays or glGenBuffers.
 		// Instead, you retrieve function pointers to these OpenGL functions from the OpenGL driver at runtime
 		// calling this queries the graphics driver for the addresses of ALL OpenGL functions in your specified version defined above
+		// the backend hands us the lookup function that matches its context (glfwGetProcAddress or eglGetProcAddress)
+		// with --lazy-gl, nothing is looked up yet: every function gets resolved the first time it's called
 		*/
-	gladLoadGL();
+	auto loaderStart = std::chrono::steady_clock::now();
+#ifdef GLAD_MX
+	// GLAD_MX build: the gl* macros go through the calling thread's dispatch table instead of global pointers,
+	// so the table is loaded for this context and made current on this (the render) thread.
+	// Another thread with its own context would load and set its own table the same way
+	static GladGLContext glContext;
+	if (options.lazyGL)
+		std::cout << "--lazy-gl only applies to the global loader, ignored in a GLAD_MX build" << std::endl;
+	options.lazyGL = false;
+	int loaded = gladLoadGLContext(&glContext, backend->GetProcLoader());
+	gladSetGLContext(&glContext);
+#else
+	int loaded = options.lazyGL ? gladLoadGLLoaderLazy(backend->GetProcLoader()) : gladLoadGLLoader(backend->GetProcLoader());
+#endif
+	double loaderMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loaderStart).count();
+	if (!loaded)
+	{
+		std::cout << "Failed to load OpenGL functions" << std::endl;
+		backend->Shutdown();
+		return -1;
+	}
+#ifdef GLAD_MX
+	const char* loaderMode = "per-context table";
+#else
+	const char* loaderMode = options.lazyGL ? "lazy" : "eager";
+#endif
+	std::cout << "GL loader: " << loaderMode << ", " << loaderMs << " ms" << std::endl;
+
+	// how long reloading the function pointers takes each way (as if the context had been recreated)
+	if (options.reloadBench > 0)
+		RunLoaderBenchmark(backend->GetProcLoader(), options.lazyGL, options.reloadBench);
+
+	// headless has no default framebuffer, so it makes one now that GL functions exist
+	if (!backend->CreateTargets())
+	{
+		backend->Shutdown();
+		return -1;
+	}
+
+	// from here on every GL call also goes into the capture file (after the loader benchmark, which would replace the hooks)
+	if (!options.capturePath.empty() && !StartCapture(options.capturePath, backend->Width(), backend->Height(), backend->Framebuffer()))
+	{
+		backend->Shutdown();
+		return -1;
+	}
 
 	// DETAILS FOR BELOW FUNCTION
 
@@ -80,115 +106,191 @@ int main()
 	// this is different than just the size of the window or at least it CAN be.
 	// this is so that you can have a smaller window but make use of OpenGL in just a part of it
 	// useful in certain scenario's like: split screen gaming, or rendering only a portion of the window for post-processing effects
-	glViewport(0, 0, 800, 800);
-
+	glViewport(0, 0, backend->Width(), backend->Height());
 
-	// OpenGL variable version type of a uint ("positive" integer). Sort of like a code number to refer to that shader now
-		// Creates a GLuint variable to reference the vertex shader CREATED BY the glCreateShader function
-	GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
 
-	// GL shader source specifies the shader source to our shader object
-		// 1st param is the shader object created (GLuint)
-		// 3rd param is a reference to the definition we made at the top of the program
+	// startup cost of the shader programs is timed so a cold (compile) and warm (binary cache) launch can be compared
+	auto programStart = std::chrono::steady_clock::now();
 
-	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
+	// on-disk program binary cache: if this exact program was linked by this exact driver before, there's nothing to compile
+	ProgramCache programCache(options.shaderCacheDir);
 
-	// must be compiled NOW into machine code so that it can be used by the GPU
-	glCompileShader(vertexShader);
-
-		// 
-	GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-	
-	//
-	glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-	//
-	glCompileShader(fragmentShader);
-
-	// creates a shader program
-	GLuint shaderProgram = glCreateProgram();
-	// similar deal, attaching the vertex and fragment shaders to the shader program
-	glAttachShader(shaderProgram, vertexShader);
-	glAttachShader(shaderProgram, fragmentShader);
-	
-	// LINKING is different than attaching. Really combines the attached shaders to the program to be executed on the GPU.
-	glLinkProgram(shaderProgram);
-
-	// deletes the shaders from taking up memory since the linking essentially "copies" all the data it needs to from them to put them in one program
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShader);
+	// every program is queued and submitted up front (compiles + links, see ShaderManager.cpp), and we only wait for
+	// a program when it's first needed. The scene's vertex data setup runs while the driver is still compiling
+	std::unique_ptr<ShaderManager> shaders(new ShaderManager(&programCache));
+	// the context's VAOs, one per layout + buffers whichever scene or mesh asks (see VertexArrayCache.h)
+	std::unique_ptr<VertexArrayCache> vertexArrays(new VertexArrayCache);
 
+	// the scene owns the buffers, VAOs and draw calls (see TriangleScene.cpp for the original triangle)
+	std::unique_ptr<Scene> scene = CreateScene(options);
+	scene->AddPrograms(*shaders);
+	shaders->Submit();
+	double submitMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - programStart).count();
 
+	// buffers, VAOs and (for --mesh-file) the whole parse, all while the programs compile
+	if (!scene->BuildGeometry(*vertexArrays))
+	{
+		scene.reset();
+		vertexArrays.reset();
+		shaders.reset();
+		backend->Shutdown();
+		return -1;
+	}
 
-	// Creates containers to store the Vertex Array Object and Vertex Buffer Object
-	GLuint VAOs[1], VBOs[1]; // vertex buffer object: stores vertex data
-	//VAO: a blueprint for rendering vertex data
-	//VBO: stores the ACTUAL vertex data
+	// benchmark mode: the warmup frames come on top of the frames we actually measure
+	std::unique_ptr<Benchmark> bench;
+	int totalFrames = options.frames;
+	if (options.bench)
+	{
+		bench.reset(new Benchmark(options.warmupFrames, options.frames));
+		totalFrames += options.warmupFrames;
+	}
 
-	// creating placeholders in GPU memory to store the configuration for and actual vertex data, respectively
-	glGenVertexArrays(1, VAOs); // make sure do gen this before the vBo
-	glGenBuffers(1, VBOs);
+	// frames read back to the CPU, timed inside the benchmark frame so sync and pbo can be compared
+	std::unique_ptr<Readback> readback;
+	if (options.readback != ReadbackOption::Off)
+	{
+		ReadbackMode mode = options.readback == ReadbackOption::Sync ? ReadbackMode::Sync : ReadbackMode::Pbo;
+		readback.reset(new Readback(mode, backend->Width(), backend->Height(), options.readbackDepth));
+	}
 
-	glBindVertexArray(VAOs[0]); //This means that any subsequent OpenGL calls that deal with vertex data will use the currently bound VAO as their context.
+	// the frames that were read back go to disk on worker threads
+	std::unique_ptr<FrameDumper> dumper;
+	if (!options.dumpDir.empty())
+	{
+		dumper.reset(new FrameDumper(options.dumpDir, options.dumpFormat, backend->Width(), backend->Height(),
+			options.dumpThreads, options.dumpQueue, options.dumpDrop));
+		if (!dumper->Ready())
+		{
+			readback.reset();
+			scene.reset();
+			vertexArrays.reset();
+			shaders.reset();
+			backend->Shutdown();
+			return -1;
+		}
+		FrameDumper* frames = dumper.get();
+		readback->SetSink([frames](const unsigned char* rgba, int frame) { frames->Submit(rgba, frame); });
+	}
 
-	// tells OpenGL that operations will apply to VBO, and it should be considered as the current GL_ARRAY_BUFFER
-	// preparation to send vertex data to the VBO
-	glBindBuffer(GL_ARRAY_BUFFER, VBOs[0]);
+	// every bind/use in the loop goes through the state cache, which drops calls that wouldn't change anything
+	// (e.g. with the triangle scene, after the first frame every call it makes is redundant: nothing else touches that state)
+	StateCache state;
 
-	// actually PUTS the vertex data into the current buffer (which we specified above is also the VBO
-	// 4th parameter specifies how to use the data from the buffer
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW); 
+	// per entry point GL call counts and times, only in a GLAD_INSTRUMENT build (otherwise this does nothing)
+	GLTrace trace;
 
-	// Configure the Vertex Attribute so that OpenGL knows how to Read the VBO
-		// 1st param: Index of the vertex attribute
-		// 2nd param: specifies how many components per vertex attribute
-		// 3rd param: Specifies that each component is a GL float type
-		// 4th param: Specifies the "stride". Because each vertex in our array has 3 components of type FLOAT, the stride is the total number of bytes that 3 float type variables would occupy
-			// Stride: in memory, how much memory in bytes does our attribute take up, and when should we explect to find the "next" one
-		// 5th param: pointer to the first component of the first attribute. The offset in bytes from the beginning of each vertex in the buffer
-			// (void*)0
-	// this also essentially links our VBO's data INTO our VAO, and HOW OpenGL should do that linking
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	// frames/sec is measured over the whole loop
+	int frameCount = 0;
+	auto loopStart = std::chrono::steady_clock::now();
+	trace.Begin();
 
-	// specifies that we're looking at vertex attribute in idex 0, which is typically VERTEX POSITION
-	glEnableVertexAttribArray(0); // 
+	while (!backend->ShouldClose() && (totalFrames == 0 || frameCount < totalFrames))
+	{
+		if (bench)
+			bench->BeginFrame();
 
-	// unbinds the GL_ARRAY_BUFFER so that in case we do any calls later to it, so that we don't mistakenly change our VBO data, which was bound to it before
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
-	
-	// binding: making a certain object the CURRENT object. So whenever we use a function that would modify this TYPE of object, it modifies the current one
+		// binds the window's framebuffer, or the headless backend's framebuffer object
+		backend->BeginFrame();
 
-	while (!glfwWindowShouldClose(window))
-	{
 		// RGBA of the color buffer
-		glClearColor(0.07f, 0.13f, 0.17f, 1.0f);
+		state.ClearColor(0.07f, 0.13f, 0.17f, 1.0f);
 
 		// clears the color buffer of the FRAME buffer (sets all pixels in buffer to the CLEAR color we've set above
 		glClear(GL_COLOR_BUFFER_BIT);
-		// specifies our shader program will be used
-		glUseProgram(shaderProgram);
-		// loads our VAO which contains the organized version of our VBO
-		glBindVertexArray(VAOs[0]);
+		// the scene's draw calls. The first frame is where we'd wait for programs that are still compiling
+		scene->Draw(state, frameCount);
+		// has to happen before the swap, the back buffer's contents are gone after it
+		if (readback)
+			readback->ReadFrame(backend->Framebuffer(), frameCount);
+
+		// swaps the buffers and polls events (headless just flushes)
+		backend->EndFrame();
+		CaptureEndFrame();
+		frameCount++;
+
+		if (frameCount == 1)
+		{
+			double firstFrameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - programStart).count();
+			std::cout << "shader programs: " << shaders->Count() << " submitted in " << submitMs << " ms, first frame done after "
+				<< firstFrameMs << " ms (" << shaders->FromCache() << " warm from program binary cache, "
+				<< (shaders->Parallel() ? "parallel compile" : "serial compile") << ")" << std::endl;
+		}
+
+		state.EndFrame();
+		trace.EndFrame();
+		if (bench)
+			bench->EndFrame();
+	}
 
-		// Renders our vertices
-			// 1st param: specifies primitive to draw between vertices from the array
-			// 2nd param: specifies the starting index within the bound Vertex Array.
-			// 3rd param: specifies the number of vertices to render in total this way (in our case, the length of our vertices array)
-		glDrawArrays(GL_TRIANGLES, 0, 3);
+	// the pbo ring still holds the last few frames
+	if (readback)
+		readback->Finish();
+	if (dumper)
+		dumper->Finish();
 
-		// swaps the buffers
-		glfwSwapBuffers(window);
+	// wait for the GPU to actually finish the last frames, otherwise headless would only be timing how fast we QUEUE commands
+	glFinish();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - loopStart).count();
+	if (frameCount > 0 && seconds > 0.0)
+	{
+		std::cout << backend->Name() << ": " << frameCount << " frames in " << seconds << " s ("
+			<< frameCount / seconds << " frames/sec, " << 1000.0 * seconds / frameCount << " ms/frame, "
+			<< (frameCount / seconds) * backend->Width() * backend->Height() / 1e6 << " Mpixels/sec)" << std::endl;
+		std::cout << "scene " << scene->Name() << ": " << scene->Objects() << " objects in " << scene->DrawCalls() << " draw calls per frame ("
+			<< scene->Objects() * (frameCount / seconds) << " objects/sec, " << scene->DrawCalls() * (frameCount / seconds)
+			<< " draw calls/sec)" << std::endl;
+	}
 
-		glfwPollEvents(); 
+	state.PrintReport();
+	trace.PrintReport();
+	scene->PrintReport();
+	vertexArrays->PrintReport();
+	if (readback)
+		readback->PrintReport();
+	if (dumper)
+		dumper->PrintReport();
+	if (options.lazyGL)
+		std::cout << "GL loader: " << gladLazyResolvedCount() << " functions resolved on first call" << std::endl;
+
+	if (bench)
+	{
+		// collects the GPU timings that were still in flight when the loop ended
+		bench->Finish();
+
+		BenchmarkInfo info;
+		info.backend = backend->Name();
+		info.width = backend->Width();
+		info.height = backend->Height();
+		QueryContextInfo(info);
+
+		bench->Print(info);
+		if (!options.csvPath.empty())
+			bench->WriteCSV(options.csvPath);
+		if (!options.jsonPath.empty())
+			bench->WriteJSON(options.jsonPath, info);
+
+		// the queries belong to the context, delete them before it goes away
+		bench.reset();
 	}
 
 	// cleanup!
-	glDeleteVertexArrays(1, VAOs);
-	glDeleteBuffers(1, VBOs);
-	glDeleteProgram(shaderProgram);
+	// everything GL has to be gone BEFORE the context is destroyed by the backend
+	dumper.reset();
+	readback.reset();
+	scene.reset();
+	vertexArrays.reset();
+	shaders.reset();
+
+	if (CaptureActive())
+	{
+		CaptureStats captured = GetCaptureStats();
+		StopCapture();
+		std::cout << "capture: " << captured.calls << " GL calls over " << captured.frames << " frames written to "
+			<< options.capturePath << " (" << captured.bytes / 1024 << " KB, replay with gl_replay)" << std::endl;
+	}
 
 	// end logic
-	glfwDestroyWindow(window);
-	glfwTerminate();
+	backend->Shutdown();
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include"shaderClass.h"
+
+Shader& Shader::operator=(Shader&& other) noexcept
+{
+	if (this != &other)
+	{
+		Delete();
+		ID = other.ID;
+		other.ID = 0;
+	}
+	return *this;
+}
+
+void Shader::Activate() const
+{
+	glUseProgram(ID);
+}
+
+void Shader::Delete()
+{
+	if (ID != 0)
+	{
+		glDeleteProgram(ID);
+		ID = 0;
+	}
+}
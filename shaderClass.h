@@ -0,0 +1,34 @@
+#ifndef SHADER_CLASS_H
+#define SHADER_CLASS_H
+
+#include<glad/glad.h>
+
+// a linked shader program. Move-only handle, see VBO.h.
+// Building programs is ShaderManager's job (it compiles them all at once and knows about the binary cache),
+// a Shader just owns the result
+class Shader
+{
+public:
+	// ID reference of the Shader Program, 0 = none
+	GLuint ID = 0;
+
+	// empty handle, owns nothing
+	Shader() {}
+	// takes ownership of an already created program
+	explicit Shader(GLuint program) : ID(program) {}
+	~Shader() { Delete(); }
+
+	Shader(const Shader&) = delete;
+	Shader& operator=(const Shader&) = delete;
+	Shader(Shader&& other) noexcept : ID(other.ID) { other.ID = 0; }
+	Shader& operator=(Shader&& other) noexcept;
+
+	// specifies this shader program will be used (glUseProgram)
+	void Activate() const;
+	// deletes the program now instead of waiting for the destructor (e.g. before the context goes away)
+	void Delete();
+};
+
+static_assert(sizeof(Shader) == sizeof(GLuint), "Shader must stay a bare handle");
+
+#endif
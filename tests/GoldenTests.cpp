@@ -0,0 +1,516 @@
+#include<chrono>
+#include<cmath>
+#include<cstdio>
+#include<cstdlib>
+#include<cstring>
+#include<filesystem>
+#include<fstream>
+#include<iostream>
+#include<map>
+#include<sstream>
+#include<string>
+#include<vector>
+#include<glad/glad.h>
+
+#include"Backend.h"
+#include"Options.h"
+#include"ProgramCache.h"
+#include"Readback.h"
+#include"Scene.h"
+#include"ShaderManager.h"
+#include"SoftRasterizer.h"
+#include"StateCache.h"
+#include"EBO.h"
+#include"VBO.h"
+#include"VertexArrayCache.h"
+
+// * NOTE: golden image tests. Every test renders a scene headless (Mesa llvmpipe on the build machines), reads back
+// one frame and compares it against a checked-in image in tests/golden. It also times a run of frames and compares
+// that against the checked-in timings, so a change that makes a scene much slower fails just like one that draws
+// it wrong.
+//
+//   gl_tests [--golden DIR] [--assets DIR] [--out DIR] [--filter NAME] [--time-slack X] [--no-timing] [--update]
+//
+// vertex_array_cache isn't an image: it checks that VertexArrayCache reuses VAOs (it needs the same GL context).
+// Neither is options, which checks a few ParseOptions corner cases.
+//
+// --update rewrites the golden images and timings from this run (look at the images before committing them!). With
+// --filter only that test's timing changes, the others in timings.txt are kept
+//
+// Images are compared with a perceptual color distance (the YIQ based one from pixelmatch, after Kotsarenko &
+// Ramos, "Measuring perceived color difference using YIQ NTSC transmission color space"), which weighs brightness
+// differences more than hue differences the way eyes do. A pixel counts as different above PixelThreshold, and a
+// test fails when more than maxMismatch of its pixels are different. Failing tests write the rendered frame and a
+// diff image (different pixels in red) to the --out directory.
+
+// everything a test needs to know to render its frame
+struct GoldenTest
+{
+	const char* name;
+	SceneType scene;
+	int instances;
+	StreamMode stream;
+	bool sortDraws;
+	// the frame compared against the golden (animated scenes move every frame)
+	int goldenFrame;
+	// fraction of pixels allowed to differ
+	double maxMismatch;
+	MeshOptimization meshOpt;
+	// drawn by SoftRasterizer (--soft) instead of GL
+	bool software;
+	// mesh scene: a file in the --assets directory instead of the generated torus. Mesh files are cached in
+	// <--out>/mesh_cache, which starts out empty, so the first test of a file parses it and later ones map the cache
+	const char* meshFile;
+	// mesh scene: how the vertex buffer stores the vertices
+	VertexFormat vertexFormat;
+};
+
+// new scenes get a line here (and a golden image from --update)
+static const GoldenTest tests[] =
+{
+	{ "triangle",            SceneType::Triangle,  0,     StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Auto },
+	{ "triangle_ring",       SceneType::Triangle,  0,     StreamMode::Ring,       true,  30, 0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Auto },
+	{ "triangle_bufferdata", SceneType::Triangle,  0,     StreamMode::BufferData, true,  30, 0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Auto },
+	{ "naive",               SceneType::Naive,     2000,  StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Auto },
+	{ "instanced",           SceneType::Instanced, 2000,  StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Auto },
+	{ "queue_sorted",        SceneType::Queue,     500,   StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Auto },
+	{ "queue_unsorted",      SceneType::Queue,     500,   StreamMode::Off,        false, 0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Auto },
+	{ "mesh",                SceneType::Mesh,      20000, StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Auto },
+	{ "mesh_soup",           SceneType::Mesh,      20000, StreamMode::Off,        true,  0,  0.001, MeshOptimization::Off,  false, nullptr,      VertexFormat::Auto },
+	{ "mesh_float",          SceneType::Mesh,      20000, StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Float },
+	{ "mesh_half",           SceneType::Mesh,      20000, StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Half },
+	{ "mesh_quant10",        SceneType::Mesh,      20000, StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, nullptr,      VertexFormat::Quantized10 },
+	{ "mesh_obj",            SceneType::Mesh,      0,     StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, "torus.obj",  VertexFormat::Auto },
+	{ "mesh_obj_cached",     SceneType::Mesh,      0,     StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, "torus.obj",  VertexFormat::Auto },
+	{ "mesh_gltf",           SceneType::Mesh,      0,     StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, false, "torus.gltf", VertexFormat::Auto },
+	{ "soft_triangle",       SceneType::Triangle,  0,     StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, true,  nullptr,      VertexFormat::Auto },
+	{ "soft_triangle_ring",  SceneType::Triangle,  0,     StreamMode::Ring,       true,  30, 0.001, MeshOptimization::Full, true,  nullptr,      VertexFormat::Auto },
+	{ "soft_mesh",           SceneType::Mesh,      20000, StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, true,  nullptr,      VertexFormat::Auto },
+	{ "soft_mesh_soup",      SceneType::Mesh,      20000, StreamMode::Off,        true,  0,  0.001, MeshOptimization::Off,  true,  nullptr,      VertexFormat::Auto },
+	{ "soft_mesh_gltf",      SceneType::Mesh,      0,     StreamMode::Off,        true,  0,  0.001, MeshOptimization::Full, true,  "torus.gltf", VertexFormat::Auto },
+};
+
+static const int TestSize = 128;
+// frames timed per test, after the golden frame
+static const int TimedFrames = 50;
+// per pixel YIQ distance (0..1) above which a pixel counts as different
+static const double PixelThreshold = 0.1;
+// a test is only too slow when it's also this much slower in absolute terms (tiny scenes are mostly timer noise)
+static const double TimeMarginMs = 0.5;
+
+// RGB, top row first: what's in a PPM file
+struct Image
+{
+	int width = 0;
+	int height = 0;
+	std::vector<unsigned char> rgb;
+};
+
+static bool ReadPPM(const std::string& path, Image& image)
+{
+	std::ifstream file(path, std::ios::binary);
+	std::string magic;
+	int maxValue = 0;
+	file >> magic >> image.width >> image.height >> maxValue;
+	if (!file || magic != "P6" || maxValue != 255 || image.width <= 0 || image.height <= 0)
+		return false;
+	file.get(); // the single whitespace after the header
+	image.rgb.resize((size_t)image.width * image.height * 3);
+	file.read((char*)image.rgb.data(), image.rgb.size());
+	return (size_t)file.gcount() == image.rgb.size();
+}
+
+// glReadPixels RGBA (bottom row first) -> Image
+static Image FromReadback(const unsigned char* rgba, int width, int height)
+{
+	Image image;
+	image.width = width;
+	image.height = height;
+	image.rgb.reserve((size_t)width * height * 3);
+	for (int y = height - 1; y >= 0; y--)
+		for (int x = 0; x < width; x++)
+			image.rgb.insert(image.rgb.end(), rgba + ((size_t)y * width + x) * 4, rgba + ((size_t)y * width + x) * 4 + 3);
+	return image;
+}
+
+// perceived difference between two colors, 0 = same, 1 = black vs. white
+static double ColorDelta(const unsigned char* a, const unsigned char* b)
+{
+	double dr = (double)a[0] - b[0], dg = (double)a[1] - b[1], db = (double)a[2] - b[2];
+	double y = dr * 0.29889531 + dg * 0.58662247 + db * 0.11448223;
+	double i = dr * 0.59597799 - dg * 0.27417610 - db * 0.32180189;
+	double q = dr * 0.21147017 - dg * 0.52261711 + db * 0.31114694;
+	// 35215 is the delta between black and white
+	return (0.5053 * y * y + 0.299 * i * i + 0.1957 * q * q) / 35215.0;
+}
+
+struct Comparison
+{
+	int different = 0;
+	double maxDelta = 0.0;
+	Image diff;
+};
+
+static Comparison Compare(const Image& actual, const Image& golden)
+{
+	Comparison result;
+	result.diff = actual;
+	size_t pixels = (size_t)actual.width * actual.height;
+	for (size_t p = 0; p < pixels; p++)
+	{
+		const unsigned char* a = &actual.rgb[p * 3];
+		const unsigned char* g = &golden.rgb[p * 3];
+		double delta = ColorDelta(a, g);
+		if (delta > result.maxDelta)
+			result.maxDelta = delta;
+
+		// diff image: faded copy of the frame, with the different pixels in red
+		unsigned char* d = &result.diff.rgb[p * 3];
+		if (delta > PixelThreshold)
+		{
+			result.different++;
+			d[0] = 255; d[1] = 0; d[2] = 0;
+		}
+		else
+		{
+			unsigned char gray = (unsigned char)(160 + (a[0] + a[1] + a[2]) / 12);
+			d[0] = d[1] = d[2] = gray;
+		}
+	}
+	return result;
+}
+
+// writes an Image (top row first) as PPM
+static bool WritePPM(const std::string& path, const Image& image)
+{
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (file == nullptr)
+		return false;
+	std::fprintf(file, "P6\n%d %d\n255\n", image.width, image.height);
+	bool ok = std::fwrite(image.rgb.data(), 1, image.rgb.size(), file) == image.rgb.size();
+	return std::fclose(file) == 0 && ok;
+}
+
+// "name ms" per line
+static std::map<std::string, double> ReadTimings(const std::string& path)
+{
+	std::map<std::string, double> timings;
+	std::ifstream file(path);
+	std::string line;
+	while (std::getline(file, line))
+	{
+		std::istringstream fields(line);
+		std::string name;
+		double ms;
+		if (line.empty() || line[0] == '#' || !(fields >> name >> ms))
+			continue;
+		timings[name] = ms;
+	}
+	return timings;
+}
+
+// RenderTest for the software rasterizer: same frames, no GL
+static bool RenderSoftwareTest(const AppOptions& options, const GoldenTest& test, std::vector<unsigned char>& pixels, double& msPerFrame)
+{
+	std::unique_ptr<Scene> scene = CreateScene(options);
+	if (scene == nullptr || !scene->InitSoftware())
+		return false;
+
+	SoftRasterizer raster(TestSize, TestSize);
+	auto frame = [&](int index)
+	{
+		raster.BeginFrame(0.07f, 0.13f, 0.17f, 1.0f);
+		scene->DrawSoftware(raster, index);
+		raster.EndFrame();
+		if (index == test.goldenFrame)
+			pixels.assign(raster.Pixels(), raster.Pixels() + (size_t)TestSize * TestSize * 4);
+	};
+
+	for (int i = 0; i <= test.goldenFrame; i++)
+		frame(i);
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 1; i <= TimedFrames; i++)
+		frame(test.goldenFrame + i);
+	msPerFrame = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / TimedFrames;
+	return true;
+}
+
+// renders the test's golden frame into pixels, then times TimedFrames more frames
+static bool RenderTest(Backend& backend, VertexArrayCache& vertexArrays, const GoldenTest& test, const std::string& assetDir,
+	const std::string& meshCacheDir, std::vector<unsigned char>& pixels, double& msPerFrame)
+{
+	AppOptions options;
+	options.scene = test.scene;
+	options.instances = test.instances;
+	options.stream = test.stream;
+	options.sortDraws = test.sortDraws;
+	options.meshOpt = test.meshOpt;
+	options.vertexFormat = test.vertexFormat;
+	if (test.meshFile != nullptr)
+	{
+		options.meshFile = (std::filesystem::path(assetDir) / test.meshFile).string();
+		options.meshCacheDir = meshCacheDir;
+	}
+	if (test.software)
+		return RenderSoftwareTest(options, test, pixels, msPerFrame);
+
+	ProgramCache programCache("");
+	ShaderManager shaders(&programCache);
+	std::unique_ptr<Scene> scene = CreateScene(options);
+	if (scene == nullptr)
+		return false;
+	scene->AddPrograms(shaders);
+	shaders.Submit();
+	if (!scene->BuildGeometry(vertexArrays))
+		return false;
+
+	Readback readback(ReadbackMode::Sync, backend.Width(), backend.Height());
+	readback.SetSink([&pixels](const unsigned char* rgba, int) { pixels.assign(rgba, rgba + pixels.size()); });
+	pixels.resize(readback.FrameBytes());
+
+	// same frame as main.cpp draws
+	StateCache state;
+	auto frame = [&](int index)
+	{
+		backend.BeginFrame();
+		state.ClearColor(0.07f, 0.13f, 0.17f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		scene->Draw(state, index);
+		if (index == test.goldenFrame)
+			readback.ReadFrame(backend.Framebuffer(), index);
+		backend.EndFrame();
+		state.EndFrame();
+	};
+
+	for (int i = 0; i <= test.goldenFrame; i++)
+		frame(i);
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 1; i <= TimedFrames; i++)
+		frame(test.goldenFrame + i);
+	glFinish();
+	msPerFrame = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / TimedFrames;
+	return shaders.Failed() == 0;
+}
+
+// the same layout over the same buffers twice is one VAO, configured once. A layout that only shares the other's
+// key (the tables differ) gets its own. It runs on the context's cache, after the scenes have used (and released)
+// it, so it also checks that releasing the buffers takes their VAOs out again
+static bool VertexArrayCacheTest(VertexArrayCache& cache)
+{
+	const float positions[9] = { -0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f, 0.0f, 0.5f, 0.0f };
+	const GLuint triangle[3] = { 0, 1, 2 };
+	glBindVertexArray(0);
+	VBO vertices(positions, sizeof(positions));
+	EBO indices(triangle, sizeof(triangle));
+	size_t alive = cache.Size();
+	uint64_t hits = cache.Hits(), misses = cache.Misses();
+
+	const VertexLayout& layout = VertexLayoutOf<PositionVertex>::layout;
+	GLuint first = cache.Get(layout, VertexBuffers(vertices.ID, indices.ID));
+	GLuint second = cache.Get(layout, VertexBuffers(vertices.ID, indices.ID));
+	bool ok = first != 0 && second == first && cache.Hits() == hits + 1 && cache.Misses() == misses + 1
+		&& cache.Size() == alive + 1;
+
+	VertexAttribute normalized = layout.attributes[0];
+	normalized.normalized = GL_TRUE;
+	VertexLayout sameKey = layout;
+	sameKey.attributes = &normalized;
+	GLuint third = cache.Get(sameKey, VertexBuffers(vertices.ID, indices.ID));
+	ok = ok && third != first && cache.Misses() == misses + 2 && cache.Size() == alive + 2;
+
+	// like the scenes do before their buffers go
+	cache.Release(vertices.ID);
+	cache.Release(indices.ID);
+	return ok && cache.Size() == alive;
+}
+
+// a window app given --csv is a benchmark, so it needs (and gets) a frame count
+static bool OptionsTest()
+{
+	char program[] = "OpenGLYoutube", csv[] = "--csv", path[] = "out.csv", frames[] = "--frames", zero[] = "0";
+	char* csvOnly[] = { program, csv, path };
+	AppOptions options;
+	bool ok = ParseOptions(3, csvOnly, options) && options.bench && options.frames > 0;
+
+	// rejected, quietly: its usage text goes nowhere
+	char* csvNoFrames[] = { program, csv, path, frames, zero };
+	AppOptions rejected;
+	std::ostringstream usage;
+	std::streambuf* out = std::cout.rdbuf(usage.rdbuf());
+	ok = ok && !ParseOptions(5, csvNoFrames, rejected);
+	std::cout.rdbuf(out);
+	return ok;
+}
+
+int main(int argc, char** argv)
+{
+	std::string goldenDir = "tests/golden";
+	std::string assetDir = "tests/assets";
+	std::string outDir = "golden_out";
+	std::string filter;
+	double timeSlack = 3.0;
+	bool timing = true;
+	bool update = false;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		bool hasValue = i + 1 < argc;
+		if (arg == "--golden" && hasValue)
+			goldenDir = argv[++i];
+		else if (arg == "--assets" && hasValue)
+			assetDir = argv[++i];
+		else if (arg == "--out" && hasValue)
+			outDir = argv[++i];
+		else if (arg == "--filter" && hasValue)
+			filter = argv[++i];
+		else if (arg == "--time-slack" && hasValue)
+			timeSlack = std::atof(argv[++i]);
+		else if (arg == "--no-timing")
+			timing = false;
+		else if (arg == "--update")
+			update = true;
+		else
+		{
+			std::cout << "usage: " << argv[0] << " [--golden DIR] [--assets DIR] [--out DIR] [--filter NAME] [--time-slack X] [--no-timing] [--update]\n"
+				<< "  --time-slack X  fail when a test takes more than X times its recorded time per frame (default 3)" << std::endl;
+			return 2;
+		}
+	}
+
+	std::unique_ptr<Backend> backend = CreateBackend(BackendType::Headless);
+	if (backend == nullptr)
+		backend = CreateBackend(BackendType::Window);
+	if (backend == nullptr || !backend->Init(TestSize, TestSize, "gl_tests"))
+	{
+		std::cout << "No backend to render the tests with" << std::endl;
+		return 2;
+	}
+#ifdef GLAD_MX
+	static GladGLContext glContext;
+	int loaded = gladLoadGLContext(&glContext, backend->GetProcLoader());
+	gladSetGLContext(&glContext);
+#else
+	int loaded = gladLoadGLLoader(backend->GetProcLoader());
+#endif
+	if (!loaded || !backend->CreateTargets())
+	{
+		std::cout << "Failed to set up GL" << std::endl;
+		backend->Shutdown();
+		return 2;
+	}
+	std::cout << "golden tests on " << glGetString(GL_RENDERER) << ", " << TestSize << "x" << TestSize << std::endl;
+	glViewport(0, 0, TestSize, TestSize);
+
+	std::string timingsPath = (std::filesystem::path(goldenDir) / "timings.txt").string();
+	std::map<std::string, double> baseline = ReadTimings(timingsPath);
+	std::map<std::string, double> measured;
+	// one for the context, shared by the tests: each scene has to Release its buffers for the next one to draw right
+	std::unique_ptr<VertexArrayCache> vertexArrays(new VertexArrayCache);
+
+	// a fresh mesh cache every run, so the tests see both the parse and the cache path
+	std::string meshCacheDir = (std::filesystem::path(outDir) / "mesh_cache").string();
+	std::error_code cacheError;
+	std::filesystem::remove_all(meshCacheDir, cacheError);
+
+	int run = 0, failed = 0;
+	std::printf("  %-22s %10s %10s %10s %10s  %s\n", "test", "differ %", "max delta", "ms/frame", "recorded", "result");
+	for (const GoldenTest& test : tests)
+	{
+		if (!filter.empty() && filter != test.name)
+			continue;
+		run++;
+
+		std::vector<unsigned char> pixels;
+		double ms = 0.0;
+		if (!RenderTest(*backend, *vertexArrays, test, assetDir, meshCacheDir, pixels, ms))
+		{
+			std::printf("  %-22s failed to render\n", test.name);
+			failed++;
+			continue;
+		}
+		measured[test.name] = ms;
+
+		Image actual = FromReadback(pixels.data(), TestSize, TestSize);
+		std::string goldenPath = (std::filesystem::path(goldenDir) / (std::string(test.name) + ".ppm")).string();
+		if (update)
+		{
+			bool written = WritePPM(goldenPath, actual);
+			std::printf("  %-22s %10s %10s %10.3f %10s  %s\n", test.name, "-", "-", ms, "-", written ? "updated" : "CAN'T WRITE");
+			failed += written ? 0 : 1;
+			continue;
+		}
+
+		Image golden;
+		if (!ReadPPM(goldenPath, golden) || golden.width != actual.width || golden.height != actual.height)
+		{
+			std::printf("  %-22s no usable golden image at %s (run with --update)\n", test.name, goldenPath.c_str());
+			failed++;
+			continue;
+		}
+
+		Comparison comparison = Compare(actual, golden);
+		double differ = (double)comparison.different / ((size_t)TestSize * TestSize);
+		bool imageOk = differ <= test.maxMismatch;
+
+		auto recorded = baseline.find(test.name);
+		bool timeOk = !timing || recorded == baseline.end() || ms <= recorded->second * timeSlack
+			|| ms - recorded->second <= TimeMarginMs;
+
+		const char* result = imageOk && timeOk ? "ok" : !imageOk ? "FAIL (image)" : "FAIL (too slow)";
+		if (recorded != baseline.end())
+			std::printf("  %-22s %10.3f %10.4f %10.3f %10.3f  %s\n", test.name, differ * 100.0, comparison.maxDelta, ms, recorded->second, result);
+		else
+			std::printf("  %-22s %10.3f %10.4f %10.3f %10s  %s\n", test.name, differ * 100.0, comparison.maxDelta, ms, "-", result);
+
+		if (!imageOk)
+		{
+			std::error_code error;
+			std::filesystem::create_directories(outDir, error);
+			std::filesystem::path out(outDir);
+			WritePPM((out / (std::string(test.name) + "_actual.ppm")).string(), actual);
+			WritePPM((out / (std::string(test.name) + "_diff.ppm")).string(), comparison.diff);
+		}
+		if (!imageOk || !timeOk)
+			failed++;
+	}
+
+	if (filter.empty() || filter == "vertex_array_cache")
+	{
+		run++;
+		bool ok = VertexArrayCacheTest(*vertexArrays);
+		std::printf("  %-22s %10s %10s %10s %10s  %s\n", "vertex_array_cache", "-", "-", "-", "-", ok ? "ok" : "FAIL");
+		failed += ok ? 0 : 1;
+	}
+	if (filter.empty() || filter == "options")
+	{
+		run++;
+		bool ok = OptionsTest();
+		std::printf("  %-22s %10s %10s %10s %10s  %s\n", "options", "-", "-", "-", "-", ok ? "ok" : "FAIL");
+		failed += ok ? 0 : 1;
+	}
+
+	if (update && !measured.empty())
+	{
+		// a full run writes just what it measured (dropping tests that are gone), a filtered one merges its entry
+		// into the recorded ones
+		std::map<std::string, double> timings = filter.empty() ? measured : baseline;
+		for (const auto& entry : measured)
+			timings[entry.first] = entry.second;
+		std::ofstream file(timingsPath);
+		file << "# ms per frame at " << TestSize << "x" << TestSize << " on " << glGetString(GL_RENDERER) << ", written by gl_tests --update\n";
+		for (const auto& entry : timings)
+			file << entry.first << " " << entry.second << "\n";
+	}
+
+	vertexArrays.reset();
+	backend->Shutdown();
+	if (run == 0)
+	{
+		std::cout << "no test called " << filter << std::endl;
+		return 2;
+	}
+	std::cout << run - failed << "/" << run << " passed" << std::endl;
+	return failed == 0 ? 0 : 1;
+}